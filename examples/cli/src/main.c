@@ -0,0 +1,741 @@
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif /* _FILE_OFFSET_BITS */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "calc_crc/calc_crc.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Files larger than this are split into chunks calculated on several threads and combined (bytes).
+ */
+#define CALC_CRC_CLI_CHUNK (64u * 1024u * 1024u)
+
+/**
+ * @brief   Exit codes (same meaning as cksum/sha256sum).
+ */
+#define CALC_CRC_CLI_EXIT_OK     (0)
+#define CALC_CRC_CLI_EXIT_FAILED (1)
+#define CALC_CRC_CLI_EXIT_USAGE  (2)
+
+// --- Private Types ---------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   CRC value of any type (the library stores results with the element type of the CRC type).
+ */
+typedef union
+{
+    uint8_t crc8;
+    uint16_t crc16;
+    uint32_t crc32;
+    uint64_t crc64;
+} calc_crc_cli_value_t;
+
+/**
+ * @brief   File to calculate (or to verify in check mode).
+ */
+typedef struct
+{
+    const char *path;           // Path of the file ("-" = standard input).
+    uint64_t size;              // Size of a regular file in bytes.
+    bool regular;               // File is a regular file and can be split into chunks.
+    size_t first;               // Index of the first chunk.
+    size_t chunks;              // Number of chunks.
+    uint64_t expected;          // Expected CRC value (check mode).
+    calc_crc_cli_value_t value; // Calculated CRC value.
+    int error;                  // Errno of a failed open/read or 0.
+} calc_crc_cli_file_t;
+
+/**
+ * @brief   Chunk of a file, the unit of work of the worker threads.
+ */
+typedef struct
+{
+    size_t file;                // Index of the file.
+    uint64_t offset;            // Offset of the chunk in the file.
+    uint64_t length;            // Length of the chunk in bytes.
+    calc_crc_cli_value_t value; // CRC value of the chunk.
+    int error;                  // Errno of a failed open/read or 0.
+} calc_crc_cli_chunk_t;
+
+/**
+ * @brief   Output formats.
+ */
+typedef enum
+{
+    CALC_CRC_CLI_FORMAT_TEXT = 0u, // "<crc>  <file>" lines, readable by --check.
+    CALC_CRC_CLI_FORMAT_JSON,      // One JSON object per line.
+} calc_crc_cli_format_e;
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+/**
+ * @brief   Print usage.
+ * @param   stream      Output stream.
+ */
+static void _usage(FILE *stream);
+
+/**
+ * @brief   Print the model catalogue.
+ */
+static void _list(void);
+
+/**
+ * @brief   Parse a number with an optional K/M/G suffix.
+ * @param   text        Text to parse.
+ * @param   base        Number base (0 = C prefixes, 16 = hexadecimal).
+ * @param   value       Pointer to store the value.
+ * @return  True on success, false if the text is not a number.
+ */
+static bool _parse_number(const char *text, int base, uint64_t *value);
+
+/**
+ * @brief   Get CRC value stored with the element type of the CRC type.
+ * @param   type        Type of CRC calculation.
+ * @param   value       Pointer to the value.
+ * @return  CRC value.
+ */
+static uint64_t _value_get(calc_crc_type_e type, const calc_crc_cli_value_t *value);
+
+/**
+ * @brief   Add a file and split it into chunks.
+ * @param   path        Path of the file.
+ * @param   expected    Expected CRC value (check mode).
+ */
+static void _file_add(const char *path, uint64_t expected);
+
+/**
+ * @brief   Read "<crc>  <file>" lines of a manifest and add their files.
+ * @param   path        Path of the manifest ("-" = standard input).
+ * @return  Number of improperly formatted lines, -1 if the manifest can not be read.
+ */
+static long _manifest_read(const char *path);
+
+/**
+ * @brief   Calculate chunks until none is left (worker thread).
+ * @param   arg         Unused.
+ * @return  NULL.
+ */
+static void *_worker(void *arg);
+
+/**
+ * @brief   Calculate one chunk.
+ * @param   crc         Pointer to the CRC instance of the worker.
+ * @param   chunk       Pointer to the chunk.
+ */
+static void _chunk_calculate(calc_crc_t *crc, calc_crc_cli_chunk_t *chunk);
+
+/**
+ * @brief   Print a string as JSON string.
+ * @param   text        Text to print.
+ */
+static void _json_string(const char *text);
+
+// --- Private Variables -----------------------------------------------------------------------------------------------
+
+static calc_crc_t _crc;                      // Initialized instance, copied by every worker.
+static calc_crc_conf_t _conf;                // Configuration of the instance.
+static calc_crc_model_t _model;              // Model parameters (catalogue entry or own parameters).
+static uint64_t _chunk = CALC_CRC_CLI_CHUNK; // Chunk length.
+static calc_crc_cli_file_t *_files;          // Files to calculate.
+static size_t _files_count;                  // Number of files.
+static calc_crc_cli_chunk_t *_chunks;        // Chunks of all files.
+static size_t _chunks_count;                 // Number of chunks.
+static size_t _chunks_next;                  // Next chunk to calculate (shared by workers).
+
+// --- Application Start-Up --------------------------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+    static const struct option options[] = {
+        {"model", required_argument, NULL, 'm'}, {"width", required_argument, NULL, 'w'},
+        {"poly", required_argument, NULL, 'p'},  {"init", required_argument, NULL, 'i'},
+        {"xorout", required_argument, NULL, 'x'}, {"refin", no_argument, NULL, 'r'},
+        {"refout", no_argument, NULL, 'R'},      {"jobs", required_argument, NULL, 'j'},
+        {"chunk", required_argument, NULL, 's'}, {"check", no_argument, NULL, 'c'},
+        {"format", required_argument, NULL, 'f'}, {"quiet", no_argument, NULL, 'q'},
+        {"list", no_argument, NULL, 'l'},        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    const char *name = NULL;
+    calc_crc_cli_format_e format = CALC_CRC_CLI_FORMAT_TEXT;
+    uint64_t jobs = 0;
+    uint64_t number;
+    bool params = false;
+    bool check = false;
+    bool quiet = false;
+    int option;
+
+    memset(&_model, 0, sizeof(_model));
+    _model.name = "custom";
+
+    while (-1 != (option = getopt_long(argc, argv, "m:w:p:i:x:rRj:s:cf:qlh", options, NULL)))
+    {
+        switch (option)
+        {
+        case 'm':
+            name = optarg;
+            break;
+        case 'w':
+            if ((false == _parse_number(optarg, 10, &number)) || (0u == number) || (64u < number))
+            {
+                fprintf(stderr, "calc-crc: invalid width '%s' (1 to 64)\n", optarg);
+                return CALC_CRC_CLI_EXIT_USAGE;
+            }
+            _model.width = (uint8_t)number;
+            params = true;
+            break;
+        case 'p':
+        case 'i':
+        case 'x':
+            if (false == _parse_number(optarg, 16, &number))
+            {
+                fprintf(stderr, "calc-crc: invalid hexadecimal value '%s'\n", optarg);
+                return CALC_CRC_CLI_EXIT_USAGE;
+            }
+            *(('p' == option) ? &_model.polynomial : ('i' == option) ? &_model.initial_value : &_model.final_value) =
+                number;
+            params = true;
+            break;
+        case 'r':
+        case 'R':
+            *(('r' == option) ? &_model.input_reflected : &_model.output_reflected) = true;
+            params = true;
+            break;
+        case 'j':
+            if ((false == _parse_number(optarg, 10, &jobs)) || (0u == jobs) || (1024u < jobs))
+            {
+                fprintf(stderr, "calc-crc: invalid number of jobs '%s'\n", optarg);
+                return CALC_CRC_CLI_EXIT_USAGE;
+            }
+            break;
+        case 's':
+            if ((false == _parse_number(optarg, 0, &_chunk)) || (0u == _chunk))
+            {
+                fprintf(stderr, "calc-crc: invalid chunk length '%s'\n", optarg);
+                return CALC_CRC_CLI_EXIT_USAGE;
+            }
+            break;
+        case 'c':
+            check = true;
+            break;
+        case 'f':
+            if (0 == strcmp(optarg, "text"))
+            {
+                format = CALC_CRC_CLI_FORMAT_TEXT;
+            }
+            else if (0 == strcmp(optarg, "json"))
+            {
+                format = CALC_CRC_CLI_FORMAT_JSON;
+            }
+            else
+            {
+                fprintf(stderr, "calc-crc: invalid format '%s' (text or json)\n", optarg);
+                return CALC_CRC_CLI_EXIT_USAGE;
+            }
+            break;
+        case 'q':
+            quiet = true;
+            break;
+        case 'l':
+            _list();
+            return CALC_CRC_CLI_EXIT_OK;
+        case 'h':
+            _usage(stdout);
+            return CALC_CRC_CLI_EXIT_OK;
+        default:
+            _usage(stderr);
+            return CALC_CRC_CLI_EXIT_USAGE;
+        }
+    }
+
+    // Chunks are mapped on their own, their offsets have to be page aligned
+    long page = sysconf(_SC_PAGESIZE);
+    uint64_t align = (0 < page) ? (uint64_t)page : 4096u;
+    _chunk = ((_chunk + align - 1u) / align) * align;
+
+    // Select the model (catalogue name or own parameters)
+    if ((true == params) && (NULL != name))
+    {
+        fprintf(stderr, "calc-crc: --model can not be combined with own model parameters\n");
+        return CALC_CRC_CLI_EXIT_USAGE;
+    }
+    if (true == params)
+    {
+        if (0u == _model.width)
+        {
+            fprintf(stderr, "calc-crc: own model parameters need --width\n");
+            return CALC_CRC_CLI_EXIT_USAGE;
+        }
+        _model.type = (8u >= _model.width)    ? CALC_CRC_TYPE_8BIT
+                      : (16u >= _model.width) ? CALC_CRC_TYPE_16BIT
+                      : (32u >= _model.width) ? CALC_CRC_TYPE_32BIT
+                                              : CALC_CRC_TYPE_64BIT;
+        if (CALC_CRC_STATUS_OK != CALC_CRC_InitParams(&_crc, &_conf, &_model))
+        {
+            fprintf(stderr, "calc-crc: invalid model parameters\n");
+            return CALC_CRC_CLI_EXIT_USAGE;
+        }
+    }
+    else
+    {
+        calc_crc_model_e model;
+        const calc_crc_model_t *info;
+
+        name = (NULL != name) ? name : "CRC-32";
+        if ((CALC_CRC_STATUS_OK != CALC_CRC_FindModel(name, &model)) ||
+            (CALC_CRC_STATUS_OK != CALC_CRC_GetModel(model, &info)) ||
+            (CALC_CRC_STATUS_OK != CALC_CRC_InitModel(&_crc, &_conf, model)))
+        {
+            fprintf(stderr, "calc-crc: unknown model '%s' (see --list)\n", name);
+            return CALC_CRC_CLI_EXIT_USAGE;
+        }
+        _model = *info;
+    }
+
+    // Collect files (arguments or manifest entries), standard input when none is given
+    char *stdin_path[] = {"-"};
+    char **paths = (optind < argc) ? &argv[optind] : stdin_path;
+    size_t count = (optind < argc) ? (size_t)(argc - optind) : 1u;
+    long improper = 0;
+    int exit_code = CALC_CRC_CLI_EXIT_OK;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (true == check)
+        {
+            long lines = _manifest_read(paths[i]);
+
+            if (0 > lines)
+            {
+                fprintf(stderr, "calc-crc: %s: %s\n", paths[i], strerror(errno));
+                exit_code = CALC_CRC_CLI_EXIT_FAILED;
+            }
+            improper += (0 < lines) ? lines : 0;
+        }
+        else
+        {
+            _file_add(paths[i], 0u);
+        }
+    }
+
+    // Calculate chunks of all files on the worker threads
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t threads = (0u != jobs) ? (size_t)jobs : ((0 < online) ? (size_t)online : 1u);
+    threads = (threads < _chunks_count) ? threads : _chunks_count;
+
+    if (1u < threads)
+    {
+        // Main thread is one of the workers, as the caller in CALC_CRC_CalculateParallel.
+        pthread_t *workers = (pthread_t *)calloc(threads - 1u, sizeof(pthread_t));
+        size_t started = 0;
+
+        while ((NULL != workers) && (started < (threads - 1u)) &&
+               (0 == pthread_create(&workers[started], NULL, _worker, NULL)))
+        {
+            started++;
+        }
+        _worker(NULL);
+        for (size_t t = 0; t < started; t++)
+        {
+            pthread_join(workers[t], NULL);
+        }
+        free(workers);
+    }
+    else
+    {
+        _worker(NULL);
+    }
+
+    // Combine chunks into file values and print them in argument order
+    size_t mismatches = 0;
+    size_t failures = 0;
+    int digits = (_model.width + 3) / 4;
+
+    for (size_t f = 0; f < _files_count; f++)
+    {
+        calc_crc_cli_file_t *file = &_files[f];
+        calc_crc_t crc = _crc;
+
+        file->value = _chunks[file->first].value;
+        file->error = _chunks[file->first].error;
+        for (size_t c = file->first + 1u; (c < (file->first + file->chunks)) && (0 == file->error); c++)
+        {
+            calc_crc_cli_value_t joined;
+
+            file->error = _chunks[c].error;
+            CALC_CRC_Combine(&crc, &file->value, &_chunks[c].value, (size_t)_chunks[c].length, &joined);
+            file->value = joined;
+        }
+
+        uint64_t value = _value_get(_model.type, &file->value);
+        bool matched = (0 == file->error) && (value == file->expected);
+
+        failures += (0 != file->error) ? 1u : 0u;
+        mismatches += ((true == check) && (0 == file->error) && (false == matched)) ? 1u : 0u;
+
+        if (CALC_CRC_CLI_FORMAT_JSON == format)
+        {
+            printf("{\"file\":");
+            _json_string(file->path);
+            printf(",\"model\":");
+            _json_string(_model.name);
+            if (0 != file->error)
+            {
+                printf(",\"error\":");
+                _json_string(strerror(file->error));
+            }
+            else
+            {
+                printf(",\"crc\":\"%0*" PRIx64 "\"", digits, value);
+                if (true == file->regular)
+                {
+                    printf(",\"size\":%" PRIu64, file->size);
+                }
+            }
+            if (true == check)
+            {
+                printf(",\"expected\":\"%0*" PRIx64 "\",\"ok\":%s", digits, file->expected,
+                       (true == matched) ? "true" : "false");
+            }
+            printf("}\n");
+        }
+        else if (0 != file->error)
+        {
+            fprintf(stderr, "calc-crc: %s: %s\n", file->path, strerror(file->error));
+            if (true == check)
+            {
+                printf("%s: FAILED open or read\n", file->path);
+            }
+        }
+        else if (true == check)
+        {
+            if ((false == matched) || (false == quiet))
+            {
+                printf("%s: %s\n", file->path, (true == matched) ? "OK" : "FAILED");
+            }
+        }
+        else
+        {
+            printf("%0*" PRIx64 "  %s\n", digits, value, file->path);
+        }
+    }
+
+    if (0 < improper)
+    {
+        fprintf(stderr, "calc-crc: WARNING: %ld line%s improperly formatted\n", improper,
+                (1 == improper) ? " is" : "s are");
+    }
+    if (0u < failures)
+    {
+        fprintf(stderr, "calc-crc: WARNING: %zu listed file%s could not be read\n", failures,
+                (1u == failures) ? "" : "s");
+        exit_code = CALC_CRC_CLI_EXIT_FAILED;
+    }
+    if (0u < mismatches)
+    {
+        fprintf(stderr, "calc-crc: WARNING: %zu computed checksum%s did NOT match\n", mismatches,
+                (1u == mismatches) ? "" : "s");
+        exit_code = CALC_CRC_CLI_EXIT_FAILED;
+    }
+    if ((true == check) && (0u == _files_count))
+    {
+        fprintf(stderr, "calc-crc: no properly formatted checksum lines found\n");
+        exit_code = CALC_CRC_CLI_EXIT_FAILED;
+    }
+
+    free(_files);
+    free(_chunks);
+
+    return exit_code;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+static void _usage(FILE *stream)
+{
+    fprintf(stream,
+            "Usage: calc-crc [OPTION]... [FILE]...\n"
+            "Print CRC values of FILEs (standard input when no FILE is given or FILE is -).\n"
+            "\n"
+            "  -m, --model NAME     catalogue model name or alias (default: CRC-32, see --list)\n"
+            "  -w, --width BITS     own model: CRC width in bits (1 to 64)\n"
+            "  -p, --poly HEX       own model: polynomial (normal form)\n"
+            "  -i, --init HEX       own model: initial value (default: 0)\n"
+            "  -x, --xorout HEX     own model: final XOR value (default: 0)\n"
+            "  -r, --refin          own model: reflect input\n"
+            "  -R, --refout         own model: reflect output\n"
+            "  -j, --jobs N         number of threads (default: online CPUs)\n"
+            "  -s, --chunk BYTES    split larger files into chunks of BYTES, K/M/G suffix (default: 64M)\n"
+            "  -c, --check          read CRC values from the FILEs and check them\n"
+            "  -q, --quiet          check mode: print only failed files\n"
+            "  -f, --format FORMAT  output format: text (default) or json (one object per line)\n"
+            "  -l, --list           list catalogue models\n"
+            "  -h, --help           print this help\n");
+}
+
+static void _list(void)
+{
+    printf("%-20s %-18s %5s %16s %16s %16s %5s %6s %16s\n", "NAME", "ALIAS", "WIDTH", "POLY", "INIT", "XOROUT", "REFIN",
+           "REFOUT", "CHECK");
+    for (int m = 0; m < (int)CALC_CRC_MODEL_MAX; m++)
+    {
+        const calc_crc_model_t *info;
+
+        if (CALC_CRC_STATUS_OK != CALC_CRC_GetModel((calc_crc_model_e)m, &info))
+        {
+            continue;
+        }
+        printf("%-20s %-18s %5u %16" PRIx64 " %16" PRIx64 " %16" PRIx64 " %5s %6s %16" PRIx64 "\n", info->name,
+               (NULL != info->alias) ? info->alias : "-", info->width, info->polynomial, info->initial_value,
+               info->final_value, (true == info->input_reflected) ? "true" : "false",
+               (true == info->output_reflected) ? "true" : "false", info->check);
+    }
+}
+
+static bool _parse_number(const char *text, int base, uint64_t *value)
+{
+    char *end;
+
+    errno = 0;
+    *value = (uint64_t)strtoull(text, &end, base);
+    if ((0 != errno) || (end == text) || ('-' == text[0]))
+    {
+        return false;
+    }
+
+    // Size suffixes are accepted only for decimal/prefixed numbers (hexadecimal digits would be ambiguous)
+    if ((16 != base) && ('\0' != *end) && ('\0' == end[1]))
+    {
+        const char *suffixes = "KMG";
+        const char *suffix = strchr(suffixes, *end);
+
+        if (NULL == suffix)
+        {
+            return false;
+        }
+        for (const char *s = suffixes; s <= suffix; s++)
+        {
+            *value *= 1024u;
+        }
+        end++;
+    }
+
+    return '\0' == *end;
+}
+
+static uint64_t _value_get(calc_crc_type_e type, const calc_crc_cli_value_t *value)
+{
+    switch (type)
+    {
+    case CALC_CRC_TYPE_8BIT:
+    case CALC_CRC_TYPE_SUM8:
+    case CALC_CRC_TYPE_LRC8:
+        return value->crc8;
+    case CALC_CRC_TYPE_16BIT:
+    case CALC_CRC_TYPE_FLETCHER16:
+    case CALC_CRC_TYPE_INET16:
+        return value->crc16;
+    case CALC_CRC_TYPE_32BIT:
+    case CALC_CRC_TYPE_FLETCHER32:
+    case CALC_CRC_TYPE_ADLER32:
+        return value->crc32;
+    default:
+        return value->crc64;
+    }
+}
+
+static void _file_add(const char *path, uint64_t expected)
+{
+    struct stat info;
+    calc_crc_cli_file_t file;
+    calc_crc_cli_file_t *files = (calc_crc_cli_file_t *)realloc(_files, (_files_count + 1u) * sizeof(file));
+
+    if (NULL == files)
+    {
+        fprintf(stderr, "calc-crc: out of memory\n");
+        exit(CALC_CRC_CLI_EXIT_FAILED);
+    }
+    _files = files;
+
+    memset(&file, 0, sizeof(file));
+    file.path = path;
+    file.expected = expected;
+    file.first = _chunks_count;
+    file.regular = (0 != strcmp(path, "-")) && (0 == stat(path, &info)) && (0 != S_ISREG(info.st_mode));
+    file.size = (true == file.regular) ? (uint64_t)info.st_size : 0u;
+    file.chunks = ((true == file.regular) && (_chunk < file.size)) ? (size_t)((file.size + _chunk - 1u) / _chunk) : 1u;
+
+    calc_crc_cli_chunk_t *chunks =
+        (calc_crc_cli_chunk_t *)realloc(_chunks, (_chunks_count + file.chunks) * sizeof(calc_crc_cli_chunk_t));
+
+    if (NULL == chunks)
+    {
+        fprintf(stderr, "calc-crc: out of memory\n");
+        exit(CALC_CRC_CLI_EXIT_FAILED);
+    }
+    _chunks = chunks;
+
+    for (size_t c = 0; c < file.chunks; c++)
+    {
+        calc_crc_cli_chunk_t *chunk = &_chunks[_chunks_count + c];
+
+        memset(chunk, 0, sizeof(calc_crc_cli_chunk_t));
+        chunk->file = _files_count;
+        chunk->offset = c * _chunk;
+        chunk->length = ((file.size - chunk->offset) < _chunk) ? (file.size - chunk->offset) : _chunk;
+    }
+
+    _chunks_count += file.chunks;
+    _files[_files_count++] = file;
+}
+
+static long _manifest_read(const char *path)
+{
+    FILE *manifest = (0 == strcmp(path, "-")) ? stdin : fopen(path, "r");
+    char *line = NULL;
+    size_t capacity = 0;
+    long improper = 0;
+    ssize_t length;
+
+    if (NULL == manifest)
+    {
+        return -1;
+    }
+
+    while (0 < (length = getline(&line, &capacity, manifest)))
+    {
+        char *end;
+
+        while ((0 < length) && (('\n' == line[length - 1]) || ('\r' == line[length - 1])))
+        {
+            line[--length] = '\0';
+        }
+        if (0 == length)
+        {
+            continue;
+        }
+
+        // "<crc>  <file>" as printed in text format, "<crc> *<file>" is accepted as well
+        errno = 0;
+        uint64_t expected = (uint64_t)strtoull(line, &end, 16);
+
+        if ((0 != errno) || (end == line) || (' ' != end[0]) || ((' ' != end[1]) && ('*' != end[1])) ||
+            ('\0' == end[2]))
+        {
+            improper++;
+            continue;
+        }
+
+        char *file = strdup(&end[2]);
+
+        if (NULL == file)
+        {
+            fprintf(stderr, "calc-crc: out of memory\n");
+            exit(CALC_CRC_CLI_EXIT_FAILED);
+        }
+        _file_add(file, expected);
+    }
+
+    free(line);
+    if (stdin != manifest)
+    {
+        fclose(manifest);
+    }
+
+    return improper;
+}
+
+static void *_worker(void *arg)
+{
+    calc_crc_t crc = _crc;
+
+    (void)arg;
+
+    while (true)
+    {
+        size_t index = __atomic_fetch_add(&_chunks_next, 1u, __ATOMIC_RELAXED);
+
+        if (index >= _chunks_count)
+        {
+            break;
+        }
+        _chunk_calculate(&crc, &_chunks[index]);
+    }
+
+    return NULL;
+}
+
+static void _chunk_calculate(calc_crc_t *crc, calc_crc_cli_chunk_t *chunk)
+{
+    const calc_crc_cli_file_t *file = &_files[chunk->file];
+    calc_crc_status_e status;
+
+    // Whole files are memory mapped window by window (read through one buffer if they can not be mapped)
+    if (1u == file->chunks)
+    {
+        errno = 0;
+        status = (0 == strcmp(file->path, "-")) ? CALC_CRC_CalculateFd(crc, STDIN_FILENO, &chunk->value)
+                                                : CALC_CRC_CalculateFile(crc, file->path, &chunk->value);
+        chunk->error = (CALC_CRC_STATUS_OK != status) ? ((0 != errno) ? errno : EIO) : 0;
+        return;
+    }
+
+    // Chunks of large files are mapped on their own and combined after all chunks are calculated
+    int fd = open(file->path, O_RDONLY | O_CLOEXEC);
+    void *map = (0 <= fd) ? mmap(NULL, (size_t)chunk->length, PROT_READ, MAP_PRIVATE, fd, (off_t)chunk->offset)
+                          : MAP_FAILED;
+
+    chunk->error = (MAP_FAILED == map) ? errno : 0;
+    if (MAP_FAILED != map)
+    {
+        madvise(map, (size_t)chunk->length, MADV_SEQUENTIAL);
+        madvise(map, (size_t)chunk->length, MADV_WILLNEED);
+        status = CALC_CRC_Calculate(crc, map, (size_t)chunk->length, &chunk->value);
+        chunk->error = (CALC_CRC_STATUS_OK != status) ? EIO : 0;
+        munmap(map, (size_t)chunk->length);
+    }
+    if (0 <= fd)
+    {
+        close(fd);
+    }
+}
+
+static void _json_string(const char *text)
+{
+    putchar('"');
+    for (const unsigned char *c = (const unsigned char *)text; '\0' != *c; c++)
+    {
+        if (('"' == *c) || ('\\' == *c))
+        {
+            printf("\\%c", *c);
+        }
+        else if (0x20u > *c)
+        {
+            printf("\\u%04x", *c);
+        }
+        else
+        {
+            putchar(*c);
+        }
+    }
+    putchar('"');
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
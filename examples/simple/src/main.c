@@ -28,6 +28,7 @@ int main(void)
         .final_value = 0xFF,
         .input_reflected = false,
         .output_reflected = false,
+        .tables = &calc_crc_tables_crc8,
     };
 
     // Initialize and calculate CRC-8
@@ -42,6 +43,7 @@ int main(void)
         .final_value = 0xFFFF,
         .input_reflected = false,
         .output_reflected = false,
+        .tables = &calc_crc_tables_crc16_ccitt,
     };
 
     // Initialize and calculate CRC-16
@@ -56,6 +58,7 @@ int main(void)
         .final_value = 0xFFFFFFFF,
         .input_reflected = false,
         .output_reflected = false,
+        .tables = &calc_crc_tables_crc32_bzip2,
     };
 
     // Initialize and calculate CRC-32
@@ -70,6 +73,7 @@ int main(void)
         .final_value = 0xFFFFFFFFFFFFFFFF,
         .input_reflected = false,
         .output_reflected = false,
+        .tables = &calc_crc_tables_crc64_ecma,
     };
 
     // Initialize and calculate CRC-64
@@ -77,6 +81,12 @@ int main(void)
     CALC_CRC_Calculate(&crc, data, strlen((char *)data), &crc64_result);
     printf("CRC-64: 0x%08X%08X\n", (uint32_t)(crc64_result >> 32), (uint32_t)crc64_result);
 
+    // Initialize a standard model from the catalogue by name and calculate CRC-32C
+    calc_crc_conf_t model_conf;
+    CALC_CRC_InitName(&crc, &model_conf, "CRC-32C");
+    CALC_CRC_Calculate(&crc, data, strlen((char *)data), &crc32_result);
+    printf("CRC-32C: 0x%08X\n", crc32_result);
+
     return 0;
 }
 
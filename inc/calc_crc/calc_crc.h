@@ -35,6 +35,7 @@ extern "C" {
 #endif                     /* __has_include("calc_crc_conf.h") */
 
 #include "calc_crc/calc_crc_gtypes.h"
+#include "calc_crc/calc_crc_tables.h"
 
 // --- Public Defines --------------------------------------------------------------------------------------------------
 
@@ -55,6 +56,112 @@ extern "C" {
  */
 calc_crc_status_e CALC_CRC_Init(calc_crc_t *crc, void *conf, calc_crc_type_e type);
 
+/**
+ * @brief   Get the parameters, check value and kernel hints of a standard model from the catalogue.
+ * @param   model       Model id.
+ * @param   info        Pointer to store the pointer to the read-only catalogue entry.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_GetModel(calc_crc_model_e model, const calc_crc_model_t **info);
+
+/**
+ * @brief   Find a standard model by name or alias (case and separators '-', '/', '_', ' ' are ignored).
+ * @param   name        Model name (e.g. "CRC-16/MODBUS" or "crc32c").
+ * @param   model       Pointer to store the model id.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_FindModel(const char *name, calc_crc_model_e *model);
+
+/**
+ * @brief   Initialize a CRC instance with a standard model (configuration is filled from the catalogue, precomputed
+ *          tables of the model are used when available).
+ * @param   crc         Pointer to the CRC instance to initialize.
+ * @param   conf        Pointer to the configuration storage (must stay valid while the instance is used).
+ * @param   model       Model id.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_InitModel(calc_crc_t *crc, calc_crc_conf_t *conf, calc_crc_model_e model);
+
+/**
+ * @brief   Initialize a CRC instance with model parameters (catalogue entry or own parameters, table hint is used as
+ *          precomputed tables when set).
+ * @param   crc         Pointer to the CRC instance to initialize.
+ * @param   conf        Pointer to the configuration storage (must stay valid while the instance is used).
+ * @param   info        Pointer to the model parameters (name, alias, check and kernel hint are not used).
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_InitParams(calc_crc_t *crc, calc_crc_conf_t *conf, const calc_crc_model_t *info);
+
+/**
+ * @brief   Initialize a CRC instance with a standard model found by name (see CALC_CRC_FindModel).
+ * @param   crc         Pointer to the CRC instance to initialize.
+ * @param   conf        Pointer to the configuration storage (must stay valid while the instance is used).
+ * @param   name        Model name or alias.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_InitName(calc_crc_t *crc, calc_crc_conf_t *conf, const char *name);
+
+/**
+ * @brief   Acquire the shared immutable model of the given parameters. Models are interned, identical parameters give
+ *          the same object with its reference count incremented.
+ * @param   info        Pointer to the model parameters (e.g. from CALC_CRC_GetModel).
+ * @param   model       Pointer to store the shared model.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_SharedAcquire(const calc_crc_model_t *info, calc_crc_shared_t **model);
+
+/**
+ * @brief   Release a shared model, the model is freed when the last reference is released.
+ * @param   model       Pointer to the shared model.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_SharedRelease(calc_crc_shared_t *model);
+
+/**
+ * @brief   Calculate the CRC value for the given data with a shared model (same result as CALC_CRC_Calculate).
+ * @param   model       Pointer to the shared model.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @param   result      Pointer to store the calculated CRC value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_SharedCalculate(const calc_crc_shared_t *model, const void *data, size_t length,
+                                           void *result);
+
+/**
+ * @brief   Initialize a per-stream context using a shared model.
+ * @param   stream      Pointer to the stream context.
+ * @param   model       Pointer to the shared model (must stay acquired while the stream is used).
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_StreamInit(calc_crc_stream_t *stream, const calc_crc_shared_t *model);
+
+/**
+ * @brief   Update the CRC value of a stream with a new chunk of data.
+ * @param   stream      Pointer to the stream context.
+ * @param   data        Pointer to the new data chunk.
+ * @param   length      Length of the new data chunk.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_StreamUpdate(calc_crc_stream_t *stream, const void *data, size_t length);
+
+/**
+ * @brief   Update the CRC value of a stream with count copies of a byte in O(log count) steps.
+ * @param   stream      Pointer to the stream context.
+ * @param   byte        Value of the bytes.
+ * @param   count       Number of bytes.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_StreamUpdateFill(calc_crc_stream_t *stream, uint8_t byte, size_t count);
+
+/**
+ * @brief   Finalize the CRC computation of a stream and retrieve the result.
+ * @param   stream      Pointer to the stream context.
+ * @param   result      Pointer to store the final CRC value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_StreamFinalize(calc_crc_stream_t *stream, void *result);
+
 /**
  * @brief   Calculate the CRC value for the given data.
  * @param   crc         Pointer to the CRC instance.
@@ -65,6 +172,26 @@ calc_crc_status_e CALC_CRC_Init(calc_crc_t *crc, void *conf, calc_crc_type_e typ
  */
 calc_crc_status_e CALC_CRC_Calculate(calc_crc_t *crc, const void *data, size_t length, void *result);
 
+/**
+ * @brief   Calculate the CRC values of multiple independent buffers (same results as CALC_CRC_Calculate per buffer).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   data        Array of pointers to the data buffers.
+ * @param   length      Array of lengths of the data buffers.
+ * @param   result      Array to store calculated CRC values (element type matches the CRC type).
+ * @param   count       Number of buffers.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_CalculateBatch(calc_crc_t *crc, const void *const *data, const size_t *length, void *result,
+                                          size_t count);
+
+/**
+ * @brief   Start (or restart) a streaming calculation explicitly, finalizing it without any update gives the CRC value
+ *          of empty data.
+ * @param   crc         Pointer to the CRC instance.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_Start(calc_crc_t *crc);
+
 /**
  * @brief   Update the CRC value with a new chunk of data.
  * @param   crc         Pointer to the CRC instance.
@@ -74,6 +201,16 @@ calc_crc_status_e CALC_CRC_Calculate(calc_crc_t *crc, const void *data, size_t l
  */
 calc_crc_status_e CALC_CRC_Update(calc_crc_t *crc, const void *data, size_t length);
 
+/**
+ * @brief   Update the CRC value with count copies of a byte (zero padding, pre-allocated file tails, RLE runs) in
+ *          O(log count) steps instead of processing the bytes.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   byte        Value of the bytes.
+ * @param   count       Number of bytes.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_UpdateFill(calc_crc_t *crc, uint8_t byte, size_t count);
+
 /**
  * @brief   Finalize the CRC computation and retrieve the result.
  * @param   crc         Pointer to the CRC instance.
@@ -82,6 +219,206 @@ calc_crc_status_e CALC_CRC_Update(calc_crc_t *crc, const void *data, size_t leng
  */
 calc_crc_status_e CALC_CRC_Finalize(calc_crc_t *crc, void *result);
 
+/**
+ * @brief   Calculate one CRC value across data segments (same result as CALC_CRC_Calculate of the joined data).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   iov         Array of data segments (empty segments are allowed).
+ * @param   count       Number of data segments.
+ * @param   result      Pointer to store the calculated CRC value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_CalculateVec(calc_crc_t *crc, const calc_crc_iovec_t *iov, size_t count, void *result);
+
+/**
+ * @brief   Update the CRC value with data segments (same as CALC_CRC_Update of every segment in order).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   iov         Array of data segments (empty segments are allowed).
+ * @param   count       Number of data segments.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_UpdateVec(calc_crc_t *crc, const calc_crc_iovec_t *iov, size_t count);
+
+/**
+ * @brief   Calculate the CRC value of a large buffer on multiple threads (same result as CALC_CRC_Calculate).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @param   result      Pointer to store the calculated CRC value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_CalculateParallel(calc_crc_t *crc, const void *data, size_t length, void *result);
+
+/**
+ * @brief   Set number of threads and minimal span length used by CALC_CRC_CalculateParallel.
+ * @param   threads     Number of threads including the calling one (0 = number of online CPUs).
+ * @param   min_span    Minimal length (bytes) of data calculated by one thread.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_SetParallel(size_t threads, size_t min_span);
+
+/**
+ * @brief   Calculate the CRC value of a file (same result as CALC_CRC_Calculate over its content, CRC value of empty
+ *          data for empty files). Regular files are memory mapped window by window without copies.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   path        Path of the file.
+ * @param   result      Pointer to store the calculated CRC value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_CalculateFile(calc_crc_t *crc, const char *path, void *result);
+
+/**
+ * @brief   Calculate the CRC value of an open file from its beginning (regular files are memory mapped, other
+ *          descriptors such as pipes are read until end of file).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   fd          File descriptor opened for reading.
+ * @param   result      Pointer to store the calculated CRC value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_CalculateFd(calc_crc_t *crc, int fd, void *result);
+
+/**
+ * @brief   Set length of the file window mapped at once by CALC_CRC_CalculateFile and CALC_CRC_CalculateFd.
+ * @param   window      Window length in bytes (rounded up to the page size).
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_SetFileWindow(size_t window);
+
+/**
+ * @brief   Calculate CRC values of several files with an asynchronous read pipeline (io_uring on Linux). Several
+ *          aligned buffers per file are read ahead while completed ones are calculated, results are the same as with
+ *          CALC_CRC_CalculateFile.
+ * @param   crc         Pointer to the CRC instance (configuration of all files, instance is not changed).
+ * @param   paths       Array of file paths.
+ * @param   count       Number of files.
+ * @param   results     Array to store calculated CRC values (element type matches the CRC type).
+ * @param   status      Array to store status of every file or NULL.
+ * @return  Status code indicating success or failure (error if any file failed).
+ */
+calc_crc_status_e CALC_CRC_CalculateFiles(const calc_crc_t *crc, const char *const *paths, size_t count,
+                                          void *results, calc_crc_status_e *status);
+
+/**
+ * @brief   Combine CRC values of two consecutive data blocks into the CRC value of the joined data (O(log length_b)).
+ * @param   crc         Pointer to the CRC instance (configuration used for both blocks).
+ * @param   crc_a       Pointer to the CRC value of the first block.
+ * @param   crc_b       Pointer to the CRC value of the second block.
+ * @param   length_b    Length of the second block in bytes.
+ * @param   result      Pointer to store the CRC value of the first block followed by the second block.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_Combine(calc_crc_t *crc, const void *crc_a, const void *crc_b, size_t length_b,
+                                   void *result);
+
+/**
+ * @brief   Adjust an Internet checksum after a field of the data changed, without reading the rest of the data
+ *          (RFC 1624, HC' = ~(~HC + ~m + m')). Only for CALC_CRC_TYPE_INET16 instances.
+ * @param   crc         Pointer to the checksum instance.
+ * @param   value       Pointer to the checksum value (uint16_t) of the data before the change.
+ * @param   offset      Offset of the field in the checksummed data (odd offsets are supported).
+ * @param   old_data    Pointer to the field contents before the change.
+ * @param   new_data    Pointer to the field contents after the change.
+ * @param   length      Length of the field in bytes.
+ * @param   result      Pointer to store the checksum value (uint16_t) of the changed data, may be equal to value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_Adjust(const calc_crc_t *crc, const void *value, size_t offset, const void *old_data,
+                                  const void *new_data, size_t length, void *result);
+
+/**
+ * @brief   Update the CRC or checksum value of data after a byte range of it was modified, without reading the rest of
+ *          the data (O(patch_length + log length)). Works for every type, Internet checksums as CALC_CRC_Adjust.
+ * @param   crc         Pointer to the CRC instance (configuration the value was calculated with).
+ * @param   value       Pointer to the CRC value of the data before the change.
+ * @param   length      Length of the whole data in bytes.
+ * @param   offset      Offset of the modified range.
+ * @param   old_data    Pointer to the range contents before the change.
+ * @param   new_data    Pointer to the range contents after the change.
+ * @param   patch_length Length of the modified range in bytes.
+ * @param   result      Pointer to store the CRC value of the modified data, may be equal to value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_Patch(const calc_crc_t *crc, const void *value, size_t length, size_t offset,
+                                 const void *old_data, const void *new_data, size_t patch_length, void *result);
+
+/**
+ * @brief   Extend a CRC value of data over count copies of a byte (e.g. zero padding) in O(log count) steps.
+ * @param   crc         Pointer to the CRC instance (configuration the value was calculated with).
+ * @param   value       Pointer to the CRC value of the data (checksums: length of the data a multiple of the word).
+ * @param   byte        Value of the appended bytes.
+ * @param   count       Number of appended bytes.
+ * @param   result      Pointer to store the CRC value of the data followed by the bytes, may be equal to value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_ExtendFill(calc_crc_t *crc, const void *value, uint8_t byte, size_t count, void *result);
+
+/**
+ * @brief   Initialize a rolling CRC over a fixed window, tables for incoming and outgoing bytes are generated so that
+ *          sliding the window by one byte costs two lookups (CRC types only).
+ * @param   rolling     Pointer to the rolling CRC.
+ * @param   crc         Pointer to the CRC instance (must stay initialized while the rolling CRC is used).
+ * @param   window      Length of the window in bytes.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_RollingInit(calc_crc_rolling_t *rolling, const calc_crc_t *crc, size_t window);
+
+/**
+ * @brief   Start the rolling CRC with the first window.
+ * @param   rolling     Pointer to the rolling CRC.
+ * @param   data        Pointer to the first window bytes (window length).
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_RollingStart(calc_crc_rolling_t *rolling, const void *data);
+
+/**
+ * @brief   Slide the window of the rolling CRC by one byte.
+ * @param   rolling     Pointer to the rolling CRC.
+ * @param   out         Byte leaving the window (oldest byte of the window).
+ * @param   in          Byte entering the window.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_RollingRoll(calc_crc_rolling_t *rolling, uint8_t out, uint8_t in);
+
+/**
+ * @brief   Get the CRC value of the current window (same as CALC_CRC_Calculate of the window bytes).
+ * @param   rolling     Pointer to the rolling CRC.
+ * @param   result      Pointer to store the CRC value.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_RollingGet(const calc_crc_rolling_t *rolling, void *result);
+
+/**
+ * @brief   Find the windows of data whose CRC value matches a mask (content-defined chunk boundaries, frame resync).
+ *          Reports end offsets p of windows data[p - window, p) with (CRC value & mask) == match in increasing order,
+ *          a full positions array stops the scan, it resumes at data + positions[found - 1] - window + 1.
+ * @param   rolling     Pointer to the rolling CRC (current window is not changed).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (shorter than window = nothing found).
+ * @param   mask        Mask of the compared CRC value bits.
+ * @param   match       Value of the compared bits.
+ * @param   positions   Array to store the end offsets.
+ * @param   capacity    Number of entries of the positions array.
+ * @param   found       Pointer to store the number of stored end offsets.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_RollingScan(const calc_crc_rolling_t *rolling, const void *data, size_t length,
+                                       uint64_t mask, uint64_t match, size_t *positions, size_t capacity,
+                                       size_t *found);
+
+/**
+ * @brief   Force the highest kernel tier used by instances initialized afterwards (overrides CALC_CRC_KERNEL_ENV).
+ * @param   kernel      Kernel tier, CALC_CRC_KERNEL_AUTO selects the best supported one.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_SetKernel(calc_crc_kernel_e kernel);
+
+/**
+ * @brief   Get the kernel tier bound to the CRC instance at init.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   kernel      Pointer to store the kernel tier.
+ * @return  Status code indicating success or failure.
+ */
+calc_crc_status_e CALC_CRC_GetKernel(const calc_crc_t *crc, calc_crc_kernel_e *kernel);
+
 // C++ wrapper - End
 #ifdef __cplusplus
 }
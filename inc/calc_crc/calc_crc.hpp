@@ -0,0 +1,242 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc.hpp
+ * @brief       Header-only C++17 templates of the CALC-CRC component. Model (width, polynomial, initial and final
+ *              value, reflection) is a template parameter, lookup table is generated at compile time and all
+ *              calculation functions are constexpr, so CRC of string literals can be calculated by the compiler.
+ *              Results are the same as with CALC_CRC_Calculate for the same configuration.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-06
+ *
+ **********************************************************************************************************************/
+
+#ifndef CALC_CRC_HPP
+#define CALC_CRC_HPP
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace calc_crc
+{
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief   Register type of the CRC width (same as configuration types of the C API).
+ */
+template <uint8_t Width> struct register_type;
+template <> struct register_type<8>
+{
+    using type = uint8_t;
+};
+template <> struct register_type<16>
+{
+    using type = uint16_t;
+};
+template <> struct register_type<32>
+{
+    using type = uint32_t;
+};
+template <> struct register_type<64>
+{
+    using type = uint64_t;
+};
+
+/**
+ * @brief   Reflect the bits in a value of the register type.
+ * @param   data        Value to reflect.
+ * @return  Reflected value.
+ */
+template <typename T> constexpr T reflect(T data) noexcept
+{
+    T result = 0;
+
+    for (std::size_t bit = 0; bit < (sizeof(T) * 8u); bit++)
+    {
+        result = static_cast<T>((result << 1) | ((data >> bit) & 1u));
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   CRC model with compile-time lookup table.
+ * @tparam  Width           CRC width in bits (8, 16, 32 or 64).
+ * @tparam  Polynomial      CRC polynomial used for calculation.
+ * @tparam  Initial         Initial value for CRC computation.
+ * @tparam  Final           Final XOR value for CRC computation.
+ * @tparam  InputReflected  Reflect input data.
+ * @tparam  OutputReflected Reflect output CRC.
+ */
+template <uint8_t Width, uint64_t Polynomial, uint64_t Initial, uint64_t Final, bool InputReflected,
+          bool OutputReflected>
+class crc
+{
+  public:
+    static_assert((8u == Width) || (16u == Width) || (32u == Width) || (64u == Width), "Unsupported CRC width.");
+
+    using value_type = typename detail::register_type<Width>::type;
+
+    static constexpr uint8_t width = Width;
+    static constexpr value_type polynomial = static_cast<value_type>(Polynomial);
+    static constexpr value_type initial_value = static_cast<value_type>(Initial);
+    static constexpr value_type final_value = static_cast<value_type>(Final);
+    static constexpr bool input_reflected = InputReflected;
+    static constexpr bool output_reflected = OutputReflected;
+
+    /**
+     * @brief   Lookup table, same as generated by CALC_CRC_Init (right-shifting for reflected input).
+     */
+    static constexpr std::array<value_type, 256> table = []() constexpr
+    {
+        std::array<value_type, 256> result{};
+        constexpr value_type top = static_cast<value_type>(value_type(1) << (Width - 1u));
+        constexpr value_type poly = InputReflected ? detail::reflect(polynomial) : polynomial;
+
+        for (std::size_t dividend = 0; dividend < 256u; dividend++)
+        {
+            value_type reg = InputReflected ? static_cast<value_type>(dividend)
+                                            : static_cast<value_type>(static_cast<uint64_t>(dividend) << (Width - 8u));
+
+            for (uint8_t bit = 0; bit < 8u; bit++)
+            {
+                if (InputReflected)
+                {
+                    reg = static_cast<value_type>((0u != (reg & 1u)) ? ((reg >> 1) ^ poly) : (reg >> 1));
+                }
+                else
+                {
+                    reg = static_cast<value_type>((0u != (reg & top)) ? ((reg << 1) ^ poly) : (reg << 1));
+                }
+            }
+
+            result[dividend] = reg;
+        }
+
+        return result;
+    }();
+
+    /**
+     * @brief   Start a streaming calculation.
+     * @return  Register value before any data.
+     */
+    static constexpr value_type init() noexcept
+    {
+        return InputReflected ? detail::reflect(initial_value) : initial_value;
+    }
+
+    /**
+     * @brief   Process a chunk of data through the register.
+     * @param   reg         Register value (from init or previous update).
+     * @param   data        Pointer to the data chunk.
+     * @param   length      Length of the data chunk.
+     * @return  Updated register value.
+     */
+    static constexpr value_type update(value_type reg, const uint8_t *data, std::size_t length) noexcept
+    {
+        for (std::size_t i = 0; i < length; i++)
+        {
+            reg = step(reg, data[i]);
+        }
+
+        return reg;
+    }
+
+    /**
+     * @brief   Process a chunk of characters through the register.
+     * @param   reg         Register value (from init or previous update).
+     * @param   text        Characters of the data chunk.
+     * @return  Updated register value.
+     */
+    static constexpr value_type update(value_type reg, std::string_view text) noexcept
+    {
+        for (char ch : text)
+        {
+            reg = step(reg, static_cast<uint8_t>(ch));
+        }
+
+        return reg;
+    }
+
+    /**
+     * @brief   Finish a streaming calculation.
+     * @param   reg         Register value after the last update.
+     * @return  CRC value.
+     */
+    static constexpr value_type finalize(value_type reg) noexcept
+    {
+        value_type result = static_cast<value_type>((InputReflected ? detail::reflect(reg) : reg) ^ final_value);
+
+        return OutputReflected ? detail::reflect(result) : result;
+    }
+
+    /**
+     * @brief   Calculate the CRC value for the given data.
+     * @param   data        Pointer to the data buffer.
+     * @param   length      Length of the data buffer.
+     * @return  CRC value.
+     */
+    static constexpr value_type calculate(const uint8_t *data, std::size_t length) noexcept
+    {
+        return finalize(update(init(), data, length));
+    }
+
+    /**
+     * @brief   Calculate the CRC value for the given characters (string literal without terminating zero).
+     * @param   text        Characters of the data buffer.
+     * @return  CRC value.
+     */
+    static constexpr value_type calculate(std::string_view text) noexcept
+    {
+        return finalize(update(init(), text));
+    }
+
+  private:
+    /**
+     * @brief   Process one byte through the register with the lookup table.
+     * @param   reg         Register value.
+     * @param   byte        Data byte.
+     * @return  Updated register value.
+     */
+    static constexpr value_type step(value_type reg, uint8_t byte) noexcept
+    {
+        if constexpr (InputReflected)
+        {
+            return static_cast<value_type>((reg >> 8) ^ table[static_cast<uint8_t>(reg ^ byte)]);
+        }
+        else
+        {
+            return static_cast<value_type>((reg << 8) ^ table[static_cast<uint8_t>((reg >> (Width - 8u)) ^ byte)]);
+        }
+    }
+};
+
+// --- Public Defines --------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frequently used models.
+ */
+using crc8 = crc<8, 0x07, 0x00, 0x00, false, false>;                              // CRC-8/SMBUS
+using crc16_ccitt_false = crc<16, 0x1021, 0xFFFF, 0x0000, false, false>;          // CRC-16/IBM-3740
+using crc16_arc = crc<16, 0x8005, 0x0000, 0x0000, true, true>;                    // CRC-16/ARC
+using crc32 = crc<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true, true>;            // CRC-32/ISO-HDLC
+using crc32c = crc<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true, true>;           // CRC-32/ISCSI
+using crc64_xz = crc<64, 0x42F0E1EBA9EA3693, UINT64_MAX, UINT64_MAX, true, true>; // CRC-64/XZ
+
+} // namespace calc_crc
+
+#endif /* CALC_CRC_HPP */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -22,6 +22,10 @@ extern "C" {
 #include <stdint.h>
 #include <stddef.h>
 
+#if __has_include("calc_crc_conf.h")
+#include "calc_crc_conf.h" // IWYU pragma: keep
+#endif                     /* __has_include("calc_crc_conf.h") */
+
 // --- Public Defines --------------------------------------------------------------------------------------------------
 
 #define CALC_CRC_8BIT_POLYNOMIAL  ((uint8_t)0x07)                // Default polynomial for 8-bit CRC calculation.
@@ -29,6 +33,46 @@ extern "C" {
 #define CALC_CRC_32BIT_POLYNOMIAL ((uint32_t)0x04C11DB7)         // Default polynomial for 32-bit CRC calculation.
 #define CALC_CRC_64BIT_POLYNOMIAL ((uint64_t)0x42F0E1EBA9EA3693) // Default polynomial for 64-bit CRC calculation.
 
+/**
+ * @brief   Number of entries required for the slicing table storage (slice_table) of the given slicing step.
+ */
+#define CALC_CRC_SLICE_TABLE_SIZE(slices) ((size_t)((slices) - 1u) * 256u)
+
+/**
+ * @brief   Number of carry-less multiply folding constants stored in each configuration.
+ */
+#define CALC_CRC_FOLD_CONSTANTS (8u)
+
+/**
+ * @brief   Environment variable used to force the kernel tier (auto, generic, slicing, sse42, pclmul, sse2 or avx2).
+ */
+#define CALC_CRC_KERNEL_ENV "CALC_CRC_KERNEL"
+
+/**
+ * @brief   Engines processing data through the register (configuration field engine, CALC_CRC_CONF_ENGINE).
+ */
+#define CALC_CRC_ENGINE_TABLE   (0u) // 256-entry lookup table (slicing tables and hardware kernels can be used).
+#define CALC_CRC_ENGINE_NIBBLE  (1u) // 16-entry lookup table, two lookups per byte.
+#define CALC_CRC_ENGINE_BITWISE (2u) // No lookup table, eight shift/XOR steps per byte.
+#define CALC_CRC_ENGINE_MAX     (3u) // Maximum number of engines.
+
+/**
+ * @brief   Number of entries of the lookup table stored in each configuration. When the engine of all instances is
+ *          fixed at compile time with CALC_CRC_CONF_ENGINE, the configurations only hold what the engine needs.
+ */
+#if defined(CALC_CRC_CONF_ENGINE) && (CALC_CRC_ENGINE_NIBBLE == CALC_CRC_CONF_ENGINE)
+#define CALC_CRC_TABLE_ENTRIES (16u)
+#elif defined(CALC_CRC_CONF_ENGINE) && (CALC_CRC_ENGINE_BITWISE == CALC_CRC_CONF_ENGINE)
+#define CALC_CRC_TABLE_ENTRIES (1u)
+#else
+#define CALC_CRC_TABLE_ENTRIES (256u)
+#endif
+
+/**
+ * @brief   Number of entries of the tables of a rolling CRC (byte-wise, independent of the engine).
+ */
+#define CALC_CRC_ROLLING_ENTRIES (256u)
+
 // --- Public Types Prototypes -----------------------------------------------------------------------------------------
 
 /**
@@ -36,13 +80,78 @@ extern "C" {
  */
 typedef enum
 {
-    CALC_CRC_TYPE_8BIT = 0u, // 8-bit CRC calculation.
-    CALC_CRC_TYPE_16BIT,     // 16-bit CRC calculation.
-    CALC_CRC_TYPE_32BIT,     // 32-bit CRC calculation.
-    CALC_CRC_TYPE_64BIT,     // 64-bit CRC calculation.
-    CALC_CRC_TYPE_MAX        // Maximum number of supported CRC types.
+    CALC_CRC_TYPE_8BIT = 0u,  // 8-bit CRC calculation.
+    CALC_CRC_TYPE_16BIT,      // 16-bit CRC calculation.
+    CALC_CRC_TYPE_32BIT,      // 32-bit CRC calculation.
+    CALC_CRC_TYPE_64BIT,      // 64-bit CRC calculation.
+    CALC_CRC_TYPE_SUM8,       // 8-bit sum of bytes (modulo 256).
+    CALC_CRC_TYPE_LRC8,       // 8-bit longitudinal redundancy check (two's complement of the sum, ISO 1155).
+    CALC_CRC_TYPE_FLETCHER16, // Fletcher-16 (bytes, modulo 255).
+    CALC_CRC_TYPE_FLETCHER32, // Fletcher-32 (16-bit little-endian words, modulo 65535).
+    CALC_CRC_TYPE_FLETCHER64, // Fletcher-64 (32-bit little-endian words, modulo 4294967295).
+    CALC_CRC_TYPE_ADLER32,    // Adler-32 (bytes, modulo 65521, RFC 1950).
+    CALC_CRC_TYPE_INET16,     // Internet checksum (ones' complement sum of 16-bit big-endian words, RFC 1071).
+    CALC_CRC_TYPE_MAX         // Maximum number of supported CRC types.
 } calc_crc_type_e;
 
+/**
+ * @brief   Enumeration representing the kernel tiers used for CRC calculation.
+ */
+typedef enum
+{
+    CALC_CRC_KERNEL_AUTO = 0u, // Best kernel supported by CPU and configuration.
+    CALC_CRC_KERNEL_GENERIC,   // Byte-wise lookup table.
+    CALC_CRC_KERNEL_SLICING,   // Slicing tables (configuration slices and slice_table required).
+    CALC_CRC_KERNEL_SSE42,     // SSE4.2 CRC32 instruction (reflected CRC-32C only).
+    CALC_CRC_KERNEL_PCLMUL,    // Carry-less multiply folding.
+    CALC_CRC_KERNEL_SSE2,      // SSE2 checksum kernels (checksum types only).
+    CALC_CRC_KERNEL_AVX2,      // AVX2 checksum kernels (checksum types only).
+    CALC_CRC_KERNEL_MAX        // Maximum number of kernel tiers.
+} calc_crc_kernel_e;
+
+/**
+ * @brief   Enumeration representing the standard CRC models of the catalogue (names as in the CRC RevEng catalogue).
+ */
+typedef enum
+{
+    CALC_CRC_MODEL_CRC8_SMBUS = 0u, // CRC-8/SMBUS (CRC-8).
+    CALC_CRC_MODEL_CRC8_I_432_1,    // CRC-8/I-432-1 (CRC-8/ITU).
+    CALC_CRC_MODEL_CRC8_AUTOSAR,    // CRC-8/AUTOSAR.
+    CALC_CRC_MODEL_CRC8_MAXIM_DOW,  // CRC-8/MAXIM-DOW (CRC-8/MAXIM, DOW-CRC).
+    CALC_CRC_MODEL_CRC16_IBM_3740,  // CRC-16/IBM-3740 (CRC-16/CCITT-FALSE).
+    CALC_CRC_MODEL_CRC16_XMODEM,    // CRC-16/XMODEM.
+    CALC_CRC_MODEL_CRC16_KERMIT,    // CRC-16/KERMIT (CRC-16/CCITT).
+    CALC_CRC_MODEL_CRC16_IBM_SDLC,  // CRC-16/IBM-SDLC (CRC-16/X-25).
+    CALC_CRC_MODEL_CRC16_ARC,       // CRC-16/ARC.
+    CALC_CRC_MODEL_CRC16_MODBUS,    // CRC-16/MODBUS.
+    CALC_CRC_MODEL_CRC16_USB,       // CRC-16/USB.
+    CALC_CRC_MODEL_CRC32_ISO_HDLC,  // CRC-32/ISO-HDLC (CRC-32).
+    CALC_CRC_MODEL_CRC32_BZIP2,     // CRC-32/BZIP2.
+    CALC_CRC_MODEL_CRC32_MPEG_2,    // CRC-32/MPEG-2.
+    CALC_CRC_MODEL_CRC32_JAMCRC,    // CRC-32/JAMCRC.
+    CALC_CRC_MODEL_CRC32_ISCSI,     // CRC-32/ISCSI (CRC-32C).
+    CALC_CRC_MODEL_CRC64_XZ,        // CRC-64/XZ.
+    CALC_CRC_MODEL_CRC64_ECMA_182,  // CRC-64/ECMA-182 (CRC-64/ECMA).
+    CALC_CRC_MODEL_CRC64_WE,        // CRC-64/WE.
+    CALC_CRC_MODEL_CRC64_GO_ISO,    // CRC-64/GO-ISO.
+    CALC_CRC_MODEL_CRC5_USB,        // CRC-5/USB.
+    CALC_CRC_MODEL_CRC11_FLEXRAY,   // CRC-11/FLEXRAY.
+    CALC_CRC_MODEL_CRC15_CAN,       // CRC-15/CAN.
+    CALC_CRC_MODEL_CRC17_CAN_FD,    // CRC-17/CAN-FD.
+    CALC_CRC_MODEL_CRC21_CAN_FD,    // CRC-21/CAN-FD.
+    CALC_CRC_MODEL_CRC24_OPENPGP,   // CRC-24/OPENPGP.
+    CALC_CRC_MODEL_CRC31_PHILIPS,   // CRC-31/PHILIPS.
+    CALC_CRC_MODEL_CRC40_GSM,       // CRC-40/GSM.
+    CALC_CRC_MODEL_SUM8,            // SUM-8 (checksum).
+    CALC_CRC_MODEL_LRC8,            // LRC-8 (checksum, LRC).
+    CALC_CRC_MODEL_FLETCHER16,      // FLETCHER-16 (checksum).
+    CALC_CRC_MODEL_FLETCHER32,      // FLETCHER-32 (checksum).
+    CALC_CRC_MODEL_FLETCHER64,      // FLETCHER-64 (checksum).
+    CALC_CRC_MODEL_ADLER32,         // ADLER-32 (checksum, Adler-32 of zlib).
+    CALC_CRC_MODEL_INTERNET16,      // INTERNET-16 (checksum, INET, RFC 1071 of IP, TCP and UDP headers).
+    CALC_CRC_MODEL_MAX              // Maximum number of catalogue models.
+} calc_crc_model_e;
+
 /**
  * @brief   Enumeration representing the response status of a function.
  */
@@ -56,71 +165,240 @@ typedef enum
     CALC_CRC_STATUS_MAX                       // Maximum number of status types.
 } calc_crc_status_e;
 
+/**
+ * @brief   Structure representing precomputed read-only 8-bit CRC tables (see calc_crc_tables.h).
+ */
+typedef struct
+{
+    uint8_t polynomial;         // Polynomial the tables were generated for.
+    bool reflected;             // Tables were generated for reflected (LSB-first) input.
+    uint8_t slices;             // Slicing step of slice_table (0 = no slicing rows).
+    const uint8_t *table;       // Lookup table (256 entries).
+    const uint8_t *slice_table; // Slicing table rows (CALC_CRC_SLICE_TABLE_SIZE(slices) entries) or NULL.
+    uint64_t fold_constants[CALC_CRC_FOLD_CONSTANTS]; // Carry-less multiply folding constants.
+} calc_crc_8bit_tables_t;
+
 /**
  * @brief   Structure representing an 8-bit CRC configuration.
  */
 typedef struct
 {
-    uint8_t table[256];    // Precomputed CRC lookup table.
+    uint8_t table[CALC_CRC_TABLE_ENTRIES]; // Precomputed CRC lookup table (nibble engine uses 16 entries).
     uint8_t polynomial;    // CRC polynomial used for calculation.
     uint8_t initial_value; // Initial value for CRC computation.
     uint8_t final_value;   // Final XOR value for CRC computation.
     bool input_reflected;  // Reflect input data (true = enabled, false = disabled).
     bool output_reflected; // Reflect output CRC (true = enabled, false = disabled).
+    uint8_t slices;        // Bytes processed per step with slicing tables (0/1 = disabled, 4, 8 or 16).
+    uint8_t *slice_table;  // Storage for additional slicing table rows (CALC_CRC_SLICE_TABLE_SIZE entries).
+    uint64_t fold_constants[CALC_CRC_FOLD_CONSTANTS]; // Carry-less multiply folding constants (set at init).
+    const calc_crc_8bit_tables_t *tables; // Precomputed read-only tables (NULL = generate tables at init).
+    uint8_t engine;        // Engine (CALC_CRC_ENGINE_*, ignored when fixed with CALC_CRC_CONF_ENGINE).
+    uint8_t width;         // CRC width in bits (0 = type width, narrower CRCs use right-aligned parameters).
 } calc_crc_8bit_t;
 
+/**
+ * @brief   Structure representing precomputed read-only CALC-CRC 16-bit tables.
+ */
+typedef struct
+{
+    uint16_t polynomial;
+    bool reflected;
+    uint8_t slices;
+    const uint16_t *table;
+    const uint16_t *slice_table;
+    uint64_t fold_constants[CALC_CRC_FOLD_CONSTANTS];
+} calc_crc_16bit_tables_t;
+
 /**
  * @brief   Structure representing a CALC-CRC 16-bit configurations.
  */
 typedef struct
 {
-    uint16_t table[256];
+    uint16_t table[CALC_CRC_TABLE_ENTRIES];
     uint16_t polynomial;
     uint16_t initial_value;
     uint16_t final_value;
     bool input_reflected;
     bool output_reflected;
+    uint8_t slices;
+    uint16_t *slice_table;
+    uint64_t fold_constants[CALC_CRC_FOLD_CONSTANTS];
+    const calc_crc_16bit_tables_t *tables;
+    uint8_t engine;
+    uint8_t width;
 } calc_crc_16bit_t;
 
+/**
+ * @brief   Structure representing precomputed read-only CALC-CRC 32-bit tables.
+ */
+typedef struct
+{
+    uint32_t polynomial;
+    bool reflected;
+    uint8_t slices;
+    const uint32_t *table;
+    const uint32_t *slice_table;
+    uint64_t fold_constants[CALC_CRC_FOLD_CONSTANTS];
+} calc_crc_32bit_tables_t;
+
 /**
  * @brief   Structure representing a CALC-CRC 32-bit configurations.
  */
 typedef struct
 {
-    uint32_t table[256];
+    uint32_t table[CALC_CRC_TABLE_ENTRIES];
     uint32_t polynomial;
     uint32_t initial_value;
     uint32_t final_value;
     bool input_reflected;
     bool output_reflected;
+    uint8_t slices;
+    uint32_t *slice_table;
+    uint64_t fold_constants[CALC_CRC_FOLD_CONSTANTS];
+    const calc_crc_32bit_tables_t *tables;
+    uint8_t engine;
+    uint8_t width;
 } calc_crc_32bit_t;
 
+/**
+ * @brief   Structure representing precomputed read-only CALC-CRC 64-bit tables.
+ */
+typedef struct
+{
+    uint64_t polynomial;
+    bool reflected;
+    uint8_t slices;
+    const uint64_t *table;
+    const uint64_t *slice_table;
+    uint64_t fold_constants[CALC_CRC_FOLD_CONSTANTS];
+} calc_crc_64bit_tables_t;
+
 /**
  * @brief   Structure representing a CALC-CRC 64-bit configurations.
  */
 typedef struct
 {
-    uint64_t table[256];
+    uint64_t table[CALC_CRC_TABLE_ENTRIES];
     uint64_t polynomial;
     uint64_t initial_value;
     uint64_t final_value;
     bool input_reflected;
     bool output_reflected;
+    uint8_t slices;
+    uint64_t *slice_table;
+    uint64_t fold_constants[CALC_CRC_FOLD_CONSTANTS];
+    const calc_crc_64bit_tables_t *tables;
+    uint8_t engine;
+    uint8_t width;
 } calc_crc_64bit_t;
 
+/**
+ * @brief   Structure representing a checksum configuration (all checksum types).
+ */
+typedef struct
+{
+    uint64_t initial_value; // Initial sums (sum B in the upper half, sum A in the lower half, e.g. 1 for Adler-32;
+                            // Internet checksum: ones' complement sum of a pseudo-header or 0).
+} calc_crc_checksum_t;
+
+/**
+ * @brief   Union of all configuration types, storage for a configuration filled from the model catalogue.
+ */
+typedef union
+{
+    calc_crc_8bit_t conf_8bit;         // 8-bit CRC configuration.
+    calc_crc_16bit_t conf_16bit;       // 16-bit CRC configuration.
+    calc_crc_32bit_t conf_32bit;       // 32-bit CRC configuration.
+    calc_crc_64bit_t conf_64bit;       // 64-bit CRC configuration.
+    calc_crc_checksum_t conf_checksum; // Checksum configuration.
+} calc_crc_conf_t;
+
+/**
+ * @brief   Structure representing a standard CRC model of the catalogue.
+ */
+typedef struct
+{
+    const char *name;         // Model name (e.g. "CRC-32/ISO-HDLC").
+    const char *alias;        // Common alternative name (e.g. "CRC-32") or NULL.
+    calc_crc_type_e type;     // Type of CRC calculation (register container or checksum type).
+    uint8_t width;            // CRC width in bits (1 up to the type width).
+    uint64_t polynomial;      // CRC polynomial used for calculation.
+    uint64_t initial_value;   // Initial value for CRC computation.
+    uint64_t final_value;     // Final XOR value for CRC computation.
+    bool input_reflected;     // Reflect input data.
+    bool output_reflected;    // Reflect output CRC.
+    uint64_t check;           // CRC value of the ASCII string "123456789".
+    calc_crc_kernel_e kernel; // Kernel hint, fastest tier fitting the model (SSE42 for CRC-32C).
+    const void *tables;       // Table hint, precomputed read-only tables of the polynomial or NULL.
+} calc_crc_model_t;
+
+/**
+ * @brief   Structure representing one data segment of a vectored calculation (same layout as POSIX struct iovec).
+ */
+typedef struct
+{
+    const void *base; // Pointer to the segment data (may be NULL if length is 0).
+    size_t length;    // Length of the segment in bytes (0 = empty segment, skipped).
+} calc_crc_iovec_t;
+
 /**
  * @brief   Structure representing a CRC computation object.
  */
 typedef struct
 {
-    void *conf;                // Pointer to the CRC configuration settings.
-    uint64_t update_crc;       // Intermediate CRC value during updates.
-    uint64_t update_crc_final; // Final CRC value after all updates.
-    size_t update_chunk;       // Size of the current data chunk being processed.
-    calc_crc_type_e type;      // Type of CRC calculation (e.g., CRC-8, CRC-16).
-    bool update_in_progress;   // Flag indicating if a CRC update is in progress.
+    void *conf;                     // Pointer to the CRC configuration settings.
+    uint64_t update_crc;            // Raw register during updates (finalized only by CALC_CRC_Finalize).
+    size_t update_chunk;            // Size of the current data chunk being processed.
+    calc_crc_type_e type;           // Type of CRC calculation (e.g., CRC-8, CRC-16).
+    bool update_in_progress;        // Flag indicating if a CRC update is in progress.
+    bool reflected_table;           // Lookup table was generated for reflected (LSB-first) input.
+    uint8_t slices;                 // Bytes processed per step with slicing tables (1 = byte-wise table).
+    calc_crc_kernel_e kernel;       // Kernel tier bound at init.
+    uint8_t engine;                 // Engine bound at init (CALC_CRC_ENGINE_*).
+    uint8_t shift;                  // Left alignment of a narrower CRC in the register (type width - CRC width).
+    const void *table;              // Lookup table in use (configuration or precomputed tables).
+    const void *slice_table;        // Slicing table rows in use.
+    const uint64_t *fold_constants; // Carry-less multiply folding constants in use.
+    uint32_t update_tail;           // Bytes of an incomplete checksum word carried between updates (little-endian).
+    uint8_t update_tail_length;     // Number of bytes in update_tail.
 } calc_crc_t;
 
+/**
+ * @brief   Immutable reference-counted model (parameters, tables and bound kernel) shared by streams, see
+ *          CALC_CRC_SharedAcquire. Models with identical parameters are interned into one object.
+ */
+typedef struct calc_crc_shared calc_crc_shared_t;
+
+/**
+ * @brief   Structure representing a per-stream CRC context using a shared model.
+ */
+typedef struct
+{
+    const calc_crc_shared_t *model; // Shared model used by the stream (must stay acquired while the stream is used).
+    uint64_t update_crc;            // Raw register during updates (finalized only by CALC_CRC_Finalize).
+    size_t update_chunk;            // Number of chunks processed.
+    bool update_in_progress;        // Flag indicating if a CRC update is in progress.
+    uint32_t update_tail;           // Bytes of an incomplete checksum word carried between updates (little-endian).
+    uint8_t update_tail_length;     // Number of bytes in update_tail.
+} calc_crc_stream_t;
+
+/**
+ * @brief   Structure representing a rolling CRC over a fixed window of the last bytes (see CALC_CRC_RollingInit).
+ */
+typedef struct
+{
+    const calc_crc_t *crc;                        // CRC instance the window is calculated with.
+    size_t window;                                // Length of the window in bytes.
+    uint64_t reg;                                 // Raw register of the current window.
+    uint64_t mask;                                // Mask of the register bits (width of the instance type).
+    uint8_t bits;                                 // Width of the instance type in bits.
+    bool reflected;                               // Register is shifted right (reflected table).
+    bool started;                                 // Flag indicating if the first window was processed.
+    uint64_t table[CALC_CRC_ROLLING_ENTRIES];     // Incoming byte table (one byte from a zero register).
+    uint64_t out_table[CALC_CRC_ROLLING_ENTRIES]; // Outgoing byte table (byte leaving the window removed).
+} calc_crc_rolling_t;
+
 // C++ wrapper - End
 #ifdef __cplusplus
 }
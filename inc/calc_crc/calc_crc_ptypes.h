@@ -78,30 +78,6 @@ extern "C" {
         return action;                                                                                                 \
     }
 
-/**
- * @brief   Macro to update the intermediate CRC value.
- */
-#define UPDATE_CRC() crc->update_crc = (uint64_t)result;
-
-/**
- * @brief   Macro to update the final CRC value.
- */
-#define UPDATE_FINAL() crc->update_crc_final = (uint64_t)result;
-
-/**
- * @brief   Macro to start or continue a CRC update process.
- *          If an update is in progress, it processes the next chunk of data.
- */
-#define UPDATE_START()                                                                                                 \
-    if (true == crc->update_in_progress)                                                                               \
-    {                                                                                                                  \
-        if (0 != crc->update_chunk)                                                                                    \
-        {                                                                                                              \
-            result = (uint8_t)crc->update_crc;                                                                         \
-        }                                                                                                              \
-        crc->update_chunk++;                                                                                           \
-    }
-
 // C++ wrapper - End
 #ifdef __cplusplus
 }
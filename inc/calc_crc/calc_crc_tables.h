@@ -0,0 +1,45 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc_tables.h
+ * @brief       Precomputed read-only lookup tables (and folding constants) of frequently used CRC polynomials. Pass
+ *              one of the bundles through the configuration field tables to skip table generation in CALC_CRC_Init
+ *              and keep the tables in flash/.rodata instead of RAM.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-06
+ * @version     1.0.0
+ *
+ **********************************************************************************************************************/
+
+#ifndef CALC_CRC_TABLES_H
+#define CALC_CRC_TABLES_H
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include "calc_crc/calc_crc_gtypes.h"
+
+// --- Public Variables ------------------------------------------------------------------------------------------------
+
+extern const calc_crc_8bit_tables_t calc_crc_tables_crc8;          // 0x07, MSB-first
+extern const calc_crc_16bit_tables_t calc_crc_tables_crc16_ccitt;  // 0x1021, MSB-first
+extern const calc_crc_16bit_tables_t calc_crc_tables_crc16_kermit; // 0x1021, LSB-first
+extern const calc_crc_16bit_tables_t calc_crc_tables_crc16_arc;    // 0x8005, LSB-first
+extern const calc_crc_32bit_tables_t calc_crc_tables_crc32;        // 0x04C11DB7, LSB-first (slicing-by-8)
+extern const calc_crc_32bit_tables_t calc_crc_tables_crc32_bzip2;  // 0x04C11DB7, MSB-first (slicing-by-8)
+extern const calc_crc_32bit_tables_t calc_crc_tables_crc32c;       // 0x1EDC6F41, LSB-first (slicing-by-8)
+extern const calc_crc_64bit_tables_t calc_crc_tables_crc64_xz;     // 0x42F0E1EBA9EA3693, LSB-first (slicing-by-8)
+extern const calc_crc_64bit_tables_t calc_crc_tables_crc64_ecma;   // 0x42F0E1EBA9EA3693, MSB-first (slicing-by-8)
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CALC_CRC_TABLES_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
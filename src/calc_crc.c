@@ -22,6 +22,8 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #if __has_include("calc_crc_conf.h")
 #include "calc_crc_conf.h"
@@ -41,35 +43,165 @@
 #include "calc_crc/calc_crc_gtypes.h"
 #include "calc_crc/calc_crc.h"
 
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Enable hardware accelerated engines when supported by the target (can be disabled in calc_crc_conf.h).
+ */
+#ifndef CALC_CRC_CONF_HW_ACCEL_USE
+#define CALC_CRC_CONF_HW_ACCEL_USE (true)
+#endif /* CALC_CRC_CONF_HW_ACCEL_USE */
+
+/**
+ * @brief   x86-64 engines (carry-less multiply folding) are compiled in with GCC compatible compilers only.
+ */
+#if (true == CALC_CRC_CONF_HW_ACCEL_USE) && defined(__x86_64__) && defined(__GNUC__)
+#define CALC_CRC_HW_X86 (1)
+#else
+#define CALC_CRC_HW_X86 (0)
+#endif
+
+/**
+ * @brief   Minimal data length (bytes) to use carry-less multiply folding engine (one block of four 16-byte lanes).
+ */
+#define CALC_CRC_FOLD_MIN_LENGTH (64u)
+
+/**
+ * @brief   CRC-32C (Castagnoli) polynomial supported by SSE4.2 CRC32 instruction.
+ */
+#define CALC_CRC_CRC32C_POLYNOMIAL ((uint32_t)0x1EDC6F41)
+
+/**
+ * @brief   Stream block lengths (bytes) of three-way interleaved CRC-32C calculation.
+ */
+#define CALC_CRC_CRC32C_LONG  (8192u)
+#define CALC_CRC_CRC32C_SHORT (256u)
+
+/**
+ * @brief   States of a one-time initialization shared by threads (see _once_enter).
+ */
+#define CALC_CRC_ONCE_NONE (0u) // Not started.
+#define CALC_CRC_ONCE_BUSY (1u) // One thread is initializing, others wait.
+#define CALC_CRC_ONCE_DONE (2u) // Initialized data is visible to every thread that reads the state.
+
+/**
+ * @brief   Number of buffers calculated together (interleaved) by the batch calculation.
+ */
+#define CALC_CRC_BATCH_LANES (4u)
+
+/**
+ * @brief   Vectored calculation, segments shorter than CALC_CRC_VEC_GATHER_MIN are gathered into a buffer of
+ *          CALC_CRC_VEC_GATHER bytes and calculated with one kernel call (longer segments are calculated in place).
+ */
+#define CALC_CRC_VEC_GATHER     (256u)
+#define CALC_CRC_VEC_GATHER_MIN (64u)
+
+/**
+ * @brief   Checksum data length (bytes) summed without modulo reduction, sums are reduced once per chunk. Vector kernel
+ *          lanes (32-bit) do not overflow within a chunk.
+ */
+#define CALC_CRC_SUM_CHUNK (4096u)
+
+/**
+ * @brief   Internet checksum data length (bytes) summed into 64-bit accumulators before the carries are folded.
+ */
+#define CALC_CRC_INET_CHUNK ((size_t)1u << 30)
+
+/**
+ * @brief   Length (bytes) of the difference of old and new patch bytes passed to the kernel at once.
+ */
+#define CALC_CRC_PATCH_BLOCK (256u)
+
+/**
+ * @brief   Shortest run of constant bytes (bytes) extended with x^k shifts, shorter runs are faster through the kernel.
+ */
+#define CALC_CRC_FILL_MIN_LENGTH (16384u)
+
+#if (1 == CALC_CRC_HW_X86)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Parameters of a checksum type. Sums are kept in the raw register as the value (sum B above sum A).
+ */
+typedef struct
+{
+    uint8_t word;     // Word length in bytes (little-endian words, an incomplete last word is zero padded).
+    uint8_t half;     // Position of sum B in the value (0 = sum A only).
+    uint8_t size;     // Size of the value in bytes.
+    bool negated;     // Value is the two's complement of sum A.
+    bool ones;        // Ones' complement sum of big-endian words with end-around carry (value is its complement).
+    uint64_t modulus; // Modulus of both sums.
+} calc_crc_sum_t;
+
 // --- Private Functions Prototypes ------------------------------------------------------------------------------------
 
 /**
  * @brief   Calculate a CRC-8 lookup table using the specified polynomial.
  * @param   table       Pointer to the table to store the CRC values.
  * @param   polynomial  Polynomial value for the CRC-8 calculation.
+ * @param   reflected   Generate right-shifting table for reflected (LSB-first) input.
  */
-static void _calc_table_crc8(uint8_t *table, uint8_t polynomial);
+static void _calc_table_crc8(uint8_t *table, uint8_t polynomial, bool reflected);
 
 /**
  * @brief   Calculate a CRC-16 lookup table using the specified polynomial.
  * @param   table       Pointer to the table to store the CRC values.
  * @param   polynomial  Polynomial value for the CRC-16 calculation.
+ * @param   reflected   Generate right-shifting table for reflected (LSB-first) input.
  */
-static void _calc_table_crc16(uint16_t *table, uint16_t polynomial);
+static void _calc_table_crc16(uint16_t *table, uint16_t polynomial, bool reflected);
 
 /**
  * @brief   Calculate a CRC-32 lookup table using the specified polynomial.
  * @param   table       Pointer to the table to store the CRC values.
  * @param   polynomial  Polynomial value for the CRC-32 calculation.
+ * @param   reflected   Generate right-shifting table for reflected (LSB-first) input.
  */
-static void _calc_table_crc32(uint32_t *table, uint32_t polynomial);
+static void _calc_table_crc32(uint32_t *table, uint32_t polynomial, bool reflected);
 
 /**
  * @brief   Calculate a CRC-64 lookup table using the specified polynomial.
  * @param   table       Pointer to the table to store the CRC values.
  * @param   polynomial  Polynomial value for the CRC-64 calculation.
+ * @param   reflected   Generate right-shifting table for reflected (LSB-first) input.
+ */
+static void _calc_table_crc64(uint64_t *table, uint64_t polynomial, bool reflected);
+
+/**
+ * @brief   Calculate a CRC-8 nibble lookup table (16 entries) using the specified polynomial.
+ * @param   table       Pointer to the table to store the CRC values.
+ * @param   polynomial  Polynomial value for the CRC-8 calculation.
+ * @param   reflected   Generate right-shifting table for reflected (LSB-first) input.
+ */
+static void _calc_nibble_crc8(uint8_t *table, uint8_t polynomial, bool reflected);
+
+/**
+ * @brief   Calculate a CRC-16 nibble lookup table (16 entries) using the specified polynomial.
+ * @param   table       Pointer to the table to store the CRC values.
+ * @param   polynomial  Polynomial value for the CRC-16 calculation.
+ * @param   reflected   Generate right-shifting table for reflected (LSB-first) input.
+ */
+static void _calc_nibble_crc16(uint16_t *table, uint16_t polynomial, bool reflected);
+
+/**
+ * @brief   Calculate a CRC-32 nibble lookup table (16 entries) using the specified polynomial.
+ * @param   table       Pointer to the table to store the CRC values.
+ * @param   polynomial  Polynomial value for the CRC-32 calculation.
+ * @param   reflected   Generate right-shifting table for reflected (LSB-first) input.
+ */
+static void _calc_nibble_crc32(uint32_t *table, uint32_t polynomial, bool reflected);
+
+/**
+ * @brief   Calculate a CRC-64 nibble lookup table (16 entries) using the specified polynomial.
+ * @param   table       Pointer to the table to store the CRC values.
+ * @param   polynomial  Polynomial value for the CRC-64 calculation.
+ * @param   reflected   Generate right-shifting table for reflected (LSB-first) input.
  */
-static void _calc_table_crc64(uint64_t *table, uint64_t polynomial);
+static void _calc_nibble_crc64(uint64_t *table, uint64_t polynomial, bool reflected);
 
 /**
  * @brief   Calculate the CRC-8 value for the given data.
@@ -79,7 +211,112 @@ static void _calc_table_crc64(uint64_t *table, uint64_t polynomial);
  * @param   length      Length of the data buffer.
  * @return  Calculated CRC-8 value.
  */
-static uint8_t _calc_crc8(calc_crc_t *crc, calc_crc_8bit_t *conf, const uint8_t *data, size_t length);
+static uint8_t _calc_crc8(const calc_crc_t *crc, const calc_crc_8bit_t *conf, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Get the initial CRC-8 register (left-aligned, reflected for reflected tables).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-8 configuration.
+ * @return  Initial register value.
+ */
+static uint8_t _initial_crc8(const calc_crc_t *crc, const calc_crc_8bit_t *conf);
+
+/**
+ * @brief   Process data through the raw CRC-8 register with the kernel bound at init (no finalization).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-8 configuration.
+ * @param   reg         Current register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint8_t _update_crc8(const calc_crc_t *crc, const calc_crc_8bit_t *conf, uint8_t reg, const uint8_t *data,
+                            size_t length);
+
+/**
+ * @brief   Finalize the raw CRC-8 register (final XOR value, output reflection and width alignment).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-8 configuration.
+ * @param   reg         Register value.
+ * @return  Final CRC-8 value.
+ */
+static uint8_t _final_crc8(const calc_crc_t *crc, const calc_crc_8bit_t *conf, uint8_t reg);
+
+/**
+ * @brief   Calculate the CRC-8 values of multiple buffers (groups of short buffers are interleaved).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-8 configuration.
+ * @param   data        Array of pointers to the data buffers.
+ * @param   length      Array of lengths of the data buffers.
+ * @param   result      Array to store calculated CRC-8 values.
+ * @param   count       Number of buffers.
+ */
+static void _batch_crc8(calc_crc_t *crc, calc_crc_8bit_t *conf, const void *const *data, const size_t *length,
+                        uint8_t *result, size_t count);
+
+/**
+ * @brief   Process the same number of bytes of CALC_CRC_BATCH_LANES buffers through CRC-8 registers in lockstep.
+ * @param   table       Pointer to the CRC-8 lookup table (left-shifting or reflected).
+ * @param   reg         Array of CALC_CRC_BATCH_LANES register values to update.
+ * @param   data        Array of CALC_CRC_BATCH_LANES pointers to the data buffers.
+ * @param   length      Number of bytes processed from every buffer.
+ */
+static void _multi_crc8(const uint8_t *table, uint8_t *reg, const uint8_t *const *data, size_t length);
+
+/**
+ * @brief   Process data through CRC-8 register using lookup table (same step for both bit orders, the 8-bit register
+ *          needs no shift).
+ * @param   table       Pointer to the CRC-8 lookup table (left-shifting or reflected).
+ * @param   reg         Current CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated CRC register value.
+ */
+static uint8_t _kernel_crc8(const uint8_t *table, uint8_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data through CRC-8 register with the engine bound at init (lookup table, nibble or bitwise).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Current register value (reflected for reflected input).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint8_t _engine_crc8(const calc_crc_t *crc, uint8_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data through CRC-8 register using the nibble table, two lookups per byte.
+ * @param   table       Pointer to the nibble table (16 entries).
+ * @param   reflected   Table is right-shifting table for reflected (LSB-first) input.
+ * @param   reg         Current register value (reflected for reflected input).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint8_t _nibble_crc8(const uint8_t *table, bool reflected, uint8_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Calculate additional CRC-8 slicing table rows from the base lookup table.
+ * @param   table       Pointer to the base CRC-8 lookup table.
+ * @param   slice_table Pointer to the (slices - 1) x 256 rows to fill.
+ * @param   slices      Number of bytes processed per slicing step.
+ * @param   reflected   Base table is right-shifting table for reflected (LSB-first) input.
+ */
+static void _calc_slice_table_crc8(const uint8_t *table, uint8_t *slice_table, uint8_t slices, bool reflected);
+
+/**
+ * @brief   Process data through CRC-8 register using slicing-by-N tables.
+ * @param   table       Pointer to the base CRC-8 lookup table.
+ * @param   slice_table Pointer to the additional (slices - 1) x 256 table rows.
+ * @param   slices      Number of bytes processed per slicing step (4, 8 or 16).
+ * @param   reflected   Tables are right-shifting tables for reflected (LSB-first) input.
+ * @param   reg         Current CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated CRC register value.
+ */
+static uint8_t _slice_crc8(const uint8_t *table, const uint8_t *slice_table, uint8_t slices, bool reflected,
+                           uint8_t reg, const uint8_t *data, size_t length);
 
 /**
  * @brief   Calculate the CRC-16 value for the given data.
@@ -89,7 +326,123 @@ static uint8_t _calc_crc8(calc_crc_t *crc, calc_crc_8bit_t *conf, const uint8_t
  * @param   length      Length of the data buffer.
  * @return  Calculated CRC-16 value.
  */
-static uint16_t _calc_crc16(calc_crc_t *crc, calc_crc_16bit_t *conf, const uint8_t *data, size_t length);
+static uint16_t _calc_crc16(const calc_crc_t *crc, const calc_crc_16bit_t *conf, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Get the initial CRC-16 register (left-aligned, reflected for reflected tables).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-16 configuration.
+ * @return  Initial register value.
+ */
+static uint16_t _initial_crc16(const calc_crc_t *crc, const calc_crc_16bit_t *conf);
+
+/**
+ * @brief   Process data through the raw CRC-16 register with the kernel bound at init (no finalization).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-16 configuration.
+ * @param   reg         Current register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint16_t _update_crc16(const calc_crc_t *crc, const calc_crc_16bit_t *conf, uint16_t reg, const uint8_t *data,
+                              size_t length);
+
+/**
+ * @brief   Finalize the raw CRC-16 register (final XOR value, output reflection and width alignment).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-16 configuration.
+ * @param   reg         Register value.
+ * @return  Final CRC-16 value.
+ */
+static uint16_t _final_crc16(const calc_crc_t *crc, const calc_crc_16bit_t *conf, uint16_t reg);
+
+/**
+ * @brief   Calculate the CRC-16 values of multiple buffers (groups of short buffers are interleaved).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-16 configuration.
+ * @param   data        Array of pointers to the data buffers.
+ * @param   length      Array of lengths of the data buffers.
+ * @param   result      Array to store calculated CRC-16 values.
+ * @param   count       Number of buffers.
+ */
+static void _batch_crc16(calc_crc_t *crc, calc_crc_16bit_t *conf, const void *const *data, const size_t *length,
+                         uint16_t *result, size_t count);
+
+/**
+ * @brief   Process the same number of bytes of CALC_CRC_BATCH_LANES buffers through CRC-16 registers in lockstep.
+ * @param   table       Pointer to the CRC-16 lookup table.
+ * @param   reflected   Table is right-shifting (LSB-first).
+ * @param   reg         Array of CALC_CRC_BATCH_LANES register values to update.
+ * @param   data        Array of CALC_CRC_BATCH_LANES pointers to the data buffers.
+ * @param   length      Number of bytes processed from every buffer.
+ */
+static void _multi_crc16(const uint16_t *table, bool reflected, uint16_t *reg, const uint8_t *const *data,
+                         size_t length);
+
+/**
+ * @brief   Process data through CRC-16 register using left-shifting (MSB-first) table.
+ * @param   table       Pointer to the CRC-16 lookup table.
+ * @param   reg         Current CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated CRC register value.
+ */
+static uint16_t _kernel_crc16_msb(const uint16_t *table, uint16_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data through reflected CRC-16 register using right-shifting (LSB-first) table.
+ * @param   table       Pointer to the reflected CRC-16 lookup table.
+ * @param   reg         Current reflected CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated reflected CRC register value.
+ */
+static uint16_t _kernel_crc16_lsb(const uint16_t *table, uint16_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data through CRC-16 register with the engine bound at init (lookup table, nibble or bitwise).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Current register value (reflected for reflected input).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint16_t _engine_crc16(const calc_crc_t *crc, uint16_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data through CRC-16 register using the nibble table, two lookups per byte.
+ * @param   table       Pointer to the nibble table (16 entries).
+ * @param   reflected   Table is right-shifting table for reflected (LSB-first) input.
+ * @param   reg         Current register value (reflected for reflected input).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint16_t _nibble_crc16(const uint16_t *table, bool reflected, uint16_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Calculate additional CRC-16 slicing table rows from the base lookup table.
+ * @param   table       Pointer to the base CRC-16 lookup table.
+ * @param   slice_table Pointer to the (slices - 1) x 256 rows to fill.
+ * @param   slices      Number of bytes processed per slicing step.
+ * @param   reflected   Base table is right-shifting table for reflected (LSB-first) input.
+ */
+static void _calc_slice_table_crc16(const uint16_t *table, uint16_t *slice_table, uint8_t slices, bool reflected);
+
+/**
+ * @brief   Process data through CRC-16 register using slicing-by-N tables.
+ * @param   table       Pointer to the base CRC-16 lookup table.
+ * @param   slice_table Pointer to the additional (slices - 1) x 256 table rows.
+ * @param   slices      Number of bytes processed per slicing step (4, 8 or 16).
+ * @param   reflected   Tables are right-shifting tables for reflected (LSB-first) input.
+ * @param   reg         Current CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated CRC register value.
+ */
+static uint16_t _slice_crc16(const uint16_t *table, const uint16_t *slice_table, uint8_t slices, bool reflected,
+                             uint16_t reg, const uint8_t *data, size_t length);
 
 /**
  * @brief   Calculate the CRC-32 value for the given data.
@@ -99,494 +452,4666 @@ static uint16_t _calc_crc16(calc_crc_t *crc, calc_crc_16bit_t *conf, const uint8
  * @param   length      Length of the data buffer.
  * @return  Calculated CRC-32 value.
  */
-static uint32_t _calc_crc32(calc_crc_t *crc, calc_crc_32bit_t *conf, const uint8_t *data, size_t length);
+static uint32_t _calc_crc32(const calc_crc_t *crc, const calc_crc_32bit_t *conf, const uint8_t *data, size_t length);
 
 /**
- * @brief   Calculate the CRC-64 value for the given data.
+ * @brief   Get the initial CRC-32 register (left-aligned, reflected for reflected tables).
  * @param   crc         Pointer to the CRC instance.
- * @param   conf        Pointer to the CRC-64 configuration.
+ * @param   conf        Pointer to the CRC-32 configuration.
+ * @return  Initial register value.
+ */
+static uint32_t _initial_crc32(const calc_crc_t *crc, const calc_crc_32bit_t *conf);
+
+/**
+ * @brief   Process data through the raw CRC-32 register with the kernel bound at init (no finalization).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-32 configuration.
+ * @param   reg         Current register value.
  * @param   data        Pointer to the data buffer.
  * @param   length      Length of the data buffer.
- * @return  Calculated CRC-64 value.
+ * @return  Updated register value.
  */
-static uint64_t _calc_crc64(calc_crc_t *crc, calc_crc_64bit_t *conf, const uint8_t *data, size_t length);
+static uint32_t _update_crc32(const calc_crc_t *crc, const calc_crc_32bit_t *conf, uint32_t reg, const uint8_t *data,
+                              size_t length);
 
 /**
- * @brief   Reflect the bits in an 8-bit value.
- * @param   data        The 8-bit value to reflect.
- * @return  Reflected 8-bit value.
+ * @brief   Finalize the raw CRC-32 register (final XOR value, output reflection and width alignment).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-32 configuration.
+ * @param   reg         Register value.
+ * @return  Final CRC-32 value.
  */
-static uint8_t _reflect_crc8(uint8_t data);
+static uint32_t _final_crc32(const calc_crc_t *crc, const calc_crc_32bit_t *conf, uint32_t reg);
 
 /**
- * @brief   Reflect the bits in a 16-bit value.
- * @param   data        The 16-bit value to reflect.
- * @return  Reflected 16-bit value.
+ * @brief   Calculate the CRC-32 values of multiple buffers (groups of short buffers are interleaved).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-32 configuration.
+ * @param   data        Array of pointers to the data buffers.
+ * @param   length      Array of lengths of the data buffers.
+ * @param   result      Array to store calculated CRC-32 values.
+ * @param   count       Number of buffers.
  */
-static uint16_t _reflect_crc16(uint16_t data);
+static void _batch_crc32(calc_crc_t *crc, calc_crc_32bit_t *conf, const void *const *data, const size_t *length,
+                         uint32_t *result, size_t count);
 
 /**
- * @brief   Reflect the bits in a 32-bit value.
- * @param   data        The 32-bit value to reflect.
- * @return  Reflected 32-bit value.
+ * @brief   Process the same number of bytes of CALC_CRC_BATCH_LANES buffers through CRC-32 registers in lockstep.
+ * @param   table       Pointer to the CRC-32 lookup table.
+ * @param   reflected   Table is right-shifting (LSB-first).
+ * @param   reg         Array of CALC_CRC_BATCH_LANES register values to update.
+ * @param   data        Array of CALC_CRC_BATCH_LANES pointers to the data buffers.
+ * @param   length      Number of bytes processed from every buffer.
  */
-static uint32_t _reflect_crc32(uint32_t data);
+static void _multi_crc32(const uint32_t *table, bool reflected, uint32_t *reg, const uint8_t *const *data,
+                         size_t length);
 
 /**
- * @brief   Reflect the bits in a 64-bit value.
- * @param   data        The 64-bit value to reflect.
- * @return  Reflected 64-bit value.
+ * @brief   Process data through CRC-32 register using left-shifting (MSB-first) table.
+ * @param   table       Pointer to the CRC-32 lookup table.
+ * @param   reg         Current CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated CRC register value.
  */
-static uint64_t _reflect_crc64(uint64_t data);
+static uint32_t _kernel_crc32_msb(const uint32_t *table, uint32_t reg, const uint8_t *data, size_t length);
 
-// --- Public Functions Definitions ------------------------------------------------------------------------------------
+/**
+ * @brief   Process data through reflected CRC-32 register using right-shifting (LSB-first) table.
+ * @param   table       Pointer to the reflected CRC-32 lookup table.
+ * @param   reg         Current reflected CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated reflected CRC register value.
+ */
+static uint32_t _kernel_crc32_lsb(const uint32_t *table, uint32_t reg, const uint8_t *data, size_t length);
 
-calc_crc_status_e CALC_CRC_Init(calc_crc_t *crc, void *conf, calc_crc_type_e type)
-{
-    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(conf, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+/**
+ * @brief   Process data through CRC-32 register with the engine bound at init (lookup table, nibble or bitwise).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Current register value (reflected for reflected input).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint32_t _engine_crc32(const calc_crc_t *crc, uint32_t reg, const uint8_t *data, size_t length);
 
-    if (CALC_CRC_TYPE_MAX <= type)
-    {
-        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
-    }
+/**
+ * @brief   Process data through CRC-32 register using the nibble table, two lookups per byte.
+ * @param   table       Pointer to the nibble table (16 entries).
+ * @param   reflected   Table is right-shifting table for reflected (LSB-first) input.
+ * @param   reg         Current register value (reflected for reflected input).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint32_t _nibble_crc32(const uint32_t *table, bool reflected, uint32_t reg, const uint8_t *data, size_t length);
 
-    MEMSET(crc, 0, sizeof(calc_crc_t));
+/**
+ * @brief   Calculate additional CRC-32 slicing table rows from the base lookup table.
+ * @param   table       Pointer to the base CRC-32 lookup table.
+ * @param   slice_table Pointer to the (slices - 1) x 256 rows to fill.
+ * @param   slices      Number of bytes processed per slicing step.
+ * @param   reflected   Base table is right-shifting table for reflected (LSB-first) input.
+ */
+static void _calc_slice_table_crc32(const uint32_t *table, uint32_t *slice_table, uint8_t slices, bool reflected);
 
-    crc->type = type;
-    crc->conf = conf;
+/**
+ * @brief   Process data through CRC-32 register using slicing-by-N tables.
+ * @param   table       Pointer to the base CRC-32 lookup table.
+ * @param   slice_table Pointer to the additional (slices - 1) x 256 table rows.
+ * @param   slices      Number of bytes processed per slicing step (4, 8 or 16).
+ * @param   reflected   Tables are right-shifting tables for reflected (LSB-first) input.
+ * @param   reg         Current CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated CRC register value.
+ */
+static uint32_t _slice_crc32(const uint32_t *table, const uint32_t *slice_table, uint8_t slices, bool reflected,
+                             uint32_t reg, const uint8_t *data, size_t length);
 
-    switch (type)
-    {
-        case CALC_CRC_TYPE_8BIT: //
-        {
-            calc_crc_8bit_t *ptr = (calc_crc_8bit_t *)crc->conf;
-            _calc_table_crc8(ptr->table, ptr->polynomial);
-            break;
-        }
-        case CALC_CRC_TYPE_16BIT: //
-        {
-            calc_crc_16bit_t *ptr = (calc_crc_16bit_t *)crc->conf;
-            _calc_table_crc16(ptr->table, ptr->polynomial);
-            break;
-        }
-        case CALC_CRC_TYPE_32BIT: //
-        {
-            calc_crc_32bit_t *ptr = (calc_crc_32bit_t *)crc->conf;
-            _calc_table_crc32(ptr->table, ptr->polynomial);
-            break;
-        }
-        case CALC_CRC_TYPE_64BIT: //
-        {
-            calc_crc_64bit_t *ptr = (calc_crc_64bit_t *)crc->conf;
-            _calc_table_crc64(ptr->table, ptr->polynomial);
-            break;
+/**
+ * @brief   Calculate the CRC-64 value for the given data.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-64 configuration.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Calculated CRC-64 value.
+ */
+static uint64_t _calc_crc64(const calc_crc_t *crc, const calc_crc_64bit_t *conf, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Get the initial CRC-64 register (left-aligned, reflected for reflected tables).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-64 configuration.
+ * @return  Initial register value.
+ */
+static uint64_t _initial_crc64(const calc_crc_t *crc, const calc_crc_64bit_t *conf);
+
+/**
+ * @brief   Process data through the raw CRC-64 register with the kernel bound at init (no finalization).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-64 configuration.
+ * @param   reg         Current register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint64_t _update_crc64(const calc_crc_t *crc, const calc_crc_64bit_t *conf, uint64_t reg, const uint8_t *data,
+                              size_t length);
+
+/**
+ * @brief   Finalize the raw CRC-64 register (final XOR value, output reflection and width alignment).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-64 configuration.
+ * @param   reg         Register value.
+ * @return  Final CRC-64 value.
+ */
+static uint64_t _final_crc64(const calc_crc_t *crc, const calc_crc_64bit_t *conf, uint64_t reg);
+
+/**
+ * @brief   Calculate the CRC-64 values of multiple buffers (groups of short buffers are interleaved).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   conf        Pointer to the CRC-64 configuration.
+ * @param   data        Array of pointers to the data buffers.
+ * @param   length      Array of lengths of the data buffers.
+ * @param   result      Array to store calculated CRC-64 values.
+ * @param   count       Number of buffers.
+ */
+static void _batch_crc64(calc_crc_t *crc, calc_crc_64bit_t *conf, const void *const *data, const size_t *length,
+                         uint64_t *result, size_t count);
+
+/**
+ * @brief   Process the same number of bytes of CALC_CRC_BATCH_LANES buffers through CRC-64 registers in lockstep.
+ * @param   table       Pointer to the CRC-64 lookup table.
+ * @param   reflected   Table is right-shifting (LSB-first).
+ * @param   reg         Array of CALC_CRC_BATCH_LANES register values to update.
+ * @param   data        Array of CALC_CRC_BATCH_LANES pointers to the data buffers.
+ * @param   length      Number of bytes processed from every buffer.
+ */
+static void _multi_crc64(const uint64_t *table, bool reflected, uint64_t *reg, const uint8_t *const *data,
+                         size_t length);
+
+/**
+ * @brief   Process data through CRC-64 register using left-shifting (MSB-first) table.
+ * @param   table       Pointer to the CRC-64 lookup table.
+ * @param   reg         Current CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated CRC register value.
+ */
+static uint64_t _kernel_crc64_msb(const uint64_t *table, uint64_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data through reflected CRC-64 register using right-shifting (LSB-first) table.
+ * @param   table       Pointer to the reflected CRC-64 lookup table.
+ * @param   reg         Current reflected CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated reflected CRC register value.
+ */
+static uint64_t _kernel_crc64_lsb(const uint64_t *table, uint64_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data through CRC-64 register with the engine bound at init (lookup table, nibble or bitwise).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Current register value (reflected for reflected input).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint64_t _engine_crc64(const calc_crc_t *crc, uint64_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data through CRC-64 register using the nibble table, two lookups per byte.
+ * @param   table       Pointer to the nibble table (16 entries).
+ * @param   reflected   Table is right-shifting table for reflected (LSB-first) input.
+ * @param   reg         Current register value (reflected for reflected input).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint64_t _nibble_crc64(const uint64_t *table, bool reflected, uint64_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Calculate additional CRC-64 slicing table rows from the base lookup table.
+ * @param   table       Pointer to the base CRC-64 lookup table.
+ * @param   slice_table Pointer to the (slices - 1) x 256 rows to fill.
+ * @param   slices      Number of bytes processed per slicing step.
+ * @param   reflected   Base table is right-shifting table for reflected (LSB-first) input.
+ */
+static void _calc_slice_table_crc64(const uint64_t *table, uint64_t *slice_table, uint8_t slices, bool reflected);
+
+/**
+ * @brief   Process data through CRC-64 register using slicing-by-N tables.
+ * @param   table       Pointer to the base CRC-64 lookup table.
+ * @param   slice_table Pointer to the additional (slices - 1) x 256 table rows.
+ * @param   slices      Number of bytes processed per slicing step (4, 8 or 16).
+ * @param   reflected   Tables are right-shifting tables for reflected (LSB-first) input.
+ * @param   reg         Current CRC register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated CRC register value.
+ */
+static uint64_t _slice_crc64(const uint64_t *table, const uint64_t *slice_table, uint8_t slices, bool reflected,
+                             uint64_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data through CRC register of the given width bit by bit (no lookup table).
+ * @param   polynomial  CRC polynomial (without the implicit top bit, non-reflected representation).
+ * @param   width       CRC width in bits (8 - 64).
+ * @param   reflected   Register is reflected (LSB-first input).
+ * @param   reg         Current register value (reflected for reflected input).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint64_t _bitwise_crc(uint64_t polynomial, uint8_t width, bool reflected, uint64_t reg, const uint8_t *data,
+                             size_t length);
+
+/**
+ * @brief   Multiply two polynomials modulo CRC polynomial of the given width (non-reflected representation).
+ * @param   a           First factor (remainder of width bits).
+ * @param   b           Second factor (remainder of width bits).
+ * @param   polynomial  CRC polynomial (without the implicit top bit).
+ * @param   width       CRC width in bits (1 - 64).
+ * @return  Product a * b modulo the polynomial.
+ */
+static uint64_t _mul_mod(uint64_t a, uint64_t b, uint64_t polynomial, uint8_t width);
+
+/**
+ * @brief   Calculate x^exponent modulo CRC polynomial of the given width (square and multiply).
+ * @param   exponent    Exponent of the x term.
+ * @param   polynomial  CRC polynomial (without the implicit top bit).
+ * @param   width       CRC width in bits (1 - 64).
+ * @return  Remainder of x^exponent divided by the polynomial.
+ */
+static uint64_t _xpow_mod(uint64_t exponent, uint64_t polynomial, uint8_t width);
+
+/**
+ * @brief   Combine CRC values of two consecutive data blocks into CRC value of the joined data.
+ * @param   polynomial  CRC polynomial (without the implicit top bit).
+ * @param   initial     Initial value of CRC computation.
+ * @param   final       Final XOR value of CRC computation.
+ * @param   reflected   Output CRC is reflected.
+ * @param   width       CRC width in bits (1 - 64).
+ * @param   crc_a       CRC value of the first block.
+ * @param   crc_b       CRC value of the second block.
+ * @param   length_b    Length of the second block in bytes.
+ * @return  CRC value of the first block followed by the second block.
+ */
+static uint64_t _combine(uint64_t polynomial, uint64_t initial, uint64_t final, bool reflected, uint8_t width,
+                         uint64_t crc_a, uint64_t crc_b, size_t length_b);
+
+/**
+ * @brief   Shift the raw register of a CRC instance over zero bytes (multiply by x^(8 * count) modulo polynomial).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Raw register value.
+ * @param   count       Number of zero bytes.
+ * @return  Shifted raw register value.
+ */
+static uint64_t _shift_crc(const calc_crc_t *crc, uint64_t reg, uint64_t count);
+
+/**
+ * @brief   Process count copies of a byte through the raw register of a CRC instance in O(log count) steps.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Raw register value.
+ * @param   byte        Value of the bytes.
+ * @param   count       Number of bytes.
+ * @return  Updated raw register value.
+ */
+static uint64_t _fill_crc(const calc_crc_t *crc, uint64_t reg, uint8_t byte, uint64_t count);
+
+/**
+ * @brief   Get the polynomial of a CRC instance (right-aligned, without the implicit top bit).
+ * @param   crc         Pointer to the CRC instance.
+ * @return  CRC polynomial.
+ */
+static uint64_t _crc_polynomial(const calc_crc_t *crc);
+
+/**
+ * @brief   Convert the raw register of a CRC instance to the remainder (non-reflected, right-aligned).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Raw register value.
+ * @return  Remainder.
+ */
+static uint64_t _reg_to_rem(const calc_crc_t *crc, uint64_t reg);
+
+/**
+ * @brief   Convert a remainder (non-reflected, right-aligned) to the raw register of a CRC instance.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   rem         Remainder.
+ * @return  Raw register value.
+ */
+static uint64_t _rem_to_reg(const calc_crc_t *crc, uint64_t rem);
+
+/**
+ * @brief   Calculate carry-less multiply folding constants for the given polynomial.
+ * @param   constants   Pointer to the CALC_CRC_FOLD_CONSTANTS constants to fill.
+ * @param   polynomial  CRC polynomial (without the implicit top bit).
+ * @param   width       CRC width in bits (1 - 64).
+ * @param   reflected   Generate constants for reflected (LSB-first) input.
+ */
+static void _calc_fold_constants(uint64_t *constants, uint64_t polynomial, uint8_t width, bool reflected);
+
+/**
+ * @brief   Get parameters of a checksum type.
+ * @param   type        Checksum type (CALC_CRC_TYPE_SUM8 and above).
+ * @return  Pointer to the checksum parameters.
+ */
+static const calc_crc_sum_t *_sum_params(calc_crc_type_e type);
+
+/**
+ * @brief   Get word length of the instance type, data of checksums over 16/32-bit words is processed in whole words.
+ * @param   type        Type of CRC calculation.
+ * @return  Word length in bytes (1 for CRC types and byte checksums).
+ */
+static uint8_t _sum_word(calc_crc_type_e type);
+
+/**
+ * @brief   Get the initial raw register of a checksum instance (configured initial sums reduced by the modulus).
+ * @param   crc         Pointer to the checksum instance.
+ * @return  Initial register value.
+ */
+static uint64_t _initial_sum(const calc_crc_t *crc);
+
+/**
+ * @brief   Process data through the raw register of a checksum instance with the kernel bound at init.
+ * @param   crc         Pointer to the checksum instance.
+ * @param   reg         Current register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (multiple of the word length).
+ * @return  Updated register value.
+ */
+static uint64_t _update_sum(const calc_crc_t *crc, uint64_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Get the checksum value of the raw register.
+ * @param   crc         Pointer to the checksum instance.
+ * @param   reg         Register value.
+ * @return  Checksum value.
+ */
+static uint64_t _final_sum(const calc_crc_t *crc, uint64_t reg);
+
+/**
+ * @brief   Combine checksum values of two consecutive blocks into the checksum value of the joined data.
+ * @param   crc         Pointer to the checksum instance.
+ * @param   sum_a       Checksum value of the first block (length a multiple of the word length).
+ * @param   sum_b       Checksum value of the second block.
+ * @param   length_b    Length of the second block in bytes.
+ * @return  Checksum value of the first block followed by the second block.
+ */
+static uint64_t _combine_sum(const calc_crc_t *crc, uint64_t sum_a, uint64_t sum_b, size_t length_b);
+
+/**
+ * @brief   Update a checksum value (not Internet checksum) after a byte range of the data changed.
+ * @param   crc         Pointer to the checksum instance.
+ * @param   value       Checksum value of the data before the change.
+ * @param   length      Length of the whole data in bytes.
+ * @param   offset      Offset of the changed range.
+ * @param   old_bytes   Pointer to the range contents before the change.
+ * @param   new_bytes   Pointer to the range contents after the change.
+ * @param   patch_length Length of the changed range in bytes.
+ * @return  Checksum value of the changed data.
+ */
+static uint64_t _patch_sum(const calc_crc_t *crc, uint64_t value, size_t length, size_t offset,
+                           const uint8_t *old_bytes, const uint8_t *new_bytes, size_t patch_length);
+
+/**
+ * @brief   Process count whole words made of one repeated byte through the raw register of a checksum instance in
+ *          O(1) steps.
+ * @param   crc         Pointer to the checksum instance.
+ * @param   reg         Current register value.
+ * @param   byte        Value of the bytes.
+ * @param   words       Number of words.
+ * @return  Updated register value.
+ */
+static uint64_t _fill_sum(const calc_crc_t *crc, uint64_t reg, uint8_t byte, uint64_t words);
+
+/**
+ * @brief   Get the size of a value of the type in bytes.
+ * @param   type        Type of CRC calculation.
+ * @return  Size of the CRC or checksum value.
+ */
+static uint8_t _value_size(calc_crc_type_e type);
+
+/**
+ * @brief   Sum words of a chunk without modulo reduction, continuing the running sums.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (multiple of the word length).
+ * @param   word        Word length in bytes (1, 2 or 4).
+ * @param   sum         Pointer to the running sum of words.
+ * @param   weighted    Pointer to the running sum of prefix sums (each word weighted by words from it to the end).
+ */
+static void _sum_generic(const uint8_t *data, size_t length, uint8_t word, uint64_t *sum, uint64_t *weighted);
+
+/**
+ * @brief   Select the checksum kernel tier.
+ * @return  Selected kernel tier.
+ */
+static calc_crc_kernel_e _bind_sum_kernel(void);
+
+/**
+ * @brief   Fold carries of a ones' complement sum into 16 bits (end-around carry).
+ * @param   sum         Sum of 16-bit words (any width).
+ * @return  Folded sum (0 only if the sum is 0).
+ */
+static uint64_t _fold_inet(uint64_t sum);
+
+/**
+ * @brief   Process data through the raw register of an Internet checksum instance with the kernel bound at init.
+ * @param   crc         Pointer to the checksum instance.
+ * @param   reg         Current register value (folded sum of big-endian words).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (multiple of 2).
+ * @return  Updated register value.
+ */
+static uint64_t _update_inet(const calc_crc_t *crc, uint64_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Adjust an Internet checksum value after a field changed (RFC 1624, HC' = ~(~HC + ~m + m')).
+ * @param   value       Checksum value of the data before the change.
+ * @param   offset      Offset of the field in the data.
+ * @param   old_bytes   Pointer to the field contents before the change.
+ * @param   new_bytes   Pointer to the field contents after the change.
+ * @param   length      Length of the field in bytes.
+ * @return  Checksum value of the changed data.
+ */
+static uint64_t _adjust_inet(uint64_t value, size_t offset, const uint8_t *old_bytes, const uint8_t *new_bytes,
+                             size_t length);
+
+/**
+ * @brief   Sum 32-bit little-endian words of the data (16-bit word at the end), carries are not folded.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (multiple of 2, at most CALC_CRC_INET_CHUNK).
+ * @return  Sum of words.
+ */
+static uint64_t _sum_inet_generic(const uint8_t *data, size_t length);
+
+#if (1 == CALC_CRC_HW_X86)
+
+/**
+ * @brief   Detect CPU features once (thread safe), results are cached in _cpu_ecx and _cpu_avx2.
+ */
+static void _cpu_detect(void);
+
+/**
+ * @brief   Read CPU feature flags (CPUID leaf 1, register ECX), detected once and cached.
+ * @return  Feature flags, 0 if CPUID is not available.
+ */
+static uint32_t _cpu_features(void);
+
+/**
+ * @brief   Check if CPU supports instructions required by carry-less multiply folding engine.
+ * @return  True if PCLMULQDQ and SSSE3 are available, false otherwise.
+ */
+static bool _cpu_has_pclmul(void);
+
+/**
+ * @brief   Check if CPU supports SSE4.2 CRC32 instruction.
+ * @return  True if SSE4.2 is available, false otherwise.
+ */
+static bool _cpu_has_sse42(void);
+
+/**
+ * @brief   Check if CPU and operating system support AVX2 (YMM state enabled in XCR0), detected once and cached.
+ * @return  True if AVX2 is available, false otherwise.
+ */
+static bool _cpu_has_avx2(void);
+
+/**
+ * @brief   Sum bytes of a chunk with SSE2, sums of 16-byte blocks are weighted with PMADDWD.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (at most CALC_CRC_SUM_CHUNK).
+ * @param   sum         Pointer to store the sum of bytes.
+ * @param   weighted    Pointer to store the sum of prefix sums.
+ * @return  Number of data bytes consumed (multiple of 16).
+ */
+static size_t _sum_bytes_sse2(const uint8_t *data, size_t length, uint64_t *sum, uint64_t *weighted);
+
+/**
+ * @brief   Sum bytes of a chunk with AVX2, sums of 32-byte blocks are weighted with PMADDUBSW.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (at most CALC_CRC_SUM_CHUNK).
+ * @param   sum         Pointer to store the sum of bytes.
+ * @param   weighted    Pointer to store the sum of prefix sums.
+ * @return  Number of data bytes consumed (multiple of 32).
+ */
+static size_t _sum_bytes_avx2(const uint8_t *data, size_t length, uint64_t *sum, uint64_t *weighted);
+
+/**
+ * @brief   Sum 16-bit or 32-bit words of a chunk with SSE2, every word position of a 16-byte block has its own lane.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (at most CALC_CRC_SUM_CHUNK).
+ * @param   word        Word length in bytes (2 or 4).
+ * @param   sum         Pointer to store the sum of words.
+ * @param   weighted    Pointer to store the sum of prefix sums.
+ * @return  Number of data bytes consumed (multiple of 16).
+ */
+static size_t _sum_words_sse2(const uint8_t *data, size_t length, uint8_t word, uint64_t *sum, uint64_t *weighted);
+
+/**
+ * @brief   Sum 16-bit or 32-bit words of a chunk with AVX2, every word position of a 32-byte block has its own lane.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (at most CALC_CRC_SUM_CHUNK).
+ * @param   word        Word length in bytes (2 or 4).
+ * @param   sum         Pointer to store the sum of words.
+ * @param   weighted    Pointer to store the sum of prefix sums.
+ * @return  Number of data bytes consumed (multiple of 32).
+ */
+static size_t _sum_words_avx2(const uint8_t *data, size_t length, uint8_t word, uint64_t *sum, uint64_t *weighted);
+
+/**
+ * @brief   Merge lanes of a word kernel (lane j holds word j of every block) into the sums of the whole data.
+ * @param   lane_sum    Array of sums of words of every lane.
+ * @param   lane_weighted Array of sums of prefix sums of every lane (over blocks).
+ * @param   lanes       Number of lanes (words per block).
+ * @param   sum         Pointer to store the sum of words.
+ * @param   weighted    Pointer to store the sum of prefix sums.
+ */
+static void _sum_lanes(const uint64_t *lane_sum, const uint64_t *lane_weighted, size_t lanes, uint64_t *sum,
+                       uint64_t *weighted);
+
+/**
+ * @brief   Sum 32-bit little-endian words with SSE2 into two 64-bit accumulators (even and odd words).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (at most CALC_CRC_INET_CHUNK).
+ * @param   sum         Pointer to store the sum of words.
+ * @return  Number of data bytes consumed (multiple of 16).
+ */
+static size_t _sum_inet_sse2(const uint8_t *data, size_t length, uint64_t *sum);
+
+/**
+ * @brief   Sum 32-bit little-endian words with AVX2 into four accumulators of 64-bit lanes (two blocks per step).
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer (at most CALC_CRC_INET_CHUNK).
+ * @param   sum         Pointer to store the sum of words.
+ * @return  Number of data bytes consumed (multiple of 32).
+ */
+static size_t _sum_inet_avx2(const uint8_t *data, size_t length, uint64_t *sum);
+
+/**
+ * @brief   Start a one-time initialization, only the first caller initializes and later callers wait until it is done.
+ * @param   state       Pointer to the CALC_CRC_ONCE_* state of the initialization.
+ * @return  True if the caller has to initialize and call _once_leave, false if already initialized.
+ */
+static bool _once_enter(uint8_t *state);
+
+/**
+ * @brief   Finish a one-time initialization, data written before is published to threads calling _once_enter.
+ * @param   state       Pointer to the CALC_CRC_ONCE_* state of the initialization.
+ */
+static void _once_leave(uint8_t *state);
+
+/**
+ * @brief   Generate CRC-32C register shift tables used to merge interleaved streams (done once, thread safe).
+ */
+static void _crc32c_shift_init(void);
+
+/**
+ * @brief   Shift reflected CRC-32C register over the stream block length of zero bytes.
+ * @param   table       Pointer to the 4 x 256 shift table of the stream block length.
+ * @param   reg         Reflected CRC-32C register value.
+ * @return  Shifted register value.
+ */
+static uint32_t _crc32c_shift(const uint32_t (*table)[256], uint32_t reg);
+
+/**
+ * @brief   Process data through reflected CRC-32C register with SSE4.2 CRC32 instruction.
+ * @param   reg         Current reflected CRC-32C register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated reflected CRC-32C register value.
+ */
+static uint32_t _crc32c_sse42(uint32_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process the same number of bytes of CALC_CRC_BATCH_LANES buffers through CRC-32C registers in lockstep.
+ *          Lanes are unrolled by hand (CALC_CRC_BATCH_LANES = 4) to keep all registers in CPU registers.
+ * @param   reg         Array of CALC_CRC_BATCH_LANES reflected CRC-32C register values to update.
+ * @param   data        Array of CALC_CRC_BATCH_LANES pointers to the data buffers.
+ * @param   length      Number of bytes processed from every buffer.
+ */
+static void _crc32c_sse42_multi(uint32_t *reg, const uint8_t *const *data, size_t length);
+
+/**
+ * @brief   Fold data with carry-less multiplication into 16 bytes with the same CRC remainder.
+ * @param   constants   Pointer to the folding constants generated at initialization.
+ * @param   reflected   Data is processed in reflected (LSB-first) bit order.
+ * @param   width       CRC width in bits (1 - 64).
+ * @param   reg         Current CRC register value (in table orientation).
+ * @param   data        Pointer to the data buffer (at least 64 bytes, CALC_CRC_FOLD_MIN_LENGTH).
+ * @param   length      Length of the data buffer.
+ * @param   residue     Pointer to 16 bytes where the folded message is stored.
+ * @return  Number of data bytes consumed (multiple of 16).
+ */
+static size_t _fold_pclmul(const uint64_t *constants, bool reflected, uint8_t width, uint64_t reg,
+                           const uint8_t *data, size_t length, uint8_t *residue);
+
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+/**
+ * @brief   Load 32-bit value stored in little-endian byte order.
+ * @param   data        Pointer to the first byte.
+ * @return  Loaded 32-bit value.
+ */
+static inline uint32_t _load_le32(const uint8_t *data);
+
+/**
+ * @brief   Load 32-bit value stored in big-endian byte order.
+ * @param   data        Pointer to the first byte.
+ * @return  Loaded 32-bit value.
+ */
+static inline uint32_t _load_be32(const uint8_t *data);
+
+/**
+ * @brief   Check if number of slicing bytes is supported.
+ * @param   slices      Number of bytes processed per slicing step.
+ * @return  True if supported (0 or 1 disables slicing), false otherwise.
+ */
+static bool _is_valid_slices(uint8_t slices);
+
+/**
+ * @brief   Select the engine of an instance (compile-time fixed engine overrides the configuration).
+ * @param   engine      Engine requested by the configuration.
+ * @return  Engine to bind (CALC_CRC_ENGINE_MAX or more if not supported).
+ */
+static uint8_t _engine_select(uint8_t engine);
+
+/**
+ * @brief   Reflect the bits in an 8-bit value.
+ * @param   data        The 8-bit value to reflect.
+ * @return  Reflected 8-bit value.
+ */
+static uint8_t _reflect_crc8(uint8_t data);
+
+/**
+ * @brief   Reflect the bits in a 16-bit value.
+ * @param   data        The 16-bit value to reflect.
+ * @return  Reflected 16-bit value.
+ */
+static uint16_t _reflect_crc16(uint16_t data);
+
+/**
+ * @brief   Reflect the bits in a 32-bit value.
+ * @param   data        The 32-bit value to reflect.
+ * @return  Reflected 32-bit value.
+ */
+static uint32_t _reflect_crc32(uint32_t data);
+
+/**
+ * @brief   Reflect the bits in a 64-bit value.
+ * @param   data        The 64-bit value to reflect.
+ * @return  Reflected 64-bit value.
+ */
+static uint64_t _reflect_crc64(uint64_t data);
+
+/**
+ * @brief   Parse kernel tier name (as used in CALC_CRC_KERNEL_ENV environment variable).
+ * @param   name        Kernel tier name (auto, generic, slicing, sse42 or pclmul), may be NULL.
+ * @return  Kernel tier, CALC_CRC_KERNEL_AUTO if name is not known.
+ */
+static calc_crc_kernel_e _kernel_from_name(const char *name);
+
+/**
+ * @brief   Get forced kernel tier, environment variable is read on first call unless CALC_CRC_SetKernel was called.
+ * @return  Forced kernel tier, CALC_CRC_KERNEL_AUTO if not forced.
+ */
+static calc_crc_kernel_e _kernel_forced(void);
+
+/**
+ * @brief   Select the best kernel tier supported by CPU, instance configuration and forced tier.
+ * @param   crc         Pointer to the CRC instance (slices already set).
+ * @param   crc32c      Configuration is reflected CRC-32C (supported by SSE4.2 CRC32 instruction).
+ * @return  Selected kernel tier.
+ */
+static calc_crc_kernel_e _bind_kernel(const calc_crc_t *crc, bool crc32c);
+
+/**
+ * @brief   Check if the next CALC_CRC_BATCH_LANES buffers should be calculated interleaved.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   length      Array of CALC_CRC_BATCH_LANES buffer lengths.
+ * @return  True if interleaving is faster than the bound kernel, false otherwise.
+ */
+static bool _batch_lanes(const calc_crc_t *crc, const size_t *length);
+
+/**
+ * @brief   Get the initial raw register of the CRC instance.
+ * @param   crc         Pointer to the CRC instance.
+ * @return  Initial register value (width of the instance type).
+ */
+static uint64_t _initial_crc(const calc_crc_t *crc);
+
+/**
+ * @brief   Process data through the raw register of the CRC instance with the kernel bound at init.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Current register value.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint64_t _update_crc(const calc_crc_t *crc, uint64_t reg, const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process data segments through the raw register (short segments are gathered, see CALC_CRC_VEC_GATHER).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Current register value.
+ * @param   tail        Pointer to the bytes of an incomplete word (little-endian).
+ * @param   tail_length Pointer to the number of bytes in tail.
+ * @param   iov         Array of data segments.
+ * @param   count       Number of data segments.
+ * @return  Updated register value.
+ */
+static uint64_t _update_vec(const calc_crc_t *crc, uint64_t reg, uint32_t *tail, uint8_t *tail_length,
+                            const calc_crc_iovec_t *iov, size_t count);
+
+/**
+ * @brief   Process data through the raw register in whole words, bytes of an incomplete word are carried in the tail.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Current register value.
+ * @param   tail        Pointer to the bytes of an incomplete word (little-endian).
+ * @param   tail_length Pointer to the number of bytes in tail.
+ * @param   data        Pointer to the data buffer.
+ * @param   length      Length of the data buffer.
+ * @return  Updated register value.
+ */
+static uint64_t _update_tail(const calc_crc_t *crc, uint64_t reg, uint32_t *tail, uint8_t *tail_length,
+                             const uint8_t *data, size_t length);
+
+/**
+ * @brief   Process an incomplete word of the tail zero padded (last word of the data) and clear the tail.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Current register value.
+ * @param   tail        Pointer to the bytes of an incomplete word (little-endian).
+ * @param   tail_length Pointer to the number of bytes in tail.
+ * @return  Updated register value.
+ */
+static uint64_t _flush_tail(const calc_crc_t *crc, uint64_t reg, uint32_t *tail, uint8_t *tail_length);
+
+/**
+ * @brief   Process count copies of a byte through the raw register, carrying an incomplete word of checksums.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Current register value.
+ * @param   tail        Pointer to the incomplete word (little-endian).
+ * @param   tail_length Pointer to the number of bytes in the incomplete word.
+ * @param   byte        Value of the bytes.
+ * @param   count       Number of bytes.
+ * @return  Updated register value.
+ */
+static uint64_t _update_fill(const calc_crc_t *crc, uint64_t reg, uint32_t *tail, uint8_t *tail_length, uint8_t byte,
+                             size_t count);
+
+/**
+ * @brief   Load a value with the given size.
+ * @param   value       Pointer to the value.
+ * @param   size        Size of the value in bytes (1, 2, 4 or 8).
+ * @return  Loaded value.
+ */
+static uint64_t _load_value(const void *value, uint8_t size);
+
+/**
+ * @brief   Store a value with the given size.
+ * @param   result      Pointer to store the value.
+ * @param   value       Value.
+ * @param   size        Size of the value in bytes (1, 2, 4 or 8).
+ */
+static void _store_value(void *result, uint64_t value, uint8_t size);
+
+/**
+ * @brief   Finalize the raw register and store the CRC value with the width of the instance type.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   reg         Register value.
+ * @param   result      Pointer to store the final CRC value.
+ */
+static void _final_crc(const calc_crc_t *crc, uint64_t reg, void *result);
+
+/**
+ * @brief   Check data segments of a vectored calculation.
+ * @param   iov         Array of data segments.
+ * @param   count       Number of data segments.
+ * @return  True if every segment with data has a buffer.
+ */
+static bool _valid_vec(const calc_crc_iovec_t *iov, size_t count);
+
+/**
+ * @brief   Slide the window of a rolling CRC by one byte.
+ * @param   rolling     Pointer to the rolling CRC.
+ * @param   reg         Raw register of the current window.
+ * @param   out         Byte leaving the window.
+ * @param   in          Byte entering the window.
+ * @return  Raw register of the next window.
+ */
+static inline uint64_t _roll_crc(const calc_crc_rolling_t *rolling, uint64_t reg, uint8_t out, uint8_t in);
+
+/**
+ * @brief   Map a mask and match of CRC values to the raw register of a rolling CRC.
+ * @param   rolling     Pointer to the rolling CRC.
+ * @param   mask        Mask of the compared CRC value bits.
+ * @param   match       Value of the compared bits.
+ * @param   reg_mask    Pointer to store the mask of the compared register bits.
+ * @param   reg_match   Pointer to store the value of the compared register bits.
+ * @return  True if some CRC value can match, false otherwise.
+ */
+static bool _rolling_mask(const calc_crc_rolling_t *rolling, uint64_t mask, uint64_t match, uint64_t *reg_mask,
+                          uint64_t *reg_match);
+
+// --- Private Variables -----------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Kernel tier forced with CALC_CRC_SetKernel or environment variable (-1 = not read yet), accessed atomically.
+ */
+static int8_t _kernel_force = -1;
+
+/**
+ * @brief   Parameters of checksum types (indexed from CALC_CRC_TYPE_SUM8).
+ */
+static const calc_crc_sum_t _sums[CALC_CRC_TYPE_MAX - CALC_CRC_TYPE_SUM8] = {
+    [CALC_CRC_TYPE_SUM8 - CALC_CRC_TYPE_SUM8] = {1u, 0u, sizeof(uint8_t), false, false, 256u},
+    [CALC_CRC_TYPE_LRC8 - CALC_CRC_TYPE_SUM8] = {1u, 0u, sizeof(uint8_t), true, false, 256u},
+    [CALC_CRC_TYPE_FLETCHER16 - CALC_CRC_TYPE_SUM8] = {1u, 8u, sizeof(uint16_t), false, false, 255u},
+    [CALC_CRC_TYPE_FLETCHER32 - CALC_CRC_TYPE_SUM8] = {2u, 16u, sizeof(uint32_t), false, false, 65535u},
+    [CALC_CRC_TYPE_FLETCHER64 - CALC_CRC_TYPE_SUM8] = {4u, 32u, sizeof(uint64_t), false, false, 4294967295u},
+    [CALC_CRC_TYPE_ADLER32 - CALC_CRC_TYPE_SUM8] = {1u, 16u, sizeof(uint32_t), false, false, 65521u},
+    [CALC_CRC_TYPE_INET16 - CALC_CRC_TYPE_SUM8] = {2u, 0u, sizeof(uint16_t), false, true, 65535u},
+};
+
+#if (1 == CALC_CRC_HW_X86)
+
+/**
+ * @brief   Shift tables of CRC-32C register over long and short stream blocks.
+ */
+static uint32_t _crc32c_shift_long[4][256];
+static uint32_t _crc32c_shift_short[4][256];
+static uint8_t _crc32c_shift_once = CALC_CRC_ONCE_NONE;
+
+/**
+ * @brief   CPU feature flags (CPUID leaf 1, register ECX) and AVX2 support, valid after _cpu_detect.
+ */
+static uint32_t _cpu_ecx;
+static bool _cpu_avx2;
+static uint8_t _cpu_once = CALC_CRC_ONCE_NONE;
+
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+calc_crc_status_e CALC_CRC_Init(calc_crc_t *crc, void *conf, calc_crc_type_e type)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(conf, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    MEMSET(crc, 0, sizeof(calc_crc_t));
+
+    crc->type = type;
+    crc->conf = conf;
+
+    switch (type)
+    {
+        case CALC_CRC_TYPE_8BIT: //
+        {
+            calc_crc_8bit_t *ptr = (calc_crc_8bit_t *)crc->conf;
+            uint8_t width = (0u == ptr->width) ? 8u : ptr->width;
+            uint8_t polynomial = (uint8_t)(ptr->polynomial << ((8u < width) ? 0u : (8u - width)));
+            uint8_t engine = _engine_select(ptr->engine);
+            const calc_crc_8bit_tables_t *tables = (CALC_CRC_ENGINE_TABLE == engine) ? ptr->tables : NULL;
+            bool rom_slices = (NULL != tables) && (NULL != tables->slice_table) && (tables->slices == ptr->slices);
+            if ((CALC_CRC_ENGINE_MAX <= engine) || (8u < width) || (false == _is_valid_slices(ptr->slices)) ||
+                ((1u < ptr->slices) && (false == rom_slices) && (NULL == ptr->slice_table)) ||
+                ((NULL != tables) &&
+                 ((tables->polynomial != polynomial) || (tables->reflected != ptr->input_reflected))))
+            {
+                return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+            }
+            crc->reflected_table = ptr->input_reflected;
+            crc->engine = engine;
+            crc->shift = (uint8_t)(8u - width);
+            crc->slices = ((CALC_CRC_ENGINE_TABLE == engine) && (1u < ptr->slices)) ? ptr->slices : 1u;
+            // Precomputed read-only tables are used as they are, otherwise tables are generated into configuration.
+            if ((NULL == tables) && (CALC_CRC_ENGINE_TABLE == engine))
+            {
+                _calc_table_crc8(ptr->table, polynomial, ptr->input_reflected);
+            }
+            else if (CALC_CRC_ENGINE_NIBBLE == engine)
+            {
+                _calc_nibble_crc8(ptr->table, polynomial, ptr->input_reflected);
+            }
+            if (NULL == tables)
+            {
+                _calc_fold_constants(ptr->fold_constants, polynomial, 8, ptr->input_reflected);
+            }
+            crc->table = (NULL != tables) ? tables->table : ptr->table;
+            crc->fold_constants = (NULL != tables) ? tables->fold_constants : ptr->fold_constants;
+            if (false == rom_slices)
+            {
+                _calc_slice_table_crc8((const uint8_t *)crc->table, ptr->slice_table, crc->slices,
+                                       ptr->input_reflected);
+            }
+            crc->slice_table = (true == rom_slices) ? tables->slice_table : ptr->slice_table;
+            crc->kernel = _bind_kernel(crc, false);
+            break;
+        }
+        case CALC_CRC_TYPE_16BIT: //
+        {
+            calc_crc_16bit_t *ptr = (calc_crc_16bit_t *)crc->conf;
+            uint8_t width = (0u == ptr->width) ? 16u : ptr->width;
+            uint16_t polynomial = (uint16_t)(ptr->polynomial << ((16u < width) ? 0u : (16u - width)));
+            uint8_t engine = _engine_select(ptr->engine);
+            const calc_crc_16bit_tables_t *tables = (CALC_CRC_ENGINE_TABLE == engine) ? ptr->tables : NULL;
+            bool rom_slices = (NULL != tables) && (NULL != tables->slice_table) && (tables->slices == ptr->slices);
+            if ((CALC_CRC_ENGINE_MAX <= engine) || (16u < width) || (false == _is_valid_slices(ptr->slices)) ||
+                ((1u < ptr->slices) && (false == rom_slices) && (NULL == ptr->slice_table)) ||
+                ((NULL != tables) &&
+                 ((tables->polynomial != polynomial) || (tables->reflected != ptr->input_reflected))))
+            {
+                return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+            }
+            crc->reflected_table = ptr->input_reflected;
+            crc->engine = engine;
+            crc->shift = (uint8_t)(16u - width);
+            crc->slices = ((CALC_CRC_ENGINE_TABLE == engine) && (1u < ptr->slices)) ? ptr->slices : 1u;
+            // Precomputed read-only tables are used as they are, otherwise tables are generated into configuration.
+            if ((NULL == tables) && (CALC_CRC_ENGINE_TABLE == engine))
+            {
+                _calc_table_crc16(ptr->table, polynomial, ptr->input_reflected);
+            }
+            else if (CALC_CRC_ENGINE_NIBBLE == engine)
+            {
+                _calc_nibble_crc16(ptr->table, polynomial, ptr->input_reflected);
+            }
+            if (NULL == tables)
+            {
+                _calc_fold_constants(ptr->fold_constants, polynomial, 16, ptr->input_reflected);
+            }
+            crc->table = (NULL != tables) ? tables->table : ptr->table;
+            crc->fold_constants = (NULL != tables) ? tables->fold_constants : ptr->fold_constants;
+            if (false == rom_slices)
+            {
+                _calc_slice_table_crc16((const uint16_t *)crc->table, ptr->slice_table, crc->slices,
+                                        ptr->input_reflected);
+            }
+            crc->slice_table = (true == rom_slices) ? tables->slice_table : ptr->slice_table;
+            crc->kernel = _bind_kernel(crc, false);
+            break;
+        }
+        case CALC_CRC_TYPE_32BIT: //
+        {
+            calc_crc_32bit_t *ptr = (calc_crc_32bit_t *)crc->conf;
+            uint8_t width = (0u == ptr->width) ? 32u : ptr->width;
+            uint32_t polynomial = (uint32_t)(ptr->polynomial << ((32u < width) ? 0u : (32u - width)));
+            uint8_t engine = _engine_select(ptr->engine);
+            const calc_crc_32bit_tables_t *tables = (CALC_CRC_ENGINE_TABLE == engine) ? ptr->tables : NULL;
+            bool rom_slices = (NULL != tables) && (NULL != tables->slice_table) && (tables->slices == ptr->slices);
+            if ((CALC_CRC_ENGINE_MAX <= engine) || (32u < width) || (false == _is_valid_slices(ptr->slices)) ||
+                ((1u < ptr->slices) && (false == rom_slices) && (NULL == ptr->slice_table)) ||
+                ((NULL != tables) &&
+                 ((tables->polynomial != polynomial) || (tables->reflected != ptr->input_reflected))))
+            {
+                return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+            }
+            crc->reflected_table = ptr->input_reflected;
+            crc->engine = engine;
+            crc->shift = (uint8_t)(32u - width);
+            crc->slices = ((CALC_CRC_ENGINE_TABLE == engine) && (1u < ptr->slices)) ? ptr->slices : 1u;
+            // Precomputed read-only tables are used as they are, otherwise tables are generated into configuration.
+            if ((NULL == tables) && (CALC_CRC_ENGINE_TABLE == engine))
+            {
+                _calc_table_crc32(ptr->table, polynomial, ptr->input_reflected);
+            }
+            else if (CALC_CRC_ENGINE_NIBBLE == engine)
+            {
+                _calc_nibble_crc32(ptr->table, polynomial, ptr->input_reflected);
+            }
+            if (NULL == tables)
+            {
+                _calc_fold_constants(ptr->fold_constants, polynomial, 32, ptr->input_reflected);
+            }
+            crc->table = (NULL != tables) ? tables->table : ptr->table;
+            crc->fold_constants = (NULL != tables) ? tables->fold_constants : ptr->fold_constants;
+            if (false == rom_slices)
+            {
+                _calc_slice_table_crc32((const uint32_t *)crc->table, ptr->slice_table, crc->slices,
+                                        ptr->input_reflected);
+            }
+            crc->slice_table = (true == rom_slices) ? tables->slice_table : ptr->slice_table;
+            crc->kernel = _bind_kernel(crc, (true == ptr->input_reflected) && (0u == crc->shift) &&
+                                                (CALC_CRC_CRC32C_POLYNOMIAL == polynomial));
+#if (1 == CALC_CRC_HW_X86)
+            if (CALC_CRC_KERNEL_SSE42 == crc->kernel)
+            {
+                _crc32c_shift_init();
+            }
+#endif /* (1 == CALC_CRC_HW_X86) */
+            break;
+        }
+        case CALC_CRC_TYPE_64BIT: //
+        {
+            calc_crc_64bit_t *ptr = (calc_crc_64bit_t *)crc->conf;
+            uint8_t width = (0u == ptr->width) ? 64u : ptr->width;
+            uint64_t polynomial = (uint64_t)(ptr->polynomial << ((64u < width) ? 0u : (64u - width)));
+            uint8_t engine = _engine_select(ptr->engine);
+            const calc_crc_64bit_tables_t *tables = (CALC_CRC_ENGINE_TABLE == engine) ? ptr->tables : NULL;
+            bool rom_slices = (NULL != tables) && (NULL != tables->slice_table) && (tables->slices == ptr->slices);
+            if ((CALC_CRC_ENGINE_MAX <= engine) || (64u < width) || (false == _is_valid_slices(ptr->slices)) ||
+                ((1u < ptr->slices) && (false == rom_slices) && (NULL == ptr->slice_table)) ||
+                ((NULL != tables) &&
+                 ((tables->polynomial != polynomial) || (tables->reflected != ptr->input_reflected))))
+            {
+                return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+            }
+            crc->reflected_table = ptr->input_reflected;
+            crc->engine = engine;
+            crc->shift = (uint8_t)(64u - width);
+            crc->slices = ((CALC_CRC_ENGINE_TABLE == engine) && (1u < ptr->slices)) ? ptr->slices : 1u;
+            // Precomputed read-only tables are used as they are, otherwise tables are generated into configuration.
+            if ((NULL == tables) && (CALC_CRC_ENGINE_TABLE == engine))
+            {
+                _calc_table_crc64(ptr->table, polynomial, ptr->input_reflected);
+            }
+            else if (CALC_CRC_ENGINE_NIBBLE == engine)
+            {
+                _calc_nibble_crc64(ptr->table, polynomial, ptr->input_reflected);
+            }
+            if (NULL == tables)
+            {
+                _calc_fold_constants(ptr->fold_constants, polynomial, 64, ptr->input_reflected);
+            }
+            crc->table = (NULL != tables) ? tables->table : ptr->table;
+            crc->fold_constants = (NULL != tables) ? tables->fold_constants : ptr->fold_constants;
+            if (false == rom_slices)
+            {
+                _calc_slice_table_crc64((const uint64_t *)crc->table, ptr->slice_table, crc->slices,
+                                        ptr->input_reflected);
+            }
+            crc->slice_table = (true == rom_slices) ? tables->slice_table : ptr->slice_table;
+            crc->kernel = _bind_kernel(crc, false);
+            break;
+        }
+        default: // -------------------- Checksums
+        {
+            crc->slices = 1u;
+            crc->kernel = _bind_sum_kernel();
+            break;
+        }
+    }
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_Calculate(calc_crc_t *crc, const void *data, size_t length, void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(length, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    switch (crc->type)
+    {
+        case CALC_CRC_TYPE_8BIT: // ---- 8-bit calculator
+        {
+            calc_crc_8bit_t *conf = (calc_crc_8bit_t *)crc->conf;
+            uint8_t *calc = (uint8_t *)result;
+            *calc = _calc_crc8(crc, conf, data, length);
+            break;
+        }
+        case CALC_CRC_TYPE_16BIT: // --- 16-bit calculator
+        {
+            calc_crc_16bit_t *conf = (calc_crc_16bit_t *)crc->conf;
+            uint16_t *calc = (uint16_t *)result;
+            *calc = _calc_crc16(crc, conf, data, length);
+            break;
+        }
+        case CALC_CRC_TYPE_32BIT: // --- 32-bit calculator
+        {
+            calc_crc_32bit_t *conf = (calc_crc_32bit_t *)crc->conf;
+            uint32_t *calc = (uint32_t *)result;
+            *calc = _calc_crc32(crc, conf, data, length);
+            break;
+        }
+        case CALC_CRC_TYPE_64BIT: // --- 64-bit calculator
+        {
+            calc_crc_64bit_t *conf = (calc_crc_64bit_t *)crc->conf;
+            uint64_t *calc = (uint64_t *)result;
+            *calc = _calc_crc64(crc, conf, data, length);
+            break;
+        }
+        default: // -------------------- Checksums
+        {
+            uint32_t tail = 0u;
+            uint8_t tail_length = 0u;
+            uint64_t reg = _update_tail(crc, _initial_sum(crc), &tail, &tail_length, (const uint8_t *)data, length);
+            _final_crc(crc, _flush_tail(crc, reg, &tail, &tail_length), result);
+            break;
+        }
+    }
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_CalculateBatch(calc_crc_t *crc, const void *const *data, const size_t *length, void *result,
+                                          size_t count)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(length, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(count, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    // All buffers are checked once upfront, nothing is calculated if any of them is invalid.
+    for (size_t i = 0; i < count; i++)
+    {
+        CHECK_ARGS_NULL_PTR(data[i], CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+        CHECK_ARGS_SIZE(length[i], 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    }
+
+    switch (crc->type)
+    {
+        case CALC_CRC_TYPE_8BIT: // ---- 8-bit calculator
+        {
+            _batch_crc8(crc, (calc_crc_8bit_t *)crc->conf, data, length, (uint8_t *)result, count);
+            break;
+        }
+        case CALC_CRC_TYPE_16BIT: // --- 16-bit calculator
+        {
+            _batch_crc16(crc, (calc_crc_16bit_t *)crc->conf, data, length, (uint16_t *)result, count);
+            break;
+        }
+        case CALC_CRC_TYPE_32BIT: // --- 32-bit calculator
+        {
+            _batch_crc32(crc, (calc_crc_32bit_t *)crc->conf, data, length, (uint32_t *)result, count);
+            break;
+        }
+        case CALC_CRC_TYPE_64BIT: // --- 64-bit calculator
+        {
+            _batch_crc64(crc, (calc_crc_64bit_t *)crc->conf, data, length, (uint64_t *)result, count);
+            break;
+        }
+        default: // -------------------- Checksums
+        {
+            // Checksum kernels are bound by memory bandwidth, buffers are calculated one after another.
+            for (size_t i = 0; i < count; i++)
+            {
+                CALC_CRC_Calculate(crc, data[i], length[i], (uint8_t *)result + (i * _sum_params(crc->type)->size));
+            }
+            break;
+        }
+    }
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_Start(calc_crc_t *crc)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    crc->update_crc = _initial_crc(crc);
+    crc->update_chunk = (size_t)0u;
+    crc->update_in_progress = true;
+    crc->update_tail = 0u;
+    crc->update_tail_length = 0u;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_Update(calc_crc_t *crc, const void *data, size_t length)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(length, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    // Context holds the raw register between chunks, finalization is applied only once in CALC_CRC_Finalize.
+    uint64_t reg = (true == crc->update_in_progress) ? crc->update_crc : _initial_crc(crc);
+
+    if (false == crc->update_in_progress)
+    {
+        crc->update_tail = 0u;
+        crc->update_tail_length = 0u;
+    }
+
+    crc->update_crc = _update_tail(crc, reg, &crc->update_tail, &crc->update_tail_length, (const uint8_t *)data,
+                                   length);
+    crc->update_chunk = (true == crc->update_in_progress) ? (crc->update_chunk + 1u) : 1u;
+    crc->update_in_progress = true;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_UpdateFill(calc_crc_t *crc, uint8_t byte, size_t count)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(count, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    uint64_t reg = (true == crc->update_in_progress) ? crc->update_crc : _initial_crc(crc);
+
+    if (false == crc->update_in_progress)
+    {
+        crc->update_tail = 0u;
+        crc->update_tail_length = 0u;
+    }
+
+    crc->update_crc = _update_fill(crc, reg, &crc->update_tail, &crc->update_tail_length, byte, count);
+    crc->update_chunk = (true == crc->update_in_progress) ? (crc->update_chunk + 1u) : 1u;
+    crc->update_in_progress = true;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_Finalize(calc_crc_t *crc, void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (false == crc->update_in_progress)
+    {
+        return CALC_CRC_STATUS_ERROR_UPDATE_NOT_STARTED;
+    }
+
+    _final_crc(crc, _flush_tail(crc, crc->update_crc, &crc->update_tail, &crc->update_tail_length), result);
+    crc->update_in_progress = false;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_CalculateVec(calc_crc_t *crc, const calc_crc_iovec_t *iov, size_t count, void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(iov, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(count, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    if (false == _valid_vec(iov, count))
+    {
+        return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    uint32_t tail = 0u;
+    uint8_t tail_length = 0u;
+    uint64_t reg = _update_vec(crc, _initial_crc(crc), &tail, &tail_length, iov, count);
+
+    _final_crc(crc, _flush_tail(crc, reg, &tail, &tail_length), result);
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_UpdateVec(calc_crc_t *crc, const calc_crc_iovec_t *iov, size_t count)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(iov, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(count, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    if (false == _valid_vec(iov, count))
+    {
+        return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    uint64_t reg = (true == crc->update_in_progress) ? crc->update_crc : _initial_crc(crc);
+
+    if (false == crc->update_in_progress)
+    {
+        crc->update_tail = 0u;
+        crc->update_tail_length = 0u;
+    }
+
+    crc->update_crc = _update_vec(crc, reg, &crc->update_tail, &crc->update_tail_length, iov, count);
+    crc->update_chunk = (true == crc->update_in_progress) ? (crc->update_chunk + 1u) : 1u;
+    crc->update_in_progress = true;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_Combine(calc_crc_t *crc, const void *crc_a, const void *crc_b, size_t length_b,
+                                   void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(crc_a, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(crc_b, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    switch (crc->type)
+    {
+        case CALC_CRC_TYPE_8BIT: // ---- 8-bit calculator
+        {
+            calc_crc_8bit_t *conf = (calc_crc_8bit_t *)crc->conf;
+            uint8_t *output = (uint8_t *)result;
+            *output = (uint8_t)_combine(conf->polynomial, conf->initial_value, conf->final_value,
+                                        conf->output_reflected, (uint8_t)(8u - crc->shift), *(const uint8_t *)crc_a,
+                                        *(const uint8_t *)crc_b, length_b);
+            break;
+        }
+        case CALC_CRC_TYPE_16BIT: // --- 16-bit calculator
+        {
+            calc_crc_16bit_t *conf = (calc_crc_16bit_t *)crc->conf;
+            uint16_t *output = (uint16_t *)result;
+            *output = (uint16_t)_combine(conf->polynomial, conf->initial_value, conf->final_value,
+                                         conf->output_reflected, (uint8_t)(16u - crc->shift), *(const uint16_t *)crc_a,
+                                         *(const uint16_t *)crc_b, length_b);
+            break;
+        }
+        case CALC_CRC_TYPE_32BIT: // --- 32-bit calculator
+        {
+            calc_crc_32bit_t *conf = (calc_crc_32bit_t *)crc->conf;
+            uint32_t *output = (uint32_t *)result;
+            *output = (uint32_t)_combine(conf->polynomial, conf->initial_value, conf->final_value,
+                                         conf->output_reflected, (uint8_t)(32u - crc->shift), *(const uint32_t *)crc_a,
+                                         *(const uint32_t *)crc_b, length_b);
+            break;
+        }
+        case CALC_CRC_TYPE_64BIT: // --- 64-bit calculator
+        {
+            calc_crc_64bit_t *conf = (calc_crc_64bit_t *)crc->conf;
+            uint64_t *output = (uint64_t *)result;
+            *output = _combine(conf->polynomial, conf->initial_value, conf->final_value, conf->output_reflected,
+                               (uint8_t)(64u - crc->shift), *(const uint64_t *)crc_a, *(const uint64_t *)crc_b,
+                               length_b);
+            break;
+        }
+        default: // -------------------- Checksums
+        {
+            uint8_t size = _sum_params(crc->type)->size;
+            _store_value(result, _combine_sum(crc, _load_value(crc_a, size), _load_value(crc_b, size), length_b), size);
+            break;
+        }
+    }
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_Adjust(const calc_crc_t *crc, const void *value, size_t offset, const void *old_data,
+                                  const void *new_data, size_t length, void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(value, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(old_data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(new_data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_INET16 != crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    *(uint16_t *)result = (uint16_t)_adjust_inet(*(const uint16_t *)value, offset, (const uint8_t *)old_data,
+                                                 (const uint8_t *)new_data, length);
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_Patch(const calc_crc_t *crc, const void *value, size_t length, size_t offset,
+                                 const void *old_data, const void *new_data, size_t patch_length, void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(value, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(old_data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(new_data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+    if ((patch_length > length) || (offset > (length - patch_length)))
+    {
+        return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    const uint8_t *old_bytes = (const uint8_t *)old_data;
+    const uint8_t *new_bytes = (const uint8_t *)new_data;
+    uint8_t size = _value_size(crc->type);
+    uint64_t patched;
+
+    if (CALC_CRC_TYPE_SUM8 > crc->type)
+    {
+        uint8_t delta[CALC_CRC_PATCH_BLOCK];
+        uint64_t reg = 0u;
+        uint64_t final_delta = 0u;
+        uint64_t final_zero = 0u;
+
+        // CRC is linear: CRC(new) = CRC(old) ^ CRC of the difference with zero initial and final value. Difference
+        // is zero before the patch (no effect on a zero register) and after it (register shifted over zero bytes).
+        for (size_t i = 0; i < patch_length; i += CALC_CRC_PATCH_BLOCK)
+        {
+            size_t block = ((patch_length - i) < CALC_CRC_PATCH_BLOCK) ? (patch_length - i) : CALC_CRC_PATCH_BLOCK;
+            for (size_t k = 0; k < block; k++)
+            {
+                delta[k] = old_bytes[i + k] ^ new_bytes[i + k];
+            }
+            reg = _update_crc(crc, reg, delta, block);
+        }
+        reg = _shift_crc(crc, reg, length - offset - patch_length);
+
+        // Final XOR value is applied to both finalized registers and cancels out.
+        _final_crc(crc, reg, &final_delta);
+        _final_crc(crc, 0u, &final_zero);
+        patched = _load_value(value, size) ^ _load_value(&final_delta, size) ^ _load_value(&final_zero, size);
+    }
+    else if (true == _sum_params(crc->type)->ones)
+    {
+        patched = _adjust_inet(_load_value(value, size), offset, old_bytes, new_bytes, patch_length);
+    }
+    else
+    {
+        patched = _patch_sum(crc, _load_value(value, size), length, offset, old_bytes, new_bytes, patch_length);
+    }
+
+    _store_value(result, patched, size);
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_ExtendFill(calc_crc_t *crc, const void *value, uint8_t byte, size_t count, void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(value, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(count, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    uint32_t tail = 0u;
+    uint8_t tail_length = 0u;
+    uint64_t fill = 0u;
+
+    // Value of the run alone is combined with the given value, both in O(log count).
+    uint64_t reg = _update_fill(crc, _initial_crc(crc), &tail, &tail_length, byte, count);
+    _final_crc(crc, _flush_tail(crc, reg, &tail, &tail_length), &fill);
+
+    return CALC_CRC_Combine(crc, value, &fill, count, result);
+}
+
+calc_crc_status_e CALC_CRC_RollingInit(calc_crc_rolling_t *rolling, const calc_crc_t *crc, size_t window)
+{
+    CHECK_ARGS_NULL_PTR(rolling, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(window, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    // Checksums are not rolled, bytes leaving the window would need their position in the word.
+    if (CALC_CRC_TYPE_SUM8 <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    uint8_t width = (uint8_t)((8u << crc->type) - crc->shift);
+    uint64_t polynomial = _crc_polynomial(crc);
+    uint64_t initial = _initial_crc(crc);
+
+    MEMSET(rolling, 0, sizeof(calc_crc_rolling_t));
+
+    rolling->crc = crc;
+    rolling->window = window;
+    rolling->bits = (uint8_t)(8u << crc->type);
+    rolling->mask = (CALC_CRC_TYPE_64BIT == crc->type) ? UINT64_MAX : (((uint64_t)1u << rolling->bits) - 1u);
+    rolling->reflected = crc->reflected_table;
+
+    // Byte leaving the window was shifted by x^(8 * window) and the initial register by one more byte.
+    uint64_t shift = _xpow_mod(8u * (uint64_t)window, polynomial, width);
+    uint64_t correction = _shift_crc(crc, initial, window) ^ _shift_crc(crc, initial, (uint64_t)window + 1u);
+
+    for (size_t i = 0; i < CALC_CRC_ROLLING_ENTRIES; i++)
+    {
+        uint8_t byte = (uint8_t)i;
+        uint64_t reg = _update_crc(crc, 0u, &byte, 1);
+
+        rolling->table[i] = reg;
+        rolling->out_table[i] =
+            _rem_to_reg(crc, _mul_mod(_reg_to_rem(crc, reg), shift, polynomial, width)) ^ correction;
+    }
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_RollingStart(calc_crc_rolling_t *rolling, const void *data)
+{
+    CHECK_ARGS_NULL_PTR(rolling, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rolling->crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    rolling->reg = _update_crc(rolling->crc, _initial_crc(rolling->crc), (const uint8_t *)data, rolling->window);
+    rolling->started = true;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_RollingRoll(calc_crc_rolling_t *rolling, uint8_t out, uint8_t in)
+{
+    CHECK_ARGS_NULL_PTR(rolling, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (false == rolling->started)
+    {
+        return CALC_CRC_STATUS_ERROR_UPDATE_NOT_STARTED;
+    }
+
+    rolling->reg = _roll_crc(rolling, rolling->reg, out, in);
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_RollingGet(const calc_crc_rolling_t *rolling, void *result)
+{
+    CHECK_ARGS_NULL_PTR(rolling, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (false == rolling->started)
+    {
+        return CALC_CRC_STATUS_ERROR_UPDATE_NOT_STARTED;
+    }
+
+    _final_crc(rolling->crc, rolling->reg, result);
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_RollingScan(const calc_crc_rolling_t *rolling, const void *data, size_t length,
+                                       uint64_t mask, uint64_t match, size_t *positions, size_t capacity,
+                                       size_t *found)
+{
+    CHECK_ARGS_NULL_PTR(rolling, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rolling->crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(positions, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(found, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(capacity, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    const uint8_t *bytes = (const uint8_t *)data;
+    size_t window = rolling->window;
+    uint64_t reg_mask = 0u;
+    uint64_t reg_match = 0u;
+    size_t count = 0;
+
+    *found = 0;
+    if ((length < window) || (false == _rolling_mask(rolling, mask, match, &reg_mask, &reg_match)))
+    {
+        return CALC_CRC_STATUS_OK;
+    }
+
+    // Compared bits are mapped to the raw register once, windows are not finalized.
+    uint64_t reg = _update_crc(rolling->crc, _initial_crc(rolling->crc), bytes, window);
+    const uint64_t *table = rolling->table;
+    const uint64_t *out_table = rolling->out_table;
+    uint64_t reg_bits = rolling->mask;
+    uint8_t top = (uint8_t)(rolling->bits - 8u);
+    bool reflected = rolling->reflected;
+
+    // Parameters are held in locals, stored positions could alias the rolling CRC and force reloads every byte.
+    for (size_t p = window;; p++)
+    {
+        if (reg_match == (reg & reg_mask))
+        {
+            positions[count] = p;
+            count++;
+            if (capacity == count)
+            {
+                break;
+            }
+        }
+        if (length == p)
+        {
+            break;
+        }
+        if (true == reflected)
+        {
+            reg = (reg >> 8) ^ table[(reg ^ bytes[p]) & 0xFFu];
+        }
+        else
+        {
+            reg = ((reg << 8) & reg_bits) ^ table[((reg >> top) ^ bytes[p]) & 0xFFu];
+        }
+        reg ^= out_table[bytes[p - window]];
+    }
+
+    *found = count;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_SetKernel(calc_crc_kernel_e kernel)
+{
+    if (CALC_CRC_KERNEL_MAX <= kernel)
+    {
+        return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    __atomic_store_n(&_kernel_force, (int8_t)kernel, __ATOMIC_RELEASE);
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_GetKernel(const calc_crc_t *crc, calc_crc_kernel_e *kernel)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(kernel, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    *kernel = crc->kernel;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+static void _calc_table_crc8(uint8_t *table, uint8_t polynomial, bool reflected)
+{
+    if (true == reflected)
+    {
+        uint8_t reflected_polynomial = _reflect_crc8(polynomial);
+
+        for (size_t dividend = 0; dividend < 256; dividend++)
+        {
+            uint8_t cbyte = (uint8_t)dividend;
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                if ((cbyte & 0x01) != 0)
+                {
+                    cbyte >>= 1;
+                    cbyte ^= reflected_polynomial;
+                }
+                else
+                {
+                    cbyte >>= 1;
+                }
+            }
+
+            table[dividend] = cbyte;
+        }
+
+        return;
+    }
+
+    for (size_t dividend = 0; dividend < 256; dividend++)
+    {
+        uint8_t cbyte = (uint8_t)dividend;
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            if ((cbyte & 0x80) != 0)
+            {
+                cbyte <<= 1;
+                cbyte ^= polynomial;
+            }
+            else
+            {
+                cbyte <<= 1;
+            }
+        }
+
+        table[dividend] = cbyte;
+    }
+}
+
+static void _calc_table_crc16(uint16_t *table, uint16_t polynomial, bool reflected)
+{
+    if (true == reflected)
+    {
+        uint16_t reflected_polynomial = _reflect_crc16(polynomial);
+
+        for (size_t dividend = 0; dividend < 256; dividend++)
+        {
+            uint16_t cbyte = (uint16_t)dividend;
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                if ((cbyte & 0x01) != 0)
+                {
+                    cbyte >>= 1;
+                    cbyte ^= reflected_polynomial;
+                }
+                else
+                {
+                    cbyte >>= 1;
+                }
+            }
+
+            table[dividend] = cbyte;
+        }
+
+        return;
+    }
+
+    for (size_t dividend = 0; dividend < 256; dividend++)
+    {
+        uint16_t cbyte = (uint16_t)(dividend << 8);
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            if ((cbyte & 0x8000) != 0)
+            {
+                cbyte <<= 1;
+                cbyte ^= polynomial;
+            }
+            else
+            {
+                cbyte <<= 1;
+            }
+        }
+
+        table[dividend] = cbyte;
+    }
+}
+
+static void _calc_table_crc32(uint32_t *table, uint32_t polynomial, bool reflected)
+{
+    if (true == reflected)
+    {
+        uint32_t reflected_polynomial = _reflect_crc32(polynomial);
+
+        for (size_t dividend = 0; dividend < 256; dividend++)
+        {
+            uint32_t cbyte = (uint32_t)dividend;
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                if ((cbyte & 0x01) != 0)
+                {
+                    cbyte >>= 1;
+                    cbyte ^= reflected_polynomial;
+                }
+                else
+                {
+                    cbyte >>= 1;
+                }
+            }
+
+            table[dividend] = cbyte;
+        }
+
+        return;
+    }
+
+    for (size_t dividend = 0; dividend < 256; dividend++)
+    {
+        uint32_t cbyte = (uint32_t)(dividend << 24);
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            if ((cbyte & 0x80000000) != 0)
+            {
+                cbyte <<= 1;
+                cbyte ^= polynomial;
+            }
+            else
+            {
+                cbyte <<= 1;
+            }
+        }
+
+        table[dividend] = cbyte;
+    }
+}
+
+static void _calc_table_crc64(uint64_t *table, uint64_t polynomial, bool reflected)
+{
+    if (true == reflected)
+    {
+        uint64_t reflected_polynomial = _reflect_crc64(polynomial);
+
+        for (size_t dividend = 0; dividend < 256; dividend++)
+        {
+            uint64_t cbyte = (uint64_t)dividend;
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                if ((cbyte & 0x01) != 0)
+                {
+                    cbyte >>= 1;
+                    cbyte ^= reflected_polynomial;
+                }
+                else
+                {
+                    cbyte >>= 1;
+                }
+            }
+
+            table[dividend] = cbyte;
+        }
+
+        return;
+    }
+
+    for (size_t dividend = 0; dividend < 256; dividend++)
+    {
+        uint64_t cbyte = (uint64_t)dividend << 56;
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            if ((cbyte & 0x8000000000000000) != 0)
+            {
+                cbyte <<= 1;
+                cbyte ^= polynomial;
+            }
+            else
+            {
+                cbyte <<= 1;
+            }
+        }
+
+        table[dividend] = cbyte;
+    }
+}
+
+static void _calc_nibble_crc8(uint8_t *table, uint8_t polynomial, bool reflected)
+{
+    uint8_t reflected_polynomial = _reflect_crc8(polynomial);
+
+    for (size_t dividend = 0; dividend < 16; dividend++)
+    {
+        uint8_t reg = (true == reflected) ? (uint8_t)dividend : (uint8_t)((uint8_t)dividend << (8u - 4u));
+
+        for (uint8_t bit = 0; bit < 4; bit++)
+        {
+            if (true == reflected)
+            {
+                reg = ((reg & 0x01u) != 0) ? (uint8_t)((reg >> 1) ^ reflected_polynomial) : (uint8_t)(reg >> 1);
+            }
+            else
+            {
+                reg = ((reg & 0x80) != 0) ? (uint8_t)((uint8_t)(reg << 1) ^ polynomial) : (uint8_t)(reg << 1);
+            }
+        }
+
+        table[dividend] = reg;
+    }
+}
+
+static void _calc_nibble_crc16(uint16_t *table, uint16_t polynomial, bool reflected)
+{
+    uint16_t reflected_polynomial = _reflect_crc16(polynomial);
+
+    for (size_t dividend = 0; dividend < 16; dividend++)
+    {
+        uint16_t reg = (true == reflected) ? (uint16_t)dividend : (uint16_t)((uint16_t)dividend << (16u - 4u));
+
+        for (uint8_t bit = 0; bit < 4; bit++)
+        {
+            if (true == reflected)
+            {
+                reg = ((reg & 0x01u) != 0) ? (uint16_t)((reg >> 1) ^ reflected_polynomial) : (uint16_t)(reg >> 1);
+            }
+            else
+            {
+                reg = ((reg & 0x8000) != 0) ? (uint16_t)((uint16_t)(reg << 1) ^ polynomial) : (uint16_t)(reg << 1);
+            }
+        }
+
+        table[dividend] = reg;
+    }
+}
+
+static void _calc_nibble_crc32(uint32_t *table, uint32_t polynomial, bool reflected)
+{
+    uint32_t reflected_polynomial = _reflect_crc32(polynomial);
+
+    for (size_t dividend = 0; dividend < 16; dividend++)
+    {
+        uint32_t reg = (true == reflected) ? (uint32_t)dividend : (uint32_t)((uint32_t)dividend << (32u - 4u));
+
+        for (uint8_t bit = 0; bit < 4; bit++)
+        {
+            if (true == reflected)
+            {
+                reg = ((reg & 0x01u) != 0) ? (uint32_t)((reg >> 1) ^ reflected_polynomial) : (uint32_t)(reg >> 1);
+            }
+            else
+            {
+                reg = ((reg & 0x80000000u) != 0) ? (uint32_t)((uint32_t)(reg << 1) ^ polynomial) : (uint32_t)(reg << 1);
+            }
+        }
+
+        table[dividend] = reg;
+    }
+}
+
+static void _calc_nibble_crc64(uint64_t *table, uint64_t polynomial, bool reflected)
+{
+    uint64_t reflected_polynomial = _reflect_crc64(polynomial);
+
+    for (size_t dividend = 0; dividend < 16; dividend++)
+    {
+        uint64_t reg = (true == reflected) ? (uint64_t)dividend : (uint64_t)((uint64_t)dividend << (64u - 4u));
+
+        for (uint8_t bit = 0; bit < 4; bit++)
+        {
+            if (true == reflected)
+            {
+                reg = ((reg & 0x01u) != 0) ? (uint64_t)((reg >> 1) ^ reflected_polynomial) : (uint64_t)(reg >> 1);
+            }
+            else
+            {
+                reg = ((reg & 0x8000000000000000u) != 0) ? (uint64_t)((uint64_t)(reg << 1) ^ polynomial)
+                                                         : (uint64_t)(reg << 1);
+            }
+        }
+
+        table[dividend] = reg;
+    }
+}
+
+static uint8_t _calc_crc8(const calc_crc_t *crc, const calc_crc_8bit_t *conf, const uint8_t *data, size_t length)
+{
+    return _final_crc8(crc, conf, _update_crc8(crc, conf, _initial_crc8(crc, conf), data, length));
+}
+
+static uint8_t _initial_crc8(const calc_crc_t *crc, const calc_crc_8bit_t *conf)
+{
+    uint8_t initial = (uint8_t)(conf->initial_value << crc->shift);
+
+    return (true == crc->reflected_table) ? _reflect_crc8(initial) : initial;
+}
+
+static uint8_t _update_crc8(const calc_crc_t *crc, const calc_crc_8bit_t *conf, uint8_t reg, const uint8_t *data,
+                            size_t length)
+{
+    const uint8_t *table = (const uint8_t *)crc->table;
+    bool reflected = crc->reflected_table;
+
+#if (1 == CALC_CRC_HW_X86)
+    if ((conf->input_reflected == reflected) && (CALC_CRC_FOLD_MIN_LENGTH <= length) &&
+        (CALC_CRC_KERNEL_PCLMUL == crc->kernel))
+    {
+        uint8_t residue[16];
+        size_t folded = _fold_pclmul(crc->fold_constants, reflected, 8, reg, data, length, residue);
+
+        // Folded message has the same remainder as consumed data, finish it through the engine.
+        reg = _engine_crc8(crc, 0, residue, sizeof(residue));
+        data += folded;
+        length -= folded;
+    }
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+    if ((conf->input_reflected == reflected) && (CALC_CRC_KERNEL_GENERIC != crc->kernel) && (1u < crc->slices))
+    {
+        reg = _slice_crc8(table, (const uint8_t *)crc->slice_table, crc->slices, reflected, reg, data, length);
+    }
+    else if (conf->input_reflected == reflected)
+    {
+        reg = _engine_crc8(crc, reg, data, length);
+    }
+    else
+    {
+        // Table was generated for other bit order, mirror every byte to match it.
+        for (size_t i = 0; i < length; i++)
+        {
+            uint8_t byte = _reflect_crc8(data[i]);
+            reg = _engine_crc8(crc, reg, &byte, 1);
+        }
+    }
+
+    return reg;
+}
+
+static uint8_t _final_crc8(const calc_crc_t *crc, const calc_crc_8bit_t *conf, uint8_t reg)
+{
+    if (true == crc->reflected_table)
+    {
+        reg = _reflect_crc8(reg);
+    }
+
+    reg = reg ^ (uint8_t)(conf->final_value << crc->shift);
+
+    // Register is left-aligned for narrower CRC widths, reflection moves the value to the low bits.
+    return (true == conf->output_reflected) ? _reflect_crc8(reg) : (uint8_t)(reg >> crc->shift);
+}
+
+static void _batch_crc8(calc_crc_t *crc, calc_crc_8bit_t *conf, const void *const *data, const size_t *length,
+                        uint8_t *result, size_t count)
+{
+    const uint8_t *table = (const uint8_t *)crc->table;
+    bool reflected = crc->reflected_table;
+    size_t i = 0;
+
+    while (i < count)
+    {
+        if ((CALC_CRC_BATCH_LANES > (count - i)) || (conf->input_reflected != reflected) ||
+            (false == _batch_lanes(crc, &length[i])))
+        {
+            result[i] = _calc_crc8(crc, conf, (const uint8_t *)data[i], length[i]);
+            i++;
+            continue;
+        }
+
+        uint8_t init = _initial_crc8(crc, conf);
+        uint8_t reg[CALC_CRC_BATCH_LANES];
+        const uint8_t *ptr[CALC_CRC_BATCH_LANES];
+        size_t common = length[i];
+
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = init;
+            ptr[k] = (const uint8_t *)data[i + k];
+            common = (length[i + k] < common) ? length[i + k] : common;
+        }
+
+        // Common part of all buffers in lockstep (independent dependency chains), then the rest of each buffer.
+        _multi_crc8(table, reg, ptr, common);
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = _kernel_crc8(table, reg[k], &ptr[k][common], length[i + k] - common);
+        }
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            result[i + k] = _final_crc8(crc, conf, reg[k]);
+        }
+
+        i += CALC_CRC_BATCH_LANES;
+    }
+}
+
+static void _multi_crc8(const uint8_t *table, uint8_t *reg, const uint8_t *const *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = _kernel_crc8(table, reg[k], &data[k][i], 1);
+        }
+    }
+}
+
+static uint8_t _kernel_crc8(const uint8_t *table, uint8_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        reg = table[reg ^ data[i]];
+    }
+
+    return reg;
+}
+
+static uint8_t _engine_crc8(const calc_crc_t *crc, uint8_t reg, const uint8_t *data, size_t length)
+{
+    const uint8_t *table = (const uint8_t *)crc->table;
+    bool reflected = crc->reflected_table;
+
+    switch (crc->engine)
+    {
+        case CALC_CRC_ENGINE_NIBBLE: // ---- 16-entry table
+        {
+            return _nibble_crc8(table, reflected, reg, data, length);
+        }
+        case CALC_CRC_ENGINE_BITWISE: // --- No table
+        {
+            const calc_crc_8bit_t *conf = (const calc_crc_8bit_t *)crc->conf;
+            return (uint8_t)_bitwise_crc((uint8_t)(conf->polynomial << crc->shift), 8, reflected, reg, data, length);
+        }
+        default: // -------------------- 256-entry table
+        {
+            return _kernel_crc8(table, reg, data, length);
+        }
+    }
+}
+
+static uint8_t _nibble_crc8(const uint8_t *table, bool reflected, uint8_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (true == reflected)
+        {
+            reg = (uint8_t)(reg ^ data[i]);
+            reg = (uint8_t)((reg >> 4) ^ table[reg & 0x0Fu]);
+            reg = (uint8_t)((reg >> 4) ^ table[reg & 0x0Fu]);
+        }
+        else
+        {
+            reg = (uint8_t)(reg ^ data[i]);
+            reg = (uint8_t)((uint8_t)(reg << 4) ^ table[reg >> 4]);
+            reg = (uint8_t)((uint8_t)(reg << 4) ^ table[reg >> 4]);
+        }
+    }
+
+    return reg;
+}
+
+static uint16_t _calc_crc16(const calc_crc_t *crc, const calc_crc_16bit_t *conf, const uint8_t *data, size_t length)
+{
+    return _final_crc16(crc, conf, _update_crc16(crc, conf, _initial_crc16(crc, conf), data, length));
+}
+
+static uint16_t _initial_crc16(const calc_crc_t *crc, const calc_crc_16bit_t *conf)
+{
+    uint16_t initial = (uint16_t)(conf->initial_value << crc->shift);
+
+    return (true == crc->reflected_table) ? _reflect_crc16(initial) : initial;
+}
+
+static uint16_t _update_crc16(const calc_crc_t *crc, const calc_crc_16bit_t *conf, uint16_t reg, const uint8_t *data,
+                              size_t length)
+{
+    const uint16_t *table = (const uint16_t *)crc->table;
+    bool reflected = crc->reflected_table;
+
+#if (1 == CALC_CRC_HW_X86)
+    if ((conf->input_reflected == reflected) && (CALC_CRC_FOLD_MIN_LENGTH <= length) &&
+        (CALC_CRC_KERNEL_PCLMUL == crc->kernel))
+    {
+        uint8_t residue[16];
+        size_t folded = _fold_pclmul(crc->fold_constants, reflected, 16, reg, data, length, residue);
+
+        // Folded message has the same remainder as consumed data, finish it through the engine.
+        reg = _engine_crc16(crc, 0, residue, sizeof(residue));
+        data += folded;
+        length -= folded;
+    }
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+    if ((conf->input_reflected == reflected) && (CALC_CRC_KERNEL_GENERIC != crc->kernel) && (1u < crc->slices))
+    {
+        reg = _slice_crc16(table, (const uint16_t *)crc->slice_table, crc->slices, reflected, reg, data, length);
+    }
+    else if (conf->input_reflected == reflected)
+    {
+        reg = _engine_crc16(crc, reg, data, length);
+    }
+    else
+    {
+        // Table was generated for other bit order, mirror every byte to match it.
+        for (size_t i = 0; i < length; i++)
+        {
+            uint8_t byte = _reflect_crc8(data[i]);
+            reg = _engine_crc16(crc, reg, &byte, 1);
+        }
+    }
+
+    return reg;
+}
+
+static uint16_t _final_crc16(const calc_crc_t *crc, const calc_crc_16bit_t *conf, uint16_t reg)
+{
+    if (true == crc->reflected_table)
+    {
+        reg = _reflect_crc16(reg);
+    }
+
+    reg = reg ^ (uint16_t)(conf->final_value << crc->shift);
+
+    // Register is left-aligned for narrower CRC widths, reflection moves the value to the low bits.
+    return (true == conf->output_reflected) ? _reflect_crc16(reg) : (uint16_t)(reg >> crc->shift);
+}
+
+static void _batch_crc16(calc_crc_t *crc, calc_crc_16bit_t *conf, const void *const *data, const size_t *length,
+                         uint16_t *result, size_t count)
+{
+    const uint16_t *table = (const uint16_t *)crc->table;
+    bool reflected = crc->reflected_table;
+    size_t i = 0;
+
+    while (i < count)
+    {
+        if ((CALC_CRC_BATCH_LANES > (count - i)) || (conf->input_reflected != reflected) ||
+            (false == _batch_lanes(crc, &length[i])))
+        {
+            result[i] = _calc_crc16(crc, conf, (const uint8_t *)data[i], length[i]);
+            i++;
+            continue;
+        }
+
+        uint16_t init = _initial_crc16(crc, conf);
+        uint16_t reg[CALC_CRC_BATCH_LANES];
+        const uint8_t *ptr[CALC_CRC_BATCH_LANES];
+        size_t common = length[i];
+
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = init;
+            ptr[k] = (const uint8_t *)data[i + k];
+            common = (length[i + k] < common) ? length[i + k] : common;
+        }
+
+        // Common part of all buffers in lockstep (independent dependency chains), then the rest of each buffer.
+        _multi_crc16(table, reflected, reg, ptr, common);
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = (true == reflected) ? _kernel_crc16_lsb(table, reg[k], &ptr[k][common], length[i + k] - common)
+                                         : _kernel_crc16_msb(table, reg[k], &ptr[k][common], length[i + k] - common);
+        }
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            result[i + k] = _final_crc16(crc, conf, reg[k]);
+        }
+
+        i += CALC_CRC_BATCH_LANES;
+    }
+}
+
+static void _multi_crc16(const uint16_t *table, bool reflected, uint16_t *reg, const uint8_t *const *data,
+                         size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = (true == reflected) ? _kernel_crc16_lsb(table, reg[k], &data[k][i], 1)
+                                         : _kernel_crc16_msb(table, reg[k], &data[k][i], 1);
+        }
+    }
+}
+
+static uint16_t _kernel_crc16_msb(const uint16_t *table, uint16_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        uint8_t pos = (uint8_t)((reg >> 8) ^ data[i]);
+        reg = (uint16_t)(reg << 8) ^ table[pos];
+    }
+
+    return reg;
+}
+
+static uint16_t _kernel_crc16_lsb(const uint16_t *table, uint16_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        uint8_t pos = (uint8_t)(reg ^ data[i]);
+        reg = (uint16_t)(reg >> 8) ^ table[pos];
+    }
+
+    return reg;
+}
+
+static uint16_t _engine_crc16(const calc_crc_t *crc, uint16_t reg, const uint8_t *data, size_t length)
+{
+    const uint16_t *table = (const uint16_t *)crc->table;
+    bool reflected = crc->reflected_table;
+
+    switch (crc->engine)
+    {
+        case CALC_CRC_ENGINE_NIBBLE: // ---- 16-entry table
+        {
+            return _nibble_crc16(table, reflected, reg, data, length);
+        }
+        case CALC_CRC_ENGINE_BITWISE: // --- No table
+        {
+            const calc_crc_16bit_t *conf = (const calc_crc_16bit_t *)crc->conf;
+            return (uint16_t)_bitwise_crc((uint16_t)(conf->polynomial << crc->shift), 16, reflected, reg, data, length);
+        }
+        default: // -------------------- 256-entry table
+        {
+            return (true == reflected) ? _kernel_crc16_lsb(table, reg, data, length)
+                                       : _kernel_crc16_msb(table, reg, data, length);
+        }
+    }
+}
+
+static uint16_t _nibble_crc16(const uint16_t *table, bool reflected, uint16_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (true == reflected)
+        {
+            reg = (uint16_t)(reg ^ data[i]);
+            reg = (uint16_t)((reg >> 4) ^ table[reg & 0x0Fu]);
+            reg = (uint16_t)((reg >> 4) ^ table[reg & 0x0Fu]);
+        }
+        else
+        {
+            reg = (uint16_t)(reg ^ ((uint16_t)data[i] << (16u - 8u)));
+            reg = (uint16_t)((uint16_t)(reg << 4) ^ table[reg >> (16u - 4u)]);
+            reg = (uint16_t)((uint16_t)(reg << 4) ^ table[reg >> (16u - 4u)]);
+        }
+    }
+
+    return reg;
+}
+
+static uint32_t _calc_crc32(const calc_crc_t *crc, const calc_crc_32bit_t *conf, const uint8_t *data, size_t length)
+{
+    return _final_crc32(crc, conf, _update_crc32(crc, conf, _initial_crc32(crc, conf), data, length));
+}
+
+static uint32_t _initial_crc32(const calc_crc_t *crc, const calc_crc_32bit_t *conf)
+{
+    uint32_t initial = (uint32_t)(conf->initial_value << crc->shift);
+
+    return (true == crc->reflected_table) ? _reflect_crc32(initial) : initial;
+}
+
+static uint32_t _update_crc32(const calc_crc_t *crc, const calc_crc_32bit_t *conf, uint32_t reg, const uint8_t *data,
+                              size_t length)
+{
+    const uint32_t *table = (const uint32_t *)crc->table;
+    bool reflected = crc->reflected_table;
+
+#if (1 == CALC_CRC_HW_X86)
+    if ((true == reflected) && (true == conf->input_reflected) && (CALC_CRC_CRC32C_POLYNOMIAL == conf->polynomial) &&
+        (CALC_CRC_KERNEL_SSE42 == crc->kernel))
+    {
+        // CRC-32C has its own instruction, whole buffer is processed by it.
+        reg = _crc32c_sse42(reg, data, length);
+        length = 0;
+    }
+    else if ((conf->input_reflected == reflected) && (CALC_CRC_FOLD_MIN_LENGTH <= length) &&
+             (CALC_CRC_KERNEL_PCLMUL == crc->kernel))
+    {
+        uint8_t residue[16];
+        size_t folded = _fold_pclmul(crc->fold_constants, reflected, 32, reg, data, length, residue);
+
+        // Folded message has the same remainder as consumed data, finish it through the engine.
+        reg = _engine_crc32(crc, 0, residue, sizeof(residue));
+        data += folded;
+        length -= folded;
+    }
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+    if ((conf->input_reflected == reflected) && (CALC_CRC_KERNEL_GENERIC != crc->kernel) && (1u < crc->slices))
+    {
+        reg = _slice_crc32(table, (const uint32_t *)crc->slice_table, crc->slices, reflected, reg, data, length);
+    }
+    else if (conf->input_reflected == reflected)
+    {
+        reg = _engine_crc32(crc, reg, data, length);
+    }
+    else
+    {
+        // Table was generated for other bit order, mirror every byte to match it.
+        for (size_t i = 0; i < length; i++)
+        {
+            uint8_t byte = _reflect_crc8(data[i]);
+            reg = _engine_crc32(crc, reg, &byte, 1);
+        }
+    }
+
+    return reg;
+}
+
+static uint32_t _final_crc32(const calc_crc_t *crc, const calc_crc_32bit_t *conf, uint32_t reg)
+{
+    if (true == crc->reflected_table)
+    {
+        reg = _reflect_crc32(reg);
+    }
+
+    reg = reg ^ (uint32_t)(conf->final_value << crc->shift);
+
+    // Register is left-aligned for narrower CRC widths, reflection moves the value to the low bits.
+    return (true == conf->output_reflected) ? _reflect_crc32(reg) : (uint32_t)(reg >> crc->shift);
+}
+
+static void _batch_crc32(calc_crc_t *crc, calc_crc_32bit_t *conf, const void *const *data, const size_t *length,
+                         uint32_t *result, size_t count)
+{
+    const uint32_t *table = (const uint32_t *)crc->table;
+    bool reflected = crc->reflected_table;
+    size_t i = 0;
+
+    while (i < count)
+    {
+        if ((CALC_CRC_BATCH_LANES > (count - i)) || (conf->input_reflected != reflected) ||
+            (false == _batch_lanes(crc, &length[i])))
+        {
+            result[i] = _calc_crc32(crc, conf, (const uint8_t *)data[i], length[i]);
+            i++;
+            continue;
+        }
+
+        uint32_t init = _initial_crc32(crc, conf);
+        uint32_t reg[CALC_CRC_BATCH_LANES];
+        const uint8_t *ptr[CALC_CRC_BATCH_LANES];
+        size_t common = length[i];
+
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = init;
+            ptr[k] = (const uint8_t *)data[i + k];
+            common = (length[i + k] < common) ? length[i + k] : common;
+        }
+
+        // Common part of all buffers in lockstep (independent dependency chains), then the rest of each buffer.
+#if (1 == CALC_CRC_HW_X86)
+        if ((true == reflected) && (CALC_CRC_CRC32C_POLYNOMIAL == conf->polynomial) &&
+            (CALC_CRC_KERNEL_SSE42 == crc->kernel))
+        {
+            _crc32c_sse42_multi(reg, ptr, common);
+            for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+            {
+                reg[k] = _crc32c_sse42(reg[k], &ptr[k][common], length[i + k] - common);
+            }
+        }
+        else
+#endif /* (1 == CALC_CRC_HW_X86) */
+        {
+            _multi_crc32(table, reflected, reg, ptr, common);
+            for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+            {
+                reg[k] = (true == reflected)
+                             ? _kernel_crc32_lsb(table, reg[k], &ptr[k][common], length[i + k] - common)
+                             : _kernel_crc32_msb(table, reg[k], &ptr[k][common], length[i + k] - common);
+            }
+        }
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            result[i + k] = _final_crc32(crc, conf, reg[k]);
+        }
+
+        i += CALC_CRC_BATCH_LANES;
+    }
+}
+
+static void _multi_crc32(const uint32_t *table, bool reflected, uint32_t *reg, const uint8_t *const *data,
+                         size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = (true == reflected) ? _kernel_crc32_lsb(table, reg[k], &data[k][i], 1)
+                                         : _kernel_crc32_msb(table, reg[k], &data[k][i], 1);
+        }
+    }
+}
+
+static uint32_t _kernel_crc32_msb(const uint32_t *table, uint32_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        uint8_t pos = (uint8_t)((reg >> 24) ^ data[i]);
+        reg = (reg << 8) ^ table[pos];
+    }
+
+    return reg;
+}
+
+static uint32_t _kernel_crc32_lsb(const uint32_t *table, uint32_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        uint8_t pos = (uint8_t)(reg ^ data[i]);
+        reg = (reg >> 8) ^ table[pos];
+    }
+
+    return reg;
+}
+
+static uint32_t _engine_crc32(const calc_crc_t *crc, uint32_t reg, const uint8_t *data, size_t length)
+{
+    const uint32_t *table = (const uint32_t *)crc->table;
+    bool reflected = crc->reflected_table;
+
+    switch (crc->engine)
+    {
+        case CALC_CRC_ENGINE_NIBBLE: // ---- 16-entry table
+        {
+            return _nibble_crc32(table, reflected, reg, data, length);
+        }
+        case CALC_CRC_ENGINE_BITWISE: // --- No table
+        {
+            const calc_crc_32bit_t *conf = (const calc_crc_32bit_t *)crc->conf;
+            return (uint32_t)_bitwise_crc((uint32_t)(conf->polynomial << crc->shift), 32, reflected, reg, data, length);
+        }
+        default: // -------------------- 256-entry table
+        {
+            return (true == reflected) ? _kernel_crc32_lsb(table, reg, data, length)
+                                       : _kernel_crc32_msb(table, reg, data, length);
+        }
+    }
+}
+
+static uint32_t _nibble_crc32(const uint32_t *table, bool reflected, uint32_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (true == reflected)
+        {
+            reg = (uint32_t)(reg ^ data[i]);
+            reg = (uint32_t)((reg >> 4) ^ table[reg & 0x0Fu]);
+            reg = (uint32_t)((reg >> 4) ^ table[reg & 0x0Fu]);
+        }
+        else
+        {
+            reg = (uint32_t)(reg ^ ((uint32_t)data[i] << (32u - 8u)));
+            reg = (uint32_t)((uint32_t)(reg << 4) ^ table[reg >> (32u - 4u)]);
+            reg = (uint32_t)((uint32_t)(reg << 4) ^ table[reg >> (32u - 4u)]);
+        }
+    }
+
+    return reg;
+}
+
+static uint64_t _calc_crc64(const calc_crc_t *crc, const calc_crc_64bit_t *conf, const uint8_t *data, size_t length)
+{
+    return _final_crc64(crc, conf, _update_crc64(crc, conf, _initial_crc64(crc, conf), data, length));
+}
+
+static uint64_t _initial_crc64(const calc_crc_t *crc, const calc_crc_64bit_t *conf)
+{
+    uint64_t initial = (uint64_t)(conf->initial_value << crc->shift);
+
+    return (true == crc->reflected_table) ? _reflect_crc64(initial) : initial;
+}
+
+static uint64_t _update_crc64(const calc_crc_t *crc, const calc_crc_64bit_t *conf, uint64_t reg, const uint8_t *data,
+                              size_t length)
+{
+    const uint64_t *table = (const uint64_t *)crc->table;
+    bool reflected = crc->reflected_table;
+
+#if (1 == CALC_CRC_HW_X86)
+    if ((conf->input_reflected == reflected) && (CALC_CRC_FOLD_MIN_LENGTH <= length) &&
+        (CALC_CRC_KERNEL_PCLMUL == crc->kernel))
+    {
+        uint8_t residue[16];
+        size_t folded = _fold_pclmul(crc->fold_constants, reflected, 64, reg, data, length, residue);
+
+        // Folded message has the same remainder as consumed data, finish it through the engine.
+        reg = _engine_crc64(crc, 0, residue, sizeof(residue));
+        data += folded;
+        length -= folded;
+    }
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+    if ((conf->input_reflected == reflected) && (CALC_CRC_KERNEL_GENERIC != crc->kernel) && (1u < crc->slices))
+    {
+        reg = _slice_crc64(table, (const uint64_t *)crc->slice_table, crc->slices, reflected, reg, data, length);
+    }
+    else if (conf->input_reflected == reflected)
+    {
+        reg = _engine_crc64(crc, reg, data, length);
+    }
+    else
+    {
+        // Table was generated for other bit order, mirror every byte to match it.
+        for (size_t i = 0; i < length; i++)
+        {
+            uint8_t byte = _reflect_crc8(data[i]);
+            reg = _engine_crc64(crc, reg, &byte, 1);
+        }
+    }
+
+    return reg;
+}
+
+static uint64_t _final_crc64(const calc_crc_t *crc, const calc_crc_64bit_t *conf, uint64_t reg)
+{
+    if (true == crc->reflected_table)
+    {
+        reg = _reflect_crc64(reg);
+    }
+
+    reg = reg ^ (uint64_t)(conf->final_value << crc->shift);
+
+    // Register is left-aligned for narrower CRC widths, reflection moves the value to the low bits.
+    return (true == conf->output_reflected) ? _reflect_crc64(reg) : (uint64_t)(reg >> crc->shift);
+}
+
+static void _batch_crc64(calc_crc_t *crc, calc_crc_64bit_t *conf, const void *const *data, const size_t *length,
+                         uint64_t *result, size_t count)
+{
+    const uint64_t *table = (const uint64_t *)crc->table;
+    bool reflected = crc->reflected_table;
+    size_t i = 0;
+
+    while (i < count)
+    {
+        if ((CALC_CRC_BATCH_LANES > (count - i)) || (conf->input_reflected != reflected) ||
+            (false == _batch_lanes(crc, &length[i])))
+        {
+            result[i] = _calc_crc64(crc, conf, (const uint8_t *)data[i], length[i]);
+            i++;
+            continue;
+        }
+
+        uint64_t init = _initial_crc64(crc, conf);
+        uint64_t reg[CALC_CRC_BATCH_LANES];
+        const uint8_t *ptr[CALC_CRC_BATCH_LANES];
+        size_t common = length[i];
+
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = init;
+            ptr[k] = (const uint8_t *)data[i + k];
+            common = (length[i + k] < common) ? length[i + k] : common;
+        }
+
+        // Common part of all buffers in lockstep (independent dependency chains), then the rest of each buffer.
+        _multi_crc64(table, reflected, reg, ptr, common);
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = (true == reflected) ? _kernel_crc64_lsb(table, reg[k], &ptr[k][common], length[i + k] - common)
+                                         : _kernel_crc64_msb(table, reg[k], &ptr[k][common], length[i + k] - common);
+        }
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            result[i + k] = _final_crc64(crc, conf, reg[k]);
+        }
+
+        i += CALC_CRC_BATCH_LANES;
+    }
+}
+
+static void _multi_crc64(const uint64_t *table, bool reflected, uint64_t *reg, const uint8_t *const *data,
+                         size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        for (size_t k = 0; k < CALC_CRC_BATCH_LANES; k++)
+        {
+            reg[k] = (true == reflected) ? _kernel_crc64_lsb(table, reg[k], &data[k][i], 1)
+                                         : _kernel_crc64_msb(table, reg[k], &data[k][i], 1);
+        }
+    }
+}
+
+static uint64_t _kernel_crc64_msb(const uint64_t *table, uint64_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        uint8_t pos = (uint8_t)((reg >> 56) ^ data[i]);
+        reg = (reg << 8) ^ table[pos];
+    }
+
+    return reg;
+}
+
+static uint64_t _kernel_crc64_lsb(const uint64_t *table, uint64_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        uint8_t pos = (uint8_t)(reg ^ data[i]);
+        reg = (reg >> 8) ^ table[pos];
+    }
+
+    return reg;
+}
+
+static uint64_t _engine_crc64(const calc_crc_t *crc, uint64_t reg, const uint8_t *data, size_t length)
+{
+    const uint64_t *table = (const uint64_t *)crc->table;
+    bool reflected = crc->reflected_table;
+
+    switch (crc->engine)
+    {
+        case CALC_CRC_ENGINE_NIBBLE: // ---- 16-entry table
+        {
+            return _nibble_crc64(table, reflected, reg, data, length);
+        }
+        case CALC_CRC_ENGINE_BITWISE: // --- No table
+        {
+            const calc_crc_64bit_t *conf = (const calc_crc_64bit_t *)crc->conf;
+            return (uint64_t)_bitwise_crc((uint64_t)(conf->polynomial << crc->shift), 64, reflected, reg, data, length);
+        }
+        default: // -------------------- 256-entry table
+        {
+            return (true == reflected) ? _kernel_crc64_lsb(table, reg, data, length)
+                                       : _kernel_crc64_msb(table, reg, data, length);
+        }
+    }
+}
+
+static uint64_t _nibble_crc64(const uint64_t *table, bool reflected, uint64_t reg, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (true == reflected)
+        {
+            reg = (uint64_t)(reg ^ data[i]);
+            reg = (uint64_t)((reg >> 4) ^ table[reg & 0x0Fu]);
+            reg = (uint64_t)((reg >> 4) ^ table[reg & 0x0Fu]);
+        }
+        else
+        {
+            reg = (uint64_t)(reg ^ ((uint64_t)data[i] << (64u - 8u)));
+            reg = (uint64_t)((uint64_t)(reg << 4) ^ table[reg >> (64u - 4u)]);
+            reg = (uint64_t)((uint64_t)(reg << 4) ^ table[reg >> (64u - 4u)]);
+        }
+    }
+
+    return reg;
+}
+
+static void _calc_slice_table_crc8(const uint8_t *table, uint8_t *slice_table, uint8_t slices, bool reflected)
+{
+    // Row k holds CRC of byte followed by k zero bytes, row 0 is the base table itself.
+    for (size_t k = 0; (k + 1u) < slices; k++)
+    {
+        const uint8_t *row = (0u == k) ? table : &slice_table[(k - 1u) * 256];
+
+        for (size_t i = 0; i < 256; i++)
+        {
+            uint8_t prev = row[i];
+            if (true == reflected)
+            {
+                slice_table[k * 256 + i] = table[prev];
+            }
+            else
+            {
+                slice_table[k * 256 + i] = table[prev];
+            }
+        }
+    }
+}
+
+static uint8_t _slice_crc8(const uint8_t *table, const uint8_t *slice_table, uint8_t slices, bool reflected,
+                           uint8_t reg, const uint8_t *data, size_t length)
+{
+    const uint8_t *rows[16];
+
+    // Row used for byte at block offset n is rows[slices - 1 - n], the last byte uses the base table.
+    rows[0] = table;
+    for (size_t k = 1; k < slices; k++)
+    {
+        rows[k] = &slice_table[(k - 1u) * 256];
+    }
+
+    if (true == reflected)
+    {
+        for (; length >= slices; length -= slices, data += slices)
+        {
+            uint8_t next = 0;
+
+            for (size_t j = 0; j < slices; j += 4)
+            {
+                uint32_t word = _load_le32(&data[j]);
+                if (0u == j)
+                {
+                    word ^= (uint32_t)reg;
+                }
+                const uint8_t *const *row = &rows[slices - 1u - j];
+                next ^= (uint8_t)(row[0][word & 0xFF] ^ row[-1][(word >> 8) & 0xFF] ^ row[-2][(word >> 16) & 0xFF] ^
+                        row[-3][word >> 24]);
+            }
+
+            reg = next;
+        }
+
+        return _kernel_crc8(table, reg, data, length);
+    }
+
+    for (; length >= slices; length -= slices, data += slices)
+    {
+        uint8_t next = 0;
+
+        for (size_t j = 0; j < slices; j += 4)
+        {
+            uint32_t word = _load_be32(&data[j]);
+            if (0u == j)
+            {
+                word ^= (uint32_t)reg << 24;
+            }
+            const uint8_t *const *row = &rows[slices - 1u - j];
+            next ^= (uint8_t)(row[0][word >> 24] ^ row[-1][(word >> 16) & 0xFF] ^ row[-2][(word >> 8) & 0xFF] ^
+                    row[-3][word & 0xFF]);
+        }
+
+        reg = next;
+    }
+
+    return _kernel_crc8(table, reg, data, length);
+}
+
+static void _calc_slice_table_crc16(const uint16_t *table, uint16_t *slice_table, uint8_t slices, bool reflected)
+{
+    // Row k holds CRC of byte followed by k zero bytes, row 0 is the base table itself.
+    for (size_t k = 0; (k + 1u) < slices; k++)
+    {
+        const uint16_t *row = (0u == k) ? table : &slice_table[(k - 1u) * 256];
+
+        for (size_t i = 0; i < 256; i++)
+        {
+            uint16_t prev = row[i];
+            if (true == reflected)
+            {
+                slice_table[k * 256 + i] = (uint16_t)(prev >> 8) ^ table[prev & 0xFF];
+            }
+            else
+            {
+                slice_table[k * 256 + i] = (uint16_t)(prev << 8) ^ table[prev >> 8];
+            }
+        }
+    }
+}
+
+static uint16_t _slice_crc16(const uint16_t *table, const uint16_t *slice_table, uint8_t slices, bool reflected,
+                             uint16_t reg, const uint8_t *data, size_t length)
+{
+    const uint16_t *rows[16];
+
+    // Row used for byte at block offset n is rows[slices - 1 - n], the last byte uses the base table.
+    rows[0] = table;
+    for (size_t k = 1; k < slices; k++)
+    {
+        rows[k] = &slice_table[(k - 1u) * 256];
+    }
+
+    if (true == reflected)
+    {
+        for (; length >= slices; length -= slices, data += slices)
+        {
+            uint16_t next = 0;
+
+            for (size_t j = 0; j < slices; j += 4)
+            {
+                uint32_t word = _load_le32(&data[j]);
+                if (0u == j)
+                {
+                    word ^= (uint32_t)reg;
+                }
+                const uint16_t *const *row = &rows[slices - 1u - j];
+                next ^= (uint16_t)(row[0][word & 0xFF] ^ row[-1][(word >> 8) & 0xFF] ^ row[-2][(word >> 16) & 0xFF] ^
+                        row[-3][word >> 24]);
+            }
+
+            reg = next;
+        }
+
+        return _kernel_crc16_lsb(table, reg, data, length);
+    }
+
+    for (; length >= slices; length -= slices, data += slices)
+    {
+        uint16_t next = 0;
+
+        for (size_t j = 0; j < slices; j += 4)
+        {
+            uint32_t word = _load_be32(&data[j]);
+            if (0u == j)
+            {
+                word ^= (uint32_t)reg << 16;
+            }
+            const uint16_t *const *row = &rows[slices - 1u - j];
+            next ^= (uint16_t)(row[0][word >> 24] ^ row[-1][(word >> 16) & 0xFF] ^ row[-2][(word >> 8) & 0xFF] ^
+                    row[-3][word & 0xFF]);
+        }
+
+        reg = next;
+    }
+
+    return _kernel_crc16_msb(table, reg, data, length);
+}
+
+static void _calc_slice_table_crc32(const uint32_t *table, uint32_t *slice_table, uint8_t slices, bool reflected)
+{
+    // Row k holds CRC of byte followed by k zero bytes, row 0 is the base table itself.
+    for (size_t k = 0; (k + 1u) < slices; k++)
+    {
+        const uint32_t *row = (0u == k) ? table : &slice_table[(k - 1u) * 256];
+
+        for (size_t i = 0; i < 256; i++)
+        {
+            uint32_t prev = row[i];
+            if (true == reflected)
+            {
+                slice_table[k * 256 + i] = (prev >> 8) ^ table[prev & 0xFF];
+            }
+            else
+            {
+                slice_table[k * 256 + i] = (prev << 8) ^ table[prev >> 24];
+            }
+        }
+    }
+}
+
+static uint32_t _slice_crc32(const uint32_t *table, const uint32_t *slice_table, uint8_t slices, bool reflected,
+                             uint32_t reg, const uint8_t *data, size_t length)
+{
+    const uint32_t *rows[16];
+
+    // Row used for byte at block offset n is rows[slices - 1 - n], the last byte uses the base table.
+    rows[0] = table;
+    for (size_t k = 1; k < slices; k++)
+    {
+        rows[k] = &slice_table[(k - 1u) * 256];
+    }
+
+    if (true == reflected)
+    {
+        for (; length >= slices; length -= slices, data += slices)
+        {
+            uint32_t next = 0;
+
+            for (size_t j = 0; j < slices; j += 4)
+            {
+                uint32_t word = _load_le32(&data[j]);
+                if (0u == j)
+                {
+                    word ^= reg;
+                }
+                const uint32_t *const *row = &rows[slices - 1u - j];
+                next ^= (row[0][word & 0xFF] ^ row[-1][(word >> 8) & 0xFF] ^ row[-2][(word >> 16) & 0xFF] ^
+                        row[-3][word >> 24]);
+            }
+
+            reg = next;
+        }
+
+        return _kernel_crc32_lsb(table, reg, data, length);
+    }
+
+    for (; length >= slices; length -= slices, data += slices)
+    {
+        uint32_t next = 0;
+
+        for (size_t j = 0; j < slices; j += 4)
+        {
+            uint32_t word = _load_be32(&data[j]);
+            if (0u == j)
+            {
+                word ^= reg;
+            }
+            const uint32_t *const *row = &rows[slices - 1u - j];
+            next ^= (row[0][word >> 24] ^ row[-1][(word >> 16) & 0xFF] ^ row[-2][(word >> 8) & 0xFF] ^
+                    row[-3][word & 0xFF]);
+        }
+
+        reg = next;
+    }
+
+    return _kernel_crc32_msb(table, reg, data, length);
+}
+
+static void _calc_slice_table_crc64(const uint64_t *table, uint64_t *slice_table, uint8_t slices, bool reflected)
+{
+    // Row k holds CRC of byte followed by k zero bytes, row 0 is the base table itself.
+    for (size_t k = 0; (k + 1u) < slices; k++)
+    {
+        const uint64_t *row = (0u == k) ? table : &slice_table[(k - 1u) * 256];
+
+        for (size_t i = 0; i < 256; i++)
+        {
+            uint64_t prev = row[i];
+            if (true == reflected)
+            {
+                slice_table[k * 256 + i] = (prev >> 8) ^ table[prev & 0xFF];
+            }
+            else
+            {
+                slice_table[k * 256 + i] = (prev << 8) ^ table[prev >> 56];
+            }
+        }
+    }
+}
+
+static uint64_t _slice_crc64(const uint64_t *table, const uint64_t *slice_table, uint8_t slices, bool reflected,
+                             uint64_t reg, const uint8_t *data, size_t length)
+{
+    const uint64_t *rows[16];
+
+    // Row used for byte at block offset n is rows[slices - 1 - n], the last byte uses the base table.
+    rows[0] = table;
+    for (size_t k = 1; k < slices; k++)
+    {
+        rows[k] = &slice_table[(k - 1u) * 256];
+    }
+
+    if (true == reflected)
+    {
+        for (; length >= slices; length -= slices, data += slices)
+        {
+            uint64_t next = (4u == slices) ? (reg >> 32) : 0u;
+
+            for (size_t j = 0; j < slices; j += 4)
+            {
+                uint32_t word = _load_le32(&data[j]);
+                if (0u == j)
+                {
+                    word ^= (uint32_t)reg;
+                }
+                else if (4u == j)
+                {
+                    word ^= (uint32_t)(reg >> 32);
+                }
+                const uint64_t *const *row = &rows[slices - 1u - j];
+                next ^= (row[0][word & 0xFF] ^ row[-1][(word >> 8) & 0xFF] ^ row[-2][(word >> 16) & 0xFF] ^
+                        row[-3][word >> 24]);
+            }
+
+            reg = next;
+        }
+
+        return _kernel_crc64_lsb(table, reg, data, length);
+    }
+
+    for (; length >= slices; length -= slices, data += slices)
+    {
+        uint64_t next = (4u == slices) ? (reg << 32) : 0u;
+
+        for (size_t j = 0; j < slices; j += 4)
+        {
+            uint32_t word = _load_be32(&data[j]);
+            if (0u == j)
+            {
+                word ^= (uint32_t)(reg >> 32);
+            }
+            else if (4u == j)
+            {
+                word ^= (uint32_t)reg;
+            }
+            const uint64_t *const *row = &rows[slices - 1u - j];
+            next ^= (row[0][word >> 24] ^ row[-1][(word >> 16) & 0xFF] ^ row[-2][(word >> 8) & 0xFF] ^
+                    row[-3][word & 0xFF]);
+        }
+
+        reg = next;
+    }
+
+    return _kernel_crc64_msb(table, reg, data, length);
+}
+
+static uint64_t _mul_mod(uint64_t a, uint64_t b, uint64_t polynomial, uint8_t width)
+{
+    uint64_t top = (uint64_t)1u << (width - 1u);
+    uint64_t mask = top | (top - 1u);
+    uint64_t result = 0u;
+
+    // Horner scheme over bits of b, starting with the highest term.
+    for (uint8_t bit = width; bit > 0u; bit--)
+    {
+        bool carry = (0u != (result & top));
+        result = (result << 1) & mask;
+        if (true == carry)
+        {
+            result ^= polynomial & mask;
+        }
+        if (0u != ((b >> (bit - 1u)) & 1u))
+        {
+            result ^= a;
+        }
+    }
+
+    return result;
+}
+
+static uint64_t _xpow_mod(uint64_t exponent, uint64_t polynomial, uint8_t width)
+{
+    uint64_t base = (1u < width) ? 2u : (polynomial & 1u);
+    uint64_t result = 1u;
+    uint8_t bit = 64;
+
+    // Leading zero bits of the exponent would only square the initial 1.
+    while ((0u < bit) && (0u == ((exponent >> (bit - 1u)) & 1u)))
+    {
+        bit--;
+    }
+    for (; bit > 0u; bit--)
+    {
+        result = _mul_mod(result, result, polynomial, width);
+        if (0u != ((exponent >> (bit - 1u)) & 1u))
+        {
+            result = _mul_mod(result, base, polynomial, width);
+        }
+    }
+
+    return result;
+}
+
+static uint64_t _combine(uint64_t polynomial, uint64_t initial, uint64_t final, bool reflected, uint8_t width,
+                         uint64_t crc_a, uint64_t crc_b, size_t length_b)
+{
+    uint64_t mask = ((uint64_t)1u << (width - 1u)) | (((uint64_t)1u << (width - 1u)) - 1u);
+
+    initial &= mask;
+    final &= mask;
+
+    uint64_t reg_a = ((true == reflected) ? (_reflect_crc64(crc_a) >> (64u - width)) : crc_a) ^ final;
+    uint64_t reg_b = ((true == reflected) ? (_reflect_crc64(crc_b) >> (64u - width)) : crc_b) ^ final;
+
+    // CRC is linear: reg(A|B) = (reg(A) ^ init) * x^(8 * len(B)) ^ reg(B), both registers started from init.
+    uint64_t shift = _xpow_mod(8u * (uint64_t)length_b, polynomial, width);
+    uint64_t reg = _mul_mod(reg_a ^ initial, shift, polynomial, width) ^ reg_b;
+
+    reg ^= final;
+    return (true == reflected) ? (_reflect_crc64(reg) >> (64u - width)) : reg;
+}
+
+static uint64_t _crc_polynomial(const calc_crc_t *crc)
+{
+    switch (crc->type)
+    {
+        case CALC_CRC_TYPE_8BIT: // ---- 8-bit calculator
+        {
+            return ((const calc_crc_8bit_t *)crc->conf)->polynomial;
+        }
+        case CALC_CRC_TYPE_16BIT: // --- 16-bit calculator
+        {
+            return ((const calc_crc_16bit_t *)crc->conf)->polynomial;
+        }
+        case CALC_CRC_TYPE_32BIT: // --- 32-bit calculator
+        {
+            return ((const calc_crc_32bit_t *)crc->conf)->polynomial;
+        }
+        default: // -------------------- 64-bit calculator
+        {
+            return ((const calc_crc_64bit_t *)crc->conf)->polynomial;
+        }
+    }
+}
+
+static uint64_t _reg_to_rem(const calc_crc_t *crc, uint64_t reg)
+{
+    uint8_t bits = (uint8_t)(8u << crc->type);
+
+    // Raw register holds the remainder left-aligned in the type, bit reversed for reflected tables.
+    if (true == crc->reflected_table)
+    {
+        reg = _reflect_crc64(reg) >> (64u - bits);
+    }
+
+    return reg >> crc->shift;
+}
+
+static uint64_t _rem_to_reg(const calc_crc_t *crc, uint64_t rem)
+{
+    uint8_t bits = (uint8_t)(8u << crc->type);
+
+    rem <<= crc->shift;
+
+    return (true == crc->reflected_table) ? (_reflect_crc64(rem) >> (64u - bits)) : rem;
+}
+
+static uint64_t _shift_crc(const calc_crc_t *crc, uint64_t reg, uint64_t count)
+{
+    uint8_t width = (uint8_t)((8u << crc->type) - crc->shift);
+    uint64_t polynomial = _crc_polynomial(crc);
+
+    return _rem_to_reg(crc, _mul_mod(_reg_to_rem(crc, reg), _xpow_mod(8u * count, polynomial, width), polynomial,
+                                     width));
+}
+
+static uint64_t _fill_crc(const calc_crc_t *crc, uint64_t reg, uint8_t byte, uint64_t count)
+{
+    if (CALC_CRC_FILL_MIN_LENGTH > count)
+    {
+        uint8_t fill[CALC_CRC_PATCH_BLOCK];
+
+        // Short runs go through the kernel bound at init.
+        MEMSET(fill, byte, sizeof(fill));
+        while (0u != count)
+        {
+            size_t block = (count < sizeof(fill)) ? (size_t)count : sizeof(fill);
+            reg = _update_crc(crc, reg, fill, block);
+            count -= block;
+        }
+        return reg;
+    }
+    if (0u == byte)
+    {
+        return _shift_crc(crc, reg, count);
+    }
+
+    uint8_t width = (uint8_t)((8u << crc->type) - crc->shift);
+    uint64_t polynomial = _crc_polynomial(crc);
+    uint64_t one = _reg_to_rem(crc, _update_crc(crc, 0u, &byte, 1u));
+    uint64_t x8 = _xpow_mod(8u, polynomial, width);
+    uint64_t fill = 0u;
+    uint64_t shift = 1u;
+    uint8_t bit = 64;
+
+    // Remainder K(m) of m bytes from a zero register and x^(8m) over bits of count, starting with the highest one:
+    // K(2m) = K(m) * x^(8m) ^ K(m) and K(m + 1) = K(m) * x^8 ^ K(1).
+    while ((0u < bit) && (0u == ((count >> (bit - 1u)) & 1u)))
+    {
+        bit--;
+    }
+    for (; bit > 0u; bit--)
+    {
+        fill = _mul_mod(fill, shift, polynomial, width) ^ fill;
+        shift = _mul_mod(shift, shift, polynomial, width);
+        if (0u != ((count >> (bit - 1u)) & 1u))
+        {
+            fill = _mul_mod(fill, x8, polynomial, width) ^ one;
+            shift = _mul_mod(shift, x8, polynomial, width);
+        }
+    }
+
+    return _rem_to_reg(crc, _mul_mod(_reg_to_rem(crc, reg), shift, polynomial, width) ^ fill);
+}
+
+static void _calc_fold_constants(uint64_t *constants, uint64_t polynomial, uint8_t width, bool reflected)
+{
+#if (1 == CALC_CRC_HW_X86)
+    // Pairs for folding distances of 512, 384, 256 and 128 bits; first constant multiplies low, second high qword.
+    static const uint32_t distance[CALC_CRC_FOLD_CONSTANTS / 2u] = {512u, 384u, 256u, 128u};
+
+    for (size_t i = 0; i < (CALC_CRC_FOLD_CONSTANTS / 2u); i++)
+    {
+        if (true == reflected)
+        {
+            // Reflected product is one bit short, so constants use exponent reduced by one.
+            constants[2u * i] = _reflect_crc64(_xpow_mod(distance[i] + 63u, polynomial, width));
+            constants[2u * i + 1u] = _reflect_crc64(_xpow_mod(distance[i] - 1u, polynomial, width));
+        }
+        else
+        {
+            constants[2u * i] = _xpow_mod(distance[i], polynomial, width);
+            constants[2u * i + 1u] = _xpow_mod(distance[i] + 64u, polynomial, width);
+        }
+    }
+#else
+    (void)polynomial;
+    (void)width;
+    (void)reflected;
+    MEMSET(constants, 0, CALC_CRC_FOLD_CONSTANTS * sizeof(uint64_t));
+#endif /* (1 == CALC_CRC_HW_X86) */
+}
+
+static const calc_crc_sum_t *_sum_params(calc_crc_type_e type)
+{
+    return &_sums[type - CALC_CRC_TYPE_SUM8];
+}
+
+static uint8_t _sum_word(calc_crc_type_e type)
+{
+    return (CALC_CRC_TYPE_SUM8 <= type) ? _sum_params(type)->word : 1u;
+}
+
+static uint64_t _initial_sum(const calc_crc_t *crc)
+{
+    const calc_crc_sum_t *params = _sum_params(crc->type);
+    uint64_t initial = ((const calc_crc_checksum_t *)crc->conf)->initial_value;
+
+    if (true == params->ones)
+    {
+        return _fold_inet(initial);
+    }
+    if (0u == params->half)
+    {
+        return initial % params->modulus;
+    }
+
+    uint64_t mask = ((uint64_t)1u << params->half) - 1u;
+    uint64_t a = (initial & mask) % params->modulus;
+    uint64_t b = ((initial >> params->half) & mask) % params->modulus;
+
+    return (b << params->half) | a;
+}
+
+static uint64_t _update_sum(const calc_crc_t *crc, uint64_t reg, const uint8_t *data, size_t length)
+{
+    const calc_crc_sum_t *params = _sum_params(crc->type);
+
+    if (true == params->ones)
+    {
+        return _update_inet(crc, reg, data, length);
+    }
+
+    uint64_t mask = (0u == params->half) ? UINT64_MAX : (((uint64_t)1u << params->half) - 1u);
+    uint64_t a = reg & mask;
+    uint64_t b = (0u == params->half) ? 0u : (reg >> params->half);
+
+    // Deferred modulo: a chunk is summed without reduction, then both sums are reduced once.
+    while (0u != length)
+    {
+        size_t chunk = (CALC_CRC_SUM_CHUNK < length) ? CALC_CRC_SUM_CHUNK : length;
+        size_t done = 0u;
+        uint64_t sum = 0u;
+        uint64_t weighted = 0u;
+
+#if (1 == CALC_CRC_HW_X86)
+        if (CALC_CRC_KERNEL_AVX2 == crc->kernel)
+        {
+            done = (1u == params->word) ? _sum_bytes_avx2(data, chunk, &sum, &weighted)
+                                        : _sum_words_avx2(data, chunk, params->word, &sum, &weighted);
+        }
+        else if (CALC_CRC_KERNEL_SSE2 == crc->kernel)
+        {
+            done = (1u == params->word) ? _sum_bytes_sse2(data, chunk, &sum, &weighted)
+                                        : _sum_words_sse2(data, chunk, params->word, &sum, &weighted);
+        }
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+        _sum_generic(&data[done], chunk - done, params->word, &sum, &weighted);
+
+        // B is increased by A once per word and by the prefix sums of the chunk.
+        b = (b + ((uint64_t)(chunk / params->word) * a) + weighted) % params->modulus;
+        a = (a + sum) % params->modulus;
+        data += chunk;
+        length -= chunk;
+    }
+
+    return (0u == params->half) ? a : ((b << params->half) | a);
+}
+
+static uint64_t _final_sum(const calc_crc_t *crc, uint64_t reg)
+{
+    const calc_crc_sum_t *params = _sum_params(crc->type);
+
+    if (true == params->ones)
+    {
+        return (~reg) & UINT16_MAX;
+    }
+
+    return (true == params->negated) ? ((params->modulus - reg) % params->modulus) : reg;
+}
+
+static uint64_t _combine_sum(const calc_crc_t *crc, uint64_t sum_a, uint64_t sum_b, size_t length_b)
+{
+    const calc_crc_sum_t *params = _sum_params(crc->type);
+    uint64_t modulus = params->modulus;
+    uint64_t initial = _initial_sum(crc);
+    uint64_t mask = (0u == params->half) ? UINT64_MAX : (((uint64_t)1u << params->half) - 1u);
+
+    // Ones' complement sums are added with end-around carry, the initial sum counted twice is subtracted (added as its
+    // complement; a zero initial sum is skipped so that a sum of zero data stays +0).
+    if (true == params->ones)
+    {
+        uint64_t reg = ((~sum_a) & UINT16_MAX) + ((~sum_b) & UINT16_MAX);
+        reg += (0u != initial) ? ((~initial) & UINT16_MAX) : 0u;
+        return _final_sum(crc, _fold_inet(reg));
+    }
+
+    // Negated values are turned back into sums.
+    if (true == params->negated)
+    {
+        sum_a = (modulus - (sum_a % modulus)) % modulus;
+        sum_b = (modulus - (sum_b % modulus)) % modulus;
+    }
+
+    uint64_t a0 = initial & mask;
+    uint64_t a_a = (sum_a & mask) % modulus;
+    uint64_t a_b = (sum_b & mask) % modulus;
+    uint64_t a = (a_a + a_b + modulus - a0) % modulus;
+    uint64_t reg = a;
+
+    // Sums of both blocks start from the initial sums: B = B(A) + B(B) - B0 + words(B) * (A(A) - A0).
+    if (0u != params->half)
+    {
+        uint64_t b0 = initial >> params->half;
+        uint64_t b_a = ((sum_a >> params->half) & mask) % modulus;
+        uint64_t b_b = ((sum_b >> params->half) & mask) % modulus;
+        uint64_t words = (uint64_t)((length_b / params->word) + ((0u != (length_b % params->word)) ? 1u : 0u));
+        uint64_t b = (b_a + b_b + modulus - b0 + ((words % modulus) * ((a_a + modulus - a0) % modulus))) % modulus;
+        reg = (b << params->half) | a;
+    }
+
+    return _final_sum(crc, reg);
+}
+
+static uint64_t _patch_sum(const calc_crc_t *crc, uint64_t value, size_t length, size_t offset,
+                           const uint8_t *old_bytes, const uint8_t *new_bytes, size_t patch_length)
+{
+    const calc_crc_sum_t *params = _sum_params(crc->type);
+    uint64_t modulus = params->modulus;
+    uint64_t mask = (0u == params->half) ? UINT64_MAX : (((uint64_t)1u << params->half) - 1u);
+    uint64_t words = (uint64_t)((length / params->word) + ((0u != (length % params->word)) ? 1u : 0u));
+
+    // Negated values are turned back into sums.
+    if (true == params->negated)
+    {
+        value = (modulus - (value % modulus)) % modulus;
+    }
+
+    uint64_t a = (value & mask) % modulus;
+    uint64_t b = (0u == params->half) ? 0u : (((value >> params->half) & mask) % modulus);
+
+    // Byte k of a little-endian word changes the word by (new - old) * 2^(8k): A gains the change once, B once per
+    // word from the changed word to the end.
+    for (size_t i = 0; i < patch_length; i++)
+    {
+        size_t position = offset + i;
+        uint64_t scale = ((uint64_t)1u << (8u * (position % params->word))) % modulus;
+        uint64_t delta = ((((modulus + new_bytes[i]) - old_bytes[i]) % modulus) * scale) % modulus;
+
+        a = (a + delta) % modulus;
+        b = (b + (((words - (position / params->word)) % modulus) * delta)) % modulus;
+    }
+
+    return _final_sum(crc, (0u == params->half) ? a : ((b << params->half) | a));
+}
+
+static uint64_t _fill_sum(const calc_crc_t *crc, uint64_t reg, uint8_t byte, uint64_t words)
+{
+    const calc_crc_sum_t *params = _sum_params(crc->type);
+    uint64_t modulus = params->modulus;
+    uint64_t word = 0u;
+
+    for (uint8_t k = 0; k < params->word; k++)
+    {
+        word |= (uint64_t)byte << (8u * k);
+    }
+
+    // Ones' complement sum of nonzero words is never +0.
+    if (true == params->ones)
+    {
+        uint64_t sum = ((words % modulus) * word) % modulus;
+        return ((0u == word) || (0u == words)) ? reg : _fold_inet(reg + ((0u == sum) ? modulus : sum));
+    }
+
+    uint64_t mask = (0u == params->half) ? UINT64_MAX : (((uint64_t)1u << params->half) - 1u);
+    uint64_t a = reg & mask;
+    uint64_t b = (0u == params->half) ? 0u : (reg >> params->half);
+    uint64_t n = words % modulus;
+    uint64_t triangle = (0u == (words & 1u)) ? (((words / 2u) % modulus) * ((words + 1u) % modulus))
+                                             : (n * (((words / 2u) + 1u) % modulus));
+
+    // Word k of the run makes A = A0 + k * w: B gains n * A0 + w * n * (n + 1) / 2, A gains n * w.
+    word %= modulus;
+    b = (b + ((n * a) % modulus) + ((word * (triangle % modulus)) % modulus)) % modulus;
+    a = (a + ((n * word) % modulus)) % modulus;
+
+    return (0u == params->half) ? a : ((b << params->half) | a);
+}
+
+static uint8_t _value_size(calc_crc_type_e type)
+{
+    return (CALC_CRC_TYPE_SUM8 <= type) ? _sum_params(type)->size : (uint8_t)(1u << type);
+}
+
+static void _sum_generic(const uint8_t *data, size_t length, uint8_t word, uint64_t *sum, uint64_t *weighted)
+{
+    uint64_t s = *sum;
+    uint64_t t = *weighted;
+
+    switch (word)
+    {
+        case 4u:
+        {
+            for (size_t i = 0; i < length; i += 4u)
+            {
+                s += _load_le32(&data[i]);
+                t += s;
+            }
+            break;
+        }
+        case 2u:
+        {
+            for (size_t i = 0; i < length; i += 2u)
+            {
+                s += (uint64_t)data[i] | ((uint64_t)data[i + 1u] << 8);
+                t += s;
+            }
+            break;
+        }
+        default:
+        {
+            for (size_t i = 0; i < length; i++)
+            {
+                s += data[i];
+                t += s;
+            }
+            break;
+        }
+    }
+
+    *sum = s;
+    *weighted = t;
+}
+
+static calc_crc_kernel_e _bind_sum_kernel(void)
+{
+    calc_crc_kernel_e force = _kernel_forced();
+
+    // CRC tiers do not apply to checksums, forcing one of them selects the generic kernel.
+#if (1 == CALC_CRC_HW_X86)
+    if (((CALC_CRC_KERNEL_AUTO == force) || (CALC_CRC_KERNEL_AVX2 <= force)) && (true == _cpu_has_avx2()))
+    {
+        return CALC_CRC_KERNEL_AVX2;
+    }
+    if ((CALC_CRC_KERNEL_AUTO == force) || (CALC_CRC_KERNEL_SSE2 <= force))
+    {
+        return CALC_CRC_KERNEL_SSE2; // Baseline of x86-64.
+    }
+#else
+    (void)force;
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+    return CALC_CRC_KERNEL_GENERIC;
+}
+
+static uint64_t _fold_inet(uint64_t sum)
+{
+    sum = (sum & UINT32_MAX) + (sum >> 32);
+    sum = (sum & UINT16_MAX) + (sum >> 16);
+    sum = (sum & UINT16_MAX) + (sum >> 16);
+
+    return (sum & UINT16_MAX) + (sum >> 16);
+}
+
+static uint64_t _update_inet(const calc_crc_t *crc, uint64_t reg, const uint8_t *data, size_t length)
+{
+    // Wide accumulator: 32-bit words are summed without folding (2^32 = 1 modulo 65535), carries are folded per chunk.
+    while (0u != length)
+    {
+        size_t chunk = (CALC_CRC_INET_CHUNK < length) ? CALC_CRC_INET_CHUNK : length;
+        size_t done = 0u;
+        uint64_t sum = 0u;
+
+#if (1 == CALC_CRC_HW_X86)
+        if (CALC_CRC_KERNEL_AVX2 == crc->kernel)
+        {
+            done = _sum_inet_avx2(data, chunk, &sum);
+        }
+        else if (CALC_CRC_KERNEL_SSE2 == crc->kernel)
+        {
+            done = _sum_inet_sse2(data, chunk, &sum);
+        }
+#else
+        (void)crc;
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+        sum = _fold_inet(sum + _fold_inet(_sum_inet_generic(&data[done], chunk - done)));
+
+        // Little-endian words were summed, the sum of big-endian words is the same sum byte swapped (RFC 1071).
+        reg = _fold_inet(reg + (((sum << 8) | (sum >> 8)) & UINT16_MAX));
+        data += chunk;
+        length -= chunk;
+    }
+
+    return reg;
+}
+
+static uint64_t _sum_inet_generic(const uint8_t *data, size_t length)
+{
+    uint64_t sum = 0u;
+    size_t i = 0u;
+
+    for (; (i + 4u) <= length; i += 4u)
+    {
+        sum += _load_le32(&data[i]);
+    }
+    if (i < length)
+    {
+        sum += (uint64_t)data[i] | ((uint64_t)data[i + 1u] << 8);
+    }
+
+    return sum;
+}
+
+static uint64_t _adjust_inet(uint64_t value, size_t offset, const uint8_t *old_bytes, const uint8_t *new_bytes,
+                             size_t length)
+{
+    uint64_t diff = 0u;
+
+    // ~m + m' of every big-endian word of the field, an odd last byte is padded (the unchanged byte cancels out).
+    for (size_t i = 0; i < length; i += 2u)
+    {
+        uint64_t old_word = ((uint64_t)old_bytes[i] << 8) | (((i + 1u) < length) ? old_bytes[i + 1u] : 0u);
+        uint64_t new_word = ((uint64_t)new_bytes[i] << 8) | (((i + 1u) < length) ? new_bytes[i + 1u] : 0u);
+        diff += ((~old_word) & UINT16_MAX) + new_word;
+    }
+    diff = _fold_inet(diff);
+
+    // Field at an odd offset holds the low bytes of the words, its difference is byte swapped.
+    if (0u != (offset & 1u))
+    {
+        diff = ((diff << 8) | (diff >> 8)) & UINT16_MAX;
+    }
+
+    return (~_fold_inet(((~value) & UINT16_MAX) + diff)) & UINT16_MAX;
+}
+
+#if (1 == CALC_CRC_HW_X86)
+
+static void _cpu_detect(void)
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    uint32_t xcr0 = 0u;
+
+    if (false == _once_enter(&_cpu_once))
+    {
+        return;
+    }
+
+    _cpu_ecx = (0 != __get_cpuid(1, &eax, &ebx, &ecx, &edx)) ? (uint32_t)ecx : 0u;
+
+    // YMM registers must also be saved by the operating system (XCR0 bits SSE and AVX).
+    if (0u != (_cpu_ecx & bit_OSXSAVE))
+    {
+        uint32_t high;
+        __asm__ volatile("xgetbv" : "=a"(xcr0), "=d"(high) : "c"(0u));
+        (void)high;
+    }
+    _cpu_avx2 = (0x6u == (xcr0 & 0x6u)) && (0 != __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) &&
+                (0u != (ebx & bit_AVX2));
+
+    _once_leave(&_cpu_once);
+}
+
+static uint32_t _cpu_features(void)
+{
+    _cpu_detect();
+
+    return _cpu_ecx;
+}
+
+static bool _cpu_has_pclmul(void)
+{
+    uint32_t features = _cpu_features();
+    return (0u != (features & bit_PCLMUL)) && (0u != (features & bit_SSSE3));
+}
+
+static bool _cpu_has_sse42(void)
+{
+    return (0u != (_cpu_features() & bit_SSE4_2));
+}
+
+static bool _cpu_has_avx2(void)
+{
+    _cpu_detect();
+
+    return _cpu_avx2;
+}
+
+static bool _once_enter(uint8_t *state)
+{
+    uint8_t expected = CALC_CRC_ONCE_NONE;
+
+    if (CALC_CRC_ONCE_DONE == __atomic_load_n(state, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+    if (true == __atomic_compare_exchange_n(state, &expected, CALC_CRC_ONCE_BUSY, false, __ATOMIC_ACQUIRE,
+                                            __ATOMIC_ACQUIRE))
+    {
+        return true;
+    }
+
+    // Initialization takes microseconds, losers spin until its stores are published.
+    while (CALC_CRC_ONCE_DONE != __atomic_load_n(state, __ATOMIC_ACQUIRE))
+    {
+        __builtin_ia32_pause();
+    }
+
+    return false;
+}
+
+static void _once_leave(uint8_t *state)
+{
+    __atomic_store_n(state, CALC_CRC_ONCE_DONE, __ATOMIC_RELEASE);
+}
+
+static void _crc32c_shift_init(void)
+{
+    if (false == _once_enter(&_crc32c_shift_once))
+    {
+        return;
+    }
+
+    uint64_t xpow_long = _xpow_mod(8u * CALC_CRC_CRC32C_LONG, CALC_CRC_CRC32C_POLYNOMIAL, 32);
+    uint64_t xpow_short = _xpow_mod(8u * CALC_CRC_CRC32C_SHORT, CALC_CRC_CRC32C_POLYNOMIAL, 32);
+
+    // Shift is linear, so every register byte has its own table and results are xored.
+    for (size_t k = 0; k < 4; k++)
+    {
+        for (size_t i = 0; i < 256; i++)
+        {
+            uint32_t reg = _reflect_crc32((uint32_t)i << (8u * k));
+            _crc32c_shift_long[k][i] =
+                _reflect_crc32((uint32_t)_mul_mod(reg, xpow_long, CALC_CRC_CRC32C_POLYNOMIAL, 32));
+            _crc32c_shift_short[k][i] =
+                _reflect_crc32((uint32_t)_mul_mod(reg, xpow_short, CALC_CRC_CRC32C_POLYNOMIAL, 32));
+        }
+    }
+
+    _once_leave(&_crc32c_shift_once);
+}
+
+static uint32_t _crc32c_shift(const uint32_t (*table)[256], uint32_t reg)
+{
+    return table[0][reg & 0xFF] ^ table[1][(reg >> 8) & 0xFF] ^ table[2][(reg >> 16) & 0xFF] ^ table[3][reg >> 24];
+}
+
+__attribute__((target("sse4.2"))) static uint32_t _crc32c_sse42(uint32_t reg, const uint8_t *data, size_t length)
+{
+    uint64_t crc0 = reg;
+
+    // Shift tables were generated by CALC_CRC_Init binding the SSE4.2 tier.
+    for (; (0u != length) && (0u != ((uintptr_t)data & 7u)); data++, length--)
+    {
+        crc0 = _mm_crc32_u8((uint32_t)crc0, *data);
+    }
+
+    // Three independent streams hide latency of CRC32 instruction, results are merged by shifting.
+    for (; length >= (3u * CALC_CRC_CRC32C_LONG); length -= 3u * CALC_CRC_CRC32C_LONG)
+    {
+        uint64_t crc1 = 0, crc2 = 0;
+        const uint8_t *end = data + CALC_CRC_CRC32C_LONG;
+
+        for (; data < end; data += 8)
+        {
+            crc0 = _mm_crc32_u64(crc0, *(const uint64_t *)data);
+            crc1 = _mm_crc32_u64(crc1, *(const uint64_t *)(data + CALC_CRC_CRC32C_LONG));
+            crc2 = _mm_crc32_u64(crc2, *(const uint64_t *)(data + 2u * CALC_CRC_CRC32C_LONG));
+        }
+
+        crc0 = _crc32c_shift(_crc32c_shift_long, (uint32_t)crc0) ^ crc1;
+        crc0 = _crc32c_shift(_crc32c_shift_long, (uint32_t)crc0) ^ crc2;
+        data += 2u * CALC_CRC_CRC32C_LONG;
+    }
+
+    for (; length >= (3u * CALC_CRC_CRC32C_SHORT); length -= 3u * CALC_CRC_CRC32C_SHORT)
+    {
+        uint64_t crc1 = 0, crc2 = 0;
+        const uint8_t *end = data + CALC_CRC_CRC32C_SHORT;
+
+        for (; data < end; data += 8)
+        {
+            crc0 = _mm_crc32_u64(crc0, *(const uint64_t *)data);
+            crc1 = _mm_crc32_u64(crc1, *(const uint64_t *)(data + CALC_CRC_CRC32C_SHORT));
+            crc2 = _mm_crc32_u64(crc2, *(const uint64_t *)(data + 2u * CALC_CRC_CRC32C_SHORT));
+        }
+
+        crc0 = _crc32c_shift(_crc32c_shift_short, (uint32_t)crc0) ^ crc1;
+        crc0 = _crc32c_shift(_crc32c_shift_short, (uint32_t)crc0) ^ crc2;
+        data += 2u * CALC_CRC_CRC32C_SHORT;
+    }
+
+    for (; length >= 8u; data += 8, length -= 8u)
+    {
+        crc0 = _mm_crc32_u64(crc0, *(const uint64_t *)data);
+    }
+
+    for (; 0u != length; data++, length--)
+    {
+        crc0 = _mm_crc32_u8((uint32_t)crc0, *data);
+    }
+
+    return (uint32_t)crc0;
+}
+
+__attribute__((target("sse4.2"))) static void _crc32c_sse42_multi(uint32_t *reg, const uint8_t *const *data,
+                                                                  size_t length)
+{
+    uint64_t crc0 = reg[0], crc1 = reg[1], crc2 = reg[2], crc3 = reg[3];
+    const uint8_t *data0 = data[0], *data1 = data[1], *data2 = data[2], *data3 = data[3];
+    size_t i = 0;
+
+    for (; (i + 8u) <= length; i += 8u)
+    {
+        uint64_t word0, word1, word2, word3;
+        memcpy(&word0, &data0[i], sizeof(uint64_t));
+        memcpy(&word1, &data1[i], sizeof(uint64_t));
+        memcpy(&word2, &data2[i], sizeof(uint64_t));
+        memcpy(&word3, &data3[i], sizeof(uint64_t));
+        crc0 = _mm_crc32_u64(crc0, word0);
+        crc1 = _mm_crc32_u64(crc1, word1);
+        crc2 = _mm_crc32_u64(crc2, word2);
+        crc3 = _mm_crc32_u64(crc3, word3);
+    }
+
+    reg[0] = _crc32c_sse42((uint32_t)crc0, &data0[i], length - i);
+    reg[1] = _crc32c_sse42((uint32_t)crc1, &data1[i], length - i);
+    reg[2] = _crc32c_sse42((uint32_t)crc2, &data2[i], length - i);
+    reg[3] = _crc32c_sse42((uint32_t)crc3, &data3[i], length - i);
+}
+
+__attribute__((target("pclmul,ssse3"))) static inline __m128i _fold_pclmul_step(__m128i value, __m128i constants,
+                                                                                  __m128i next)
+{
+    __m128i low = _mm_clmulepi64_si128(value, constants, 0x00);
+    __m128i high = _mm_clmulepi64_si128(value, constants, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(low, high), next);
+}
+
+__attribute__((target("pclmul,ssse3"))) static size_t _fold_pclmul(const uint64_t *constants, bool reflected,
+                                                                    uint8_t width, uint64_t reg,
+                                                                    const uint8_t *data, size_t length,
+                                                                    uint8_t *residue)
+{
+    // Non-reflected data is loaded as big-endian 128-bit polynomial, reflected data as is.
+    const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i order = (true == reflected)
+                              ? _mm_set_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+                              : swap;
+    const __m128i k512 = _mm_loadu_si128((const __m128i *)&constants[0]);
+    const __m128i k384 = _mm_loadu_si128((const __m128i *)&constants[2]);
+    const __m128i k256 = _mm_loadu_si128((const __m128i *)&constants[4]);
+    const __m128i k128 = _mm_loadu_si128((const __m128i *)&constants[6]);
+    const uint8_t *start = data;
+
+    __m128i x0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&data[0]), order);
+    __m128i x1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&data[16]), order);
+    __m128i x2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&data[32]), order);
+    __m128i x3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&data[48]), order);
+
+    // Register is added to the first width bits of the message.
+    if (true == reflected)
+    {
+        x0 = _mm_xor_si128(x0, _mm_set_epi64x(0, (long long)reg));
+    }
+    else
+    {
+        x0 = _mm_xor_si128(x0, _mm_set_epi64x((long long)(reg << (64u - width)), 0));
+    }
+
+    data += 64;
+    length -= 64;
+
+    for (; length >= 64; data += 64, length -= 64)
+    {
+        x0 = _fold_pclmul_step(x0, k512, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&data[0]), order));
+        x1 = _fold_pclmul_step(x1, k512, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&data[16]), order));
+        x2 = _fold_pclmul_step(x2, k512, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&data[32]), order));
+        x3 = _fold_pclmul_step(x3, k512, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&data[48]), order));
+    }
+
+    x0 = _fold_pclmul_step(x0, k384, _fold_pclmul_step(x1, k256, _fold_pclmul_step(x2, k128, x3)));
+
+    for (; length >= 16; data += 16, length -= 16)
+    {
+        x0 = _fold_pclmul_step(x0, k128, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)data), order));
+    }
+
+    _mm_storeu_si128((__m128i *)residue, _mm_shuffle_epi8(x0, order));
+
+    return (size_t)(data - start);
+}
+
+__attribute__((target("sse2"))) static size_t _sum_bytes_sse2(const uint8_t *data, size_t length, uint64_t *sum,
+                                                                uint64_t *weighted)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i weights_lo = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+    const __m128i weights_hi = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+    __m128i v_sum = zero;
+    __m128i v_prefix = zero;
+    __m128i v_weighted = zero;
+    size_t blocks = length / 16u;
+
+    // Per block: B gains 16 times the sum before the block plus bytes weighted 16..1, A gains the sum of bytes.
+    for (size_t k = 0; k < blocks; k++)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)&data[16u * k]);
+        v_prefix = _mm_add_epi32(v_prefix, v_sum);
+        v_sum = _mm_add_epi32(v_sum, _mm_sad_epu8(x, zero));
+        v_weighted = _mm_add_epi32(v_weighted, _mm_madd_epi16(_mm_unpacklo_epi8(x, zero), weights_lo));
+        v_weighted = _mm_add_epi32(v_weighted, _mm_madd_epi16(_mm_unpackhi_epi8(x, zero), weights_hi));
+    }
+
+    uint32_t lanes_sum[4], lanes_prefix[4], lanes_weighted[4];
+    _mm_storeu_si128((__m128i *)lanes_sum, v_sum);
+    _mm_storeu_si128((__m128i *)lanes_prefix, v_prefix);
+    _mm_storeu_si128((__m128i *)lanes_weighted, v_weighted);
+
+    uint64_t prefix = 0u;
+    *sum = 0u;
+    *weighted = 0u;
+    for (size_t j = 0; j < 4u; j++)
+    {
+        *sum += lanes_sum[j];
+        prefix += lanes_prefix[j];
+        *weighted += lanes_weighted[j];
+    }
+    *weighted += 16u * prefix;
+
+    return 16u * blocks;
+}
+
+__attribute__((target("avx2"))) static size_t _sum_bytes_avx2(const uint8_t *data, size_t length, uint64_t *sum,
+                                                                uint64_t *weighted)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15,
+                                             14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    __m256i v_sum = zero;
+    __m256i v_prefix = zero;
+    __m256i v_weighted = zero;
+    size_t blocks = length / 32u;
+
+    // Per block: B gains 32 times the sum before the block plus bytes weighted 32..1, A gains the sum of bytes.
+    for (size_t k = 0; k < blocks; k++)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)&data[32u * k]);
+        v_prefix = _mm256_add_epi32(v_prefix, v_sum);
+        v_sum = _mm256_add_epi32(v_sum, _mm256_sad_epu8(x, zero));
+        v_weighted = _mm256_add_epi32(v_weighted, _mm256_madd_epi16(_mm256_maddubs_epi16(x, weights), ones));
+    }
+
+    uint32_t lanes_sum[8], lanes_prefix[8], lanes_weighted[8];
+    _mm256_storeu_si256((__m256i *)lanes_sum, v_sum);
+    _mm256_storeu_si256((__m256i *)lanes_prefix, v_prefix);
+    _mm256_storeu_si256((__m256i *)lanes_weighted, v_weighted);
+
+    uint64_t prefix = 0u;
+    *sum = 0u;
+    *weighted = 0u;
+    for (size_t j = 0; j < 8u; j++)
+    {
+        *sum += lanes_sum[j];
+        prefix += lanes_prefix[j];
+        *weighted += lanes_weighted[j];
+    }
+    *weighted += 32u * prefix;
+
+    return 32u * blocks;
+}
+
+__attribute__((target("sse2"))) static size_t _sum_words_sse2(const uint8_t *data, size_t length, uint8_t word,
+                                                                uint64_t *sum, uint64_t *weighted)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a_lo = zero;
+    __m128i a_hi = zero;
+    __m128i b_lo = zero;
+    __m128i b_hi = zero;
+    size_t blocks = length / 16u;
+    uint64_t lane_sum[8];
+    uint64_t lane_weighted[8];
+
+    // Words are zero extended into lanes (32-bit lanes for 16-bit words, 64-bit lanes for 32-bit words).
+    if (2u == word)
+    {
+        for (size_t k = 0; k < blocks; k++)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)&data[16u * k]);
+            a_lo = _mm_add_epi32(a_lo, _mm_unpacklo_epi16(x, zero));
+            a_hi = _mm_add_epi32(a_hi, _mm_unpackhi_epi16(x, zero));
+            b_lo = _mm_add_epi32(b_lo, a_lo);
+            b_hi = _mm_add_epi32(b_hi, a_hi);
+        }
+
+        uint32_t lanes[4][4];
+        _mm_storeu_si128((__m128i *)lanes[0], a_lo);
+        _mm_storeu_si128((__m128i *)lanes[1], a_hi);
+        _mm_storeu_si128((__m128i *)lanes[2], b_lo);
+        _mm_storeu_si128((__m128i *)lanes[3], b_hi);
+        for (size_t j = 0; j < 8u; j++)
+        {
+            lane_sum[j] = lanes[j / 4u][j % 4u];
+            lane_weighted[j] = lanes[2u + (j / 4u)][j % 4u];
+        }
+        _sum_lanes(lane_sum, lane_weighted, 8u, sum, weighted);
+    }
+    else
+    {
+        for (size_t k = 0; k < blocks; k++)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)&data[16u * k]);
+            a_lo = _mm_add_epi64(a_lo, _mm_unpacklo_epi32(x, zero));
+            a_hi = _mm_add_epi64(a_hi, _mm_unpackhi_epi32(x, zero));
+            b_lo = _mm_add_epi64(b_lo, a_lo);
+            b_hi = _mm_add_epi64(b_hi, a_hi);
+        }
+
+        _mm_storeu_si128((__m128i *)&lane_sum[0], a_lo);
+        _mm_storeu_si128((__m128i *)&lane_sum[2], a_hi);
+        _mm_storeu_si128((__m128i *)&lane_weighted[0], b_lo);
+        _mm_storeu_si128((__m128i *)&lane_weighted[2], b_hi);
+        _sum_lanes(lane_sum, lane_weighted, 4u, sum, weighted);
+    }
+
+    return 16u * blocks;
+}
+
+__attribute__((target("avx2"))) static size_t _sum_words_avx2(const uint8_t *data, size_t length, uint8_t word,
+                                                                uint64_t *sum, uint64_t *weighted)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i a_lo = zero;
+    __m256i a_hi = zero;
+    __m256i b_lo = zero;
+    __m256i b_hi = zero;
+    size_t blocks = length / 32u;
+    uint64_t lane_sum[16];
+    uint64_t lane_weighted[16];
+
+    // Words are zero extended into lanes (32-bit lanes for 16-bit words, 64-bit lanes for 32-bit words).
+    if (2u == word)
+    {
+        for (size_t k = 0; k < blocks; k++)
+        {
+            __m256i x_lo = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&data[32u * k]));
+            __m256i x_hi = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&data[(32u * k) + 16u]));
+            a_lo = _mm256_add_epi32(a_lo, x_lo);
+            a_hi = _mm256_add_epi32(a_hi, x_hi);
+            b_lo = _mm256_add_epi32(b_lo, a_lo);
+            b_hi = _mm256_add_epi32(b_hi, a_hi);
+        }
+
+        uint32_t lanes[4][8];
+        _mm256_storeu_si256((__m256i *)lanes[0], a_lo);
+        _mm256_storeu_si256((__m256i *)lanes[1], a_hi);
+        _mm256_storeu_si256((__m256i *)lanes[2], b_lo);
+        _mm256_storeu_si256((__m256i *)lanes[3], b_hi);
+        for (size_t j = 0; j < 16u; j++)
+        {
+            lane_sum[j] = lanes[j / 8u][j % 8u];
+            lane_weighted[j] = lanes[2u + (j / 8u)][j % 8u];
+        }
+        _sum_lanes(lane_sum, lane_weighted, 16u, sum, weighted);
+    }
+    else
+    {
+        for (size_t k = 0; k < blocks; k++)
+        {
+            __m256i x_lo = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)&data[32u * k]));
+            __m256i x_hi = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)&data[(32u * k) + 16u]));
+            a_lo = _mm256_add_epi64(a_lo, x_lo);
+            a_hi = _mm256_add_epi64(a_hi, x_hi);
+            b_lo = _mm256_add_epi64(b_lo, a_lo);
+            b_hi = _mm256_add_epi64(b_hi, a_hi);
+        }
+
+        _mm256_storeu_si256((__m256i *)&lane_sum[0], a_lo);
+        _mm256_storeu_si256((__m256i *)&lane_sum[4], a_hi);
+        _mm256_storeu_si256((__m256i *)&lane_weighted[0], b_lo);
+        _mm256_storeu_si256((__m256i *)&lane_weighted[4], b_hi);
+        _sum_lanes(lane_sum, lane_weighted, 8u, sum, weighted);
+    }
+
+    return 32u * blocks;
+}
+
+static void _sum_lanes(const uint64_t *lane_sum, const uint64_t *lane_weighted, size_t lanes, uint64_t *sum,
+                       uint64_t *weighted)
+{
+    uint64_t s = 0u;
+    uint64_t t = 0u;
+
+    // Word j of block k is followed by (blocks - k) * lanes - j words: lanes * sum(B) - sum(j * A) over all lanes.
+    for (size_t j = 0; j < lanes; j++)
+    {
+        s += lane_sum[j];
+        t += (lanes * lane_weighted[j]) - (j * lane_sum[j]);
+    }
+
+    *sum = s;
+    *weighted = t;
+}
+
+__attribute__((target("sse2"))) static size_t _sum_inet_sse2(const uint8_t *data, size_t length, uint64_t *sum)
+{
+    const __m128i mask = _mm_set1_epi64x(UINT32_MAX);
+    __m128i even = _mm_setzero_si128();
+    __m128i odd = _mm_setzero_si128();
+    size_t blocks = length / 16u;
+
+    // Even words are masked and odd words shifted into 64-bit lanes, no shuffles are needed.
+    for (size_t k = 0; k < blocks; k++)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)&data[16u * k]);
+        even = _mm_add_epi64(even, _mm_and_si128(x, mask));
+        odd = _mm_add_epi64(odd, _mm_srli_epi64(x, 32));
+    }
+
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(even, odd));
+    *sum = lanes[0] + lanes[1];
+
+    return 16u * blocks;
+}
+
+__attribute__((target("avx2"))) static size_t _sum_inet_avx2(const uint8_t *data, size_t length, uint64_t *sum)
+{
+    const __m256i mask = _mm256_set1_epi64x(UINT32_MAX);
+    __m256i even0 = _mm256_setzero_si256();
+    __m256i odd0 = _mm256_setzero_si256();
+    __m256i even1 = _mm256_setzero_si256();
+    __m256i odd1 = _mm256_setzero_si256();
+    size_t blocks = length / 32u;
+    size_t k = 0;
+
+    // Even words are masked and odd words shifted into 64-bit lanes, two blocks per step keep both load ports busy.
+    for (; (k + 2u) <= blocks; k += 2u)
+    {
+        __m256i x0 = _mm256_loadu_si256((const __m256i *)&data[32u * k]);
+        __m256i x1 = _mm256_loadu_si256((const __m256i *)&data[(32u * k) + 32u]);
+        even0 = _mm256_add_epi64(even0, _mm256_and_si256(x0, mask));
+        odd0 = _mm256_add_epi64(odd0, _mm256_srli_epi64(x0, 32));
+        even1 = _mm256_add_epi64(even1, _mm256_and_si256(x1, mask));
+        odd1 = _mm256_add_epi64(odd1, _mm256_srli_epi64(x1, 32));
+    }
+    if (k < blocks)
+    {
+        __m256i x0 = _mm256_loadu_si256((const __m256i *)&data[32u * k]);
+        even0 = _mm256_add_epi64(even0, _mm256_and_si256(x0, mask));
+        odd0 = _mm256_add_epi64(odd0, _mm256_srli_epi64(x0, 32));
+    }
+
+    uint64_t lanes[4];
+    __m256i total = _mm256_add_epi64(_mm256_add_epi64(even0, odd0), _mm256_add_epi64(even1, odd1));
+    _mm256_storeu_si256((__m256i *)lanes, total);
+    *sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+    return 32u * blocks;
+}
+
+#endif /* (1 == CALC_CRC_HW_X86) */
+
+static inline uint32_t _load_le32(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static inline uint32_t _load_be32(const uint8_t *data)
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+}
+
+static uint64_t _bitwise_crc(uint64_t polynomial, uint8_t width, bool reflected, uint64_t reg, const uint8_t *data,
+                             size_t length)
+{
+    uint64_t top = (uint64_t)1u << (width - 1u);
+    uint64_t mask = (top - 1u) | top;
+
+    if (true == reflected)
+    {
+        uint64_t reflected_polynomial = _reflect_crc64(polynomial) >> (64u - width);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            reg ^= data[i];
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                reg = (reg >> 1) ^ (reflected_polynomial & (0u - (reg & 1u)));
+            }
+        }
+
+        return reg;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        reg ^= (uint64_t)data[i] << (width - 8u);
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            reg = ((reg << 1) ^ (polynomial & (0u - ((reg & top) >> (width - 1u))))) & mask;
+        }
+    }
+
+    return reg;
+}
+
+static uint8_t _engine_select(uint8_t engine)
+{
+#ifdef CALC_CRC_CONF_ENGINE
+    (void)engine;
+    return (uint8_t)CALC_CRC_CONF_ENGINE;
+#else
+    return engine;
+#endif /* CALC_CRC_CONF_ENGINE */
+}
+
+static bool _is_valid_slices(uint8_t slices)
+{
+    return (slices <= 1u) || (4u == slices) || (8u == slices) || (16u == slices);
+}
+
+static uint8_t _reflect_crc8(uint8_t data)
+{
+    data = (uint8_t)(((data & 0xF0u) >> 4) | ((data & 0x0Fu) << 4));
+    data = (uint8_t)(((data & 0xCCu) >> 2) | ((data & 0x33u) << 2));
+    data = (uint8_t)(((data & 0xAAu) >> 1) | ((data & 0x55u) << 1));
+    return data;
+}
+
+static uint16_t _reflect_crc16(uint16_t data)
+{
+    data = (uint16_t)((data >> 8) | (data << 8));
+    data = (uint16_t)(((data & 0xF0F0u) >> 4) | ((data & 0x0F0Fu) << 4));
+    data = (uint16_t)(((data & 0xCCCCu) >> 2) | ((data & 0x3333u) << 2));
+    data = (uint16_t)(((data & 0xAAAAu) >> 1) | ((data & 0x5555u) << 1));
+    return data;
+}
+
+static uint32_t _reflect_crc32(uint32_t data)
+{
+    data = (data >> 16) | (data << 16);
+    data = ((data & 0xFF00FF00u) >> 8) | ((data & 0x00FF00FFu) << 8);
+    data = ((data & 0xF0F0F0F0u) >> 4) | ((data & 0x0F0F0F0Fu) << 4);
+    data = ((data & 0xCCCCCCCCu) >> 2) | ((data & 0x33333333u) << 2);
+    data = ((data & 0xAAAAAAAAu) >> 1) | ((data & 0x55555555u) << 1);
+    return data;
+}
+
+static uint64_t _reflect_crc64(uint64_t data)
+{
+    data = (data >> 32) | (data << 32);
+    data = ((data & 0xFFFF0000FFFF0000ull) >> 16) | ((data & 0x0000FFFF0000FFFFull) << 16);
+    data = ((data & 0xFF00FF00FF00FF00ull) >> 8) | ((data & 0x00FF00FF00FF00FFull) << 8);
+    data = ((data & 0xF0F0F0F0F0F0F0F0ull) >> 4) | ((data & 0x0F0F0F0F0F0F0F0Full) << 4);
+    data = ((data & 0xCCCCCCCCCCCCCCCCull) >> 2) | ((data & 0x3333333333333333ull) << 2);
+    data = ((data & 0xAAAAAAAAAAAAAAAAull) >> 1) | ((data & 0x5555555555555555ull) << 1);
+    return data;
+}
+
+static calc_crc_kernel_e _kernel_from_name(const char *name)
+{
+    static const char *const names[CALC_CRC_KERNEL_MAX] = {"auto",   "generic", "slicing", "sse42",
+                                                            "pclmul", "sse2",    "avx2"};
+
+    for (uint8_t i = 0; (NULL != name) && (i < CALC_CRC_KERNEL_MAX); i++)
+    {
+        if (0 == strcmp(name, names[i]))
+        {
+            return (calc_crc_kernel_e)i;
         }
-        default:
-            break;
     }
 
-    return CALC_CRC_STATUS_OK;
+    return CALC_CRC_KERNEL_AUTO;
 }
 
-calc_crc_status_e CALC_CRC_Calculate(calc_crc_t *crc, const void *data, size_t length, void *result)
+static calc_crc_kernel_e _kernel_forced(void)
 {
-    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_SIZE(length, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    int8_t force = __atomic_load_n(&_kernel_force, __ATOMIC_ACQUIRE);
 
-    if (CALC_CRC_TYPE_MAX <= crc->type)
+    if (0 > force)
     {
-        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
-    }
+        int8_t expected = -1;
 
-    switch (crc->type)
-    {
-        case CALC_CRC_TYPE_8BIT: // ---- 8-bit calculator
-        {
-            calc_crc_8bit_t *conf = (calc_crc_8bit_t *)crc->conf;
-            uint8_t *calc = (uint8_t *)result;
-            *calc = _calc_crc8(crc, conf, data, length);
-            break;
-        }
-        case CALC_CRC_TYPE_16BIT: // --- 16-bit calculator
-        {
-            calc_crc_16bit_t *conf = (calc_crc_16bit_t *)crc->conf;
-            uint16_t *calc = (uint16_t *)result;
-            *calc = _calc_crc16(crc, conf, data, length);
-            break;
-        }
-        case CALC_CRC_TYPE_32BIT: // --- 32-bit calculator
-        {
-            calc_crc_32bit_t *conf = (calc_crc_32bit_t *)crc->conf;
-            uint32_t *calc = (uint32_t *)result;
-            *calc = _calc_crc32(crc, conf, data, length);
-            break;
-        }
-        case CALC_CRC_TYPE_64BIT: // --- 64-bit calculator
-        {
-            calc_crc_64bit_t *conf = (calc_crc_64bit_t *)crc->conf;
-            uint64_t *calc = (uint64_t *)result;
-            *calc = _calc_crc64(crc, conf, data, length);
-            break;
-        }
-        default: // -------------------- Default exit (should not come to here)
+        // Only replaces the unread state, a kernel set by CALC_CRC_SetKernel meanwhile is kept (no thread waits).
+        force = (int8_t)_kernel_from_name(getenv(CALC_CRC_KERNEL_ENV));
+        if (false == __atomic_compare_exchange_n(&_kernel_force, &expected, force, false, __ATOMIC_ACQ_REL,
+                                                 __ATOMIC_ACQUIRE))
         {
-            break;
+            force = expected;
         }
     }
 
-    return CALC_CRC_STATUS_OK;
+    return (calc_crc_kernel_e)force;
 }
 
-calc_crc_status_e CALC_CRC_Update(calc_crc_t *crc, const void *data, size_t length)
+static calc_crc_kernel_e _bind_kernel(const calc_crc_t *crc, bool crc32c)
 {
-    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_SIZE(length, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    calc_crc_kernel_e force = _kernel_forced();
 
-    if (CALC_CRC_TYPE_MAX <= crc->type)
+    // Checksum tiers are above all CRC tiers, forcing one of them does not limit CRC kernels.
+    if (CALC_CRC_KERNEL_PCLMUL < force)
     {
-        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+        force = CALC_CRC_KERNEL_AUTO;
     }
 
-    if (false == crc->update_in_progress)
+    // Forced tier is the highest one allowed, unsupported tiers fall back to table kernels.
+#if (1 == CALC_CRC_HW_X86)
+    if (((CALC_CRC_KERNEL_AUTO == force) || (CALC_CRC_KERNEL_SSE42 == force)) && (true == crc32c) &&
+        (true == _cpu_has_sse42()))
     {
-        crc->update_crc = (uint64_t)0u;
-        crc->update_chunk = (size_t)0u;
-        crc->update_in_progress = true;
+        return CALC_CRC_KERNEL_SSE42;
     }
+    if (((CALC_CRC_KERNEL_AUTO == force) || (CALC_CRC_KERNEL_PCLMUL == force)) && (true == _cpu_has_pclmul()))
+    {
+        return CALC_CRC_KERNEL_PCLMUL;
+    }
+#else
+    (void)crc32c;
+#endif /* (1 == CALC_CRC_HW_X86) */
 
-    uint64_t output = 0;
-    calc_crc_status_e result = CALC_CRC_Calculate(crc, data, length, &output);
-
-    if (CALC_CRC_STATUS_OK != result)
+    if ((CALC_CRC_KERNEL_GENERIC != force) && (1u < crc->slices))
     {
-        crc->update_in_progress = false;
+        return CALC_CRC_KERNEL_SLICING;
     }
 
-    return result;
+    return CALC_CRC_KERNEL_GENERIC;
 }
 
-calc_crc_status_e CALC_CRC_Finalize(calc_crc_t *crc, void *result)
+static bool _batch_lanes(const calc_crc_t *crc, const size_t *length)
 {
-    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    // Slicing already overlaps lookups, also below the folding threshold of the PCLMUL tier (SSE4.2 CRC-32C lanes
+    // are interleaved in hardware). Folding is faster for long buffers.
+    if ((CALC_CRC_ENGINE_TABLE != crc->engine) ||
+        ((1u < crc->slices) && (CALC_CRC_KERNEL_GENERIC != crc->kernel) && (CALC_CRC_KERNEL_SSE42 != crc->kernel)))
+    {
+        return false;
+    }
 
-    if (false == crc->update_in_progress)
+    for (size_t k = 0; (CALC_CRC_KERNEL_PCLMUL == crc->kernel) && (k < CALC_CRC_BATCH_LANES); k++)
     {
-        return CALC_CRC_STATUS_ERROR_UPDATE_NOT_STARTED;
+        if (CALC_CRC_FOLD_MIN_LENGTH <= length[k])
+        {
+            return false;
+        }
     }
 
+    return true;
+}
+
+static uint64_t _initial_crc(const calc_crc_t *crc)
+{
     switch (crc->type)
     {
         case CALC_CRC_TYPE_8BIT: // ---- 8-bit calculator
         {
-            uint8_t *output = (uint8_t *)result;
-            *output = (uint8_t)crc->update_crc_final;
-            break;
+            return _initial_crc8(crc, (const calc_crc_8bit_t *)crc->conf);
         }
         case CALC_CRC_TYPE_16BIT: // --- 16-bit calculator
         {
-            uint16_t *output = (uint16_t *)result;
-            *output = (uint16_t)crc->update_crc_final;
-            break;
+            return _initial_crc16(crc, (const calc_crc_16bit_t *)crc->conf);
         }
         case CALC_CRC_TYPE_32BIT: // --- 32-bit calculator
         {
-            uint32_t *output = (uint32_t *)result;
-            *output = (uint32_t)crc->update_crc_final;
-            break;
+            return _initial_crc32(crc, (const calc_crc_32bit_t *)crc->conf);
         }
         case CALC_CRC_TYPE_64BIT: // --- 64-bit calculator
         {
-            uint64_t *output = (uint64_t *)result;
-            *output = (uint64_t)crc->update_crc_final;
-            break;
+            return _initial_crc64(crc, (const calc_crc_64bit_t *)crc->conf);
         }
-        default: // -------------------- Default exit (should not come to here)
+        default: // -------------------- Checksums
         {
-            break;
+            return _initial_sum(crc);
         }
     }
-
-    crc->update_in_progress = false;
-
-    return CALC_CRC_STATUS_OK;
 }
 
-// --- Private Functions Definitions -----------------------------------------------------------------------------------
-
-static void _calc_table_crc8(uint8_t *table, uint8_t polynomial)
+static uint64_t _update_crc(const calc_crc_t *crc, uint64_t reg, const uint8_t *data, size_t length)
 {
-    for (size_t dividend = 0; dividend < 256; dividend++)
+    switch (crc->type)
     {
-        uint8_t cbyte = (uint8_t)dividend;
-
-        for (uint8_t bit = 0; bit < 8; bit++)
+        case CALC_CRC_TYPE_8BIT: // ---- 8-bit calculator
         {
-            if ((cbyte & 0x80) != 0)
-            {
-                cbyte <<= 1;
-                cbyte ^= polynomial;
-            }
-            else
-            {
-                cbyte <<= 1;
-            }
+            return _update_crc8(crc, (const calc_crc_8bit_t *)crc->conf, (uint8_t)reg, data, length);
         }
-
-        table[dividend] = cbyte;
-    }
-}
-
-static void _calc_table_crc16(uint16_t *table, uint16_t polynomial)
-{
-    for (size_t dividend = 0; dividend < 256; dividend++)
-    {
-        uint16_t cbyte = (uint16_t)(dividend << 8);
-
-        for (uint8_t bit = 0; bit < 8; bit++)
+        case CALC_CRC_TYPE_16BIT: // --- 16-bit calculator
         {
-            if ((cbyte & 0x8000) != 0)
-            {
-                cbyte <<= 1;
-                cbyte ^= polynomial;
-            }
-            else
-            {
-                cbyte <<= 1;
-            }
+            return _update_crc16(crc, (const calc_crc_16bit_t *)crc->conf, (uint16_t)reg, data, length);
+        }
+        case CALC_CRC_TYPE_32BIT: // --- 32-bit calculator
+        {
+            return _update_crc32(crc, (const calc_crc_32bit_t *)crc->conf, (uint32_t)reg, data, length);
+        }
+        case CALC_CRC_TYPE_64BIT: // --- 64-bit calculator
+        {
+            return _update_crc64(crc, (const calc_crc_64bit_t *)crc->conf, reg, data, length);
+        }
+        default: // -------------------- Checksums
+        {
+            return _update_sum(crc, reg, data, length);
         }
-
-        table[dividend] = cbyte;
     }
 }
 
-static void _calc_table_crc32(uint32_t *table, uint32_t polynomial)
+static uint64_t _update_vec(const calc_crc_t *crc, uint64_t reg, uint32_t *tail, uint8_t *tail_length,
+                            const calc_crc_iovec_t *iov, size_t count)
 {
-    for (size_t dividend = 0; dividend < 256; dividend++)
+    uint8_t gather[CALC_CRC_VEC_GATHER];
+    size_t gathered = 0;
+
+    for (size_t i = 0; i < count; i++)
     {
-        uint32_t cbyte = (uint32_t)(dividend << 24);
+        const uint8_t *data = (const uint8_t *)iov[i].base;
+        size_t length = iov[i].length;
 
-        for (uint8_t bit = 0; bit < 8; bit++)
+        // Short segments (headers, trailers, fragments) cost more in kernel entry than in data, so they are joined.
+        if (CALC_CRC_VEC_GATHER_MIN > length)
         {
-            if ((cbyte & 0x80000000) != 0)
+            if ((CALC_CRC_VEC_GATHER - gathered) < length)
             {
-                cbyte <<= 1;
-                cbyte ^= polynomial;
+                reg = _update_tail(crc, reg, tail, tail_length, gather, gathered);
+                gathered = 0;
             }
-            else
+            for (size_t k = 0; k < length; k++)
             {
-                cbyte <<= 1;
+                gather[gathered + k] = data[k];
             }
+            gathered += length;
+            continue;
         }
 
-        table[dividend] = cbyte;
+        if (0u != gathered)
+        {
+            reg = _update_tail(crc, reg, tail, tail_length, gather, gathered);
+            gathered = 0;
+        }
+        reg = _update_tail(crc, reg, tail, tail_length, data, length);
     }
+
+    return (0u != gathered) ? _update_tail(crc, reg, tail, tail_length, gather, gathered) : reg;
 }
 
-static void _calc_table_crc64(uint64_t *table, uint64_t polynomial)
+static uint64_t _update_tail(const calc_crc_t *crc, uint64_t reg, uint32_t *tail, uint8_t *tail_length,
+                             const uint8_t *data, size_t length)
 {
-    for (size_t dividend = 0; dividend < 256; dividend++)
+    uint8_t word = _sum_word(crc->type);
+
+    if (1u == word)
     {
-        uint64_t cbyte = (uint64_t)(dividend << 56);
+        return _update_crc(crc, reg, data, length);
+    }
 
-        for (uint8_t bit = 0; bit < 8; bit++)
+    // Incomplete word of the previous call is completed first, so the kernel always sees whole words.
+    while ((0u != *tail_length) && (0u != length))
+    {
+        *tail |= (uint32_t)*data << (8u * *tail_length);
+        (*tail_length)++;
+        data++;
+        length--;
+        if (word == *tail_length)
         {
-            if ((cbyte & 0x8000000000000000) != 0)
-            {
-                cbyte <<= 1;
-                cbyte ^= polynomial;
-            }
-            else
-            {
-                cbyte <<= 1;
-            }
+            uint8_t bytes[4] = {(uint8_t)*tail, (uint8_t)(*tail >> 8), (uint8_t)(*tail >> 16), (uint8_t)(*tail >> 24)};
+            reg = _update_crc(crc, reg, bytes, word);
+            *tail = 0u;
+            *tail_length = 0u;
         }
-
-        table[dividend] = cbyte;
     }
-}
 
-static uint8_t _calc_crc8(calc_crc_t *crc, calc_crc_8bit_t *conf, const uint8_t *data, size_t length)
-{
-    uint8_t result = conf->initial_value;
+    size_t whole = length - (length % word);
 
-    if (true == crc->update_in_progress)
+    if (0u != whole)
     {
-        if (0 != crc->update_chunk)
-        {
-            result = (uint8_t)crc->update_crc;
-        }
-        crc->update_chunk++;
+        reg = _update_crc(crc, reg, data, whole);
     }
-
-    for (size_t i = 0; i < length; i++)
+    for (size_t i = whole; i < length; i++)
     {
-        uint8_t byte = conf->input_reflected ? _reflect_crc8(data[i]) : data[i];
-        result = conf->table[result ^ byte];
+        *tail |= (uint32_t)data[i] << (8u * *tail_length);
+        (*tail_length)++;
     }
 
-    UPDATE_CRC();
-
-    result = result ^ conf->final_value;
+    return reg;
+}
 
-    if (conf->output_reflected)
+static uint64_t _flush_tail(const calc_crc_t *crc, uint64_t reg, uint32_t *tail, uint8_t *tail_length)
+{
+    if (0u != *tail_length)
     {
-        result = _reflect_crc8(result);
+        uint8_t bytes[4] = {(uint8_t)*tail, (uint8_t)(*tail >> 8), (uint8_t)(*tail >> 16), (uint8_t)(*tail >> 24)};
+        reg = _update_crc(crc, reg, bytes, _sum_word(crc->type));
+        *tail = 0u;
+        *tail_length = 0u;
     }
 
-    UPDATE_FINAL();
-
-    return result;
+    return reg;
 }
 
-static uint16_t _calc_crc16(calc_crc_t *crc, calc_crc_16bit_t *conf, const uint8_t *data, size_t length)
+static uint64_t _update_fill(const calc_crc_t *crc, uint64_t reg, uint32_t *tail, uint8_t *tail_length, uint8_t byte,
+                             size_t count)
 {
-    uint16_t result = conf->initial_value;
+    uint8_t word = _sum_word(crc->type);
+    uint8_t fill[4] = {byte, byte, byte, byte};
+    size_t head = (0u != *tail_length) ? (size_t)(word - *tail_length) : 0u;
 
-    if (true == crc->update_in_progress)
+    head = (head < count) ? head : count;
+    if (0u != head)
     {
-        if (0 != crc->update_chunk)
-        {
-            result = (uint16_t)crc->update_crc;
-        }
-        crc->update_chunk++;
+        reg = _update_tail(crc, reg, tail, tail_length, fill, head);
+        count -= head;
     }
 
-    for (size_t i = 0; i < length; i++)
+    // Whole words of the run in O(log n) (CRC) or O(1) (checksums), the rest is carried as an incomplete word.
+    if (word <= count)
     {
-        uint8_t byte = conf->input_reflected ? _reflect_crc8(data[i]) : data[i];
-        uint8_t pos = (uint8_t)((result >> 8) ^ byte);
-        result = (uint16_t)(result << 8) ^ conf->table[pos];
+        reg = (CALC_CRC_TYPE_SUM8 > crc->type) ? _fill_crc(crc, reg, byte, count)
+                                               : _fill_sum(crc, reg, byte, count / word);
     }
-
-    UPDATE_CRC();
-
-    result = result ^ conf->final_value;
-
-    if (conf->output_reflected)
+    if (0u != (count % word))
     {
-        result = _reflect_crc16(result);
+        reg = _update_tail(crc, reg, tail, tail_length, fill, count % word);
     }
 
-    UPDATE_FINAL();
-
-    return result;
+    return reg;
 }
 
-static uint32_t _calc_crc32(calc_crc_t *crc, calc_crc_32bit_t *conf, const uint8_t *data, size_t length)
+static uint64_t _load_value(const void *value, uint8_t size)
 {
-    uint32_t result = conf->initial_value;
-
-    if (true == crc->update_in_progress)
+    switch (size)
     {
-        if (0 != crc->update_chunk)
+        case sizeof(uint8_t):
         {
-            result = (uint32_t)crc->update_crc;
+            return *(const uint8_t *)value;
+        }
+        case sizeof(uint16_t):
+        {
+            return *(const uint16_t *)value;
+        }
+        case sizeof(uint32_t):
+        {
+            return *(const uint32_t *)value;
+        }
+        default:
+        {
+            return *(const uint64_t *)value;
         }
-        crc->update_chunk++;
-    }
-
-    for (size_t i = 0; i < length; i++)
-    {
-        uint8_t byte = conf->input_reflected ? _reflect_crc8(data[i]) : data[i];
-        uint8_t pos = (uint8_t)((result ^ ((uint32_t)byte << 24)) >> 24);
-        result = (result << 8) ^ conf->table[pos];
-    }
-
-    UPDATE_CRC();
-
-    result = result ^ conf->final_value;
-
-    if (conf->output_reflected)
-    {
-        result = _reflect_crc32(result);
     }
-
-    UPDATE_FINAL();
-
-    return result;
 }
 
-static uint64_t _calc_crc64(calc_crc_t *crc, calc_crc_64bit_t *conf, const uint8_t *data, size_t length)
+static void _store_value(void *result, uint64_t value, uint8_t size)
 {
-    uint64_t result = conf->initial_value;
-
-    if (true == crc->update_in_progress)
+    switch (size)
     {
-        if (0 != crc->update_chunk)
+        case sizeof(uint8_t):
+        {
+            *(uint8_t *)result = (uint8_t)value;
+            break;
+        }
+        case sizeof(uint16_t):
         {
-            result = (uint64_t)crc->update_crc;
+            *(uint16_t *)result = (uint16_t)value;
+            break;
+        }
+        case sizeof(uint32_t):
+        {
+            *(uint32_t *)result = (uint32_t)value;
+            break;
+        }
+        default:
+        {
+            *(uint64_t *)result = value;
+            break;
         }
-        crc->update_chunk++;
     }
+}
 
-    for (size_t i = 0; i < length; i++)
+static void _final_crc(const calc_crc_t *crc, uint64_t reg, void *result)
+{
+    switch (crc->type)
     {
-        uint8_t byte = conf->input_reflected ? _reflect_crc8(data[i]) : data[i];
-        uint8_t pos = (uint8_t)((result ^ ((uint64_t)byte << 56)) >> 56);
-        result = (uint64_t)(result << 8) ^ conf->table[pos];
+        case CALC_CRC_TYPE_8BIT: // ---- 8-bit calculator
+        {
+            *(uint8_t *)result = _final_crc8(crc, (const calc_crc_8bit_t *)crc->conf, (uint8_t)reg);
+            break;
+        }
+        case CALC_CRC_TYPE_16BIT: // --- 16-bit calculator
+        {
+            *(uint16_t *)result = _final_crc16(crc, (const calc_crc_16bit_t *)crc->conf, (uint16_t)reg);
+            break;
+        }
+        case CALC_CRC_TYPE_32BIT: // --- 32-bit calculator
+        {
+            *(uint32_t *)result = _final_crc32(crc, (const calc_crc_32bit_t *)crc->conf, (uint32_t)reg);
+            break;
+        }
+        case CALC_CRC_TYPE_64BIT: // --- 64-bit calculator
+        {
+            *(uint64_t *)result = _final_crc64(crc, (const calc_crc_64bit_t *)crc->conf, reg);
+            break;
+        }
+        default: // -------------------- Checksums
+        {
+            _store_value(result, _final_sum(crc, reg), _sum_params(crc->type)->size);
+            break;
+        }
     }
+}
 
-    UPDATE_CRC();
-
-    result = result ^ conf->final_value;
-
-    if (conf->output_reflected)
+static bool _valid_vec(const calc_crc_iovec_t *iov, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
     {
-        result = _reflect_crc64(result);
+        if ((NULL == iov[i].base) && (0u != iov[i].length))
+        {
+            return false;
+        }
     }
 
-    UPDATE_FINAL();
-
-    return result;
+    return true;
 }
 
-static uint8_t _reflect_crc8(uint8_t data)
+static inline uint64_t _roll_crc(const calc_crc_rolling_t *rolling, uint64_t reg, uint8_t out, uint8_t in)
 {
-    uint8_t reflection = 0;
-    for (uint8_t i = 0; i < 8; i++)
+    if (true == rolling->reflected)
     {
-        if (data & (1 << i))
-            reflection |= (1 << (7 - i));
+        reg = (reg >> 8) ^ rolling->table[(reg ^ in) & 0xFFu];
     }
-    return reflection;
-}
-
-static uint16_t _reflect_crc16(uint16_t data)
-{
-    uint16_t reflection = 0;
-    for (uint8_t i = 0; i < 16; i++)
+    else
     {
-        if (data & (1 << i))
-            reflection |= (1 << (15 - i));
+        reg = ((reg << 8) & rolling->mask) ^ rolling->table[((reg >> (rolling->bits - 8u)) ^ in) & 0xFFu];
     }
-    return reflection;
+
+    return reg ^ rolling->out_table[out];
 }
 
-static uint32_t _reflect_crc32(uint32_t data)
+static bool _rolling_mask(const calc_crc_rolling_t *rolling, uint64_t mask, uint64_t match, uint64_t *reg_mask,
+                          uint64_t *reg_match)
 {
-    uint32_t reflection = 0;
-    for (uint8_t i = 0; i < 32; i++)
+    uint8_t size = _value_size(rolling->crc->type);
+    uint64_t value = 0u;
+    uint64_t zero = 0u;
+    uint64_t covered = 0u;
+
+    if (0u != (match & ~mask))
     {
-        if (data & (1U << i))
-            reflection |= (1U << (31 - i));
+        return false;
     }
-    return reflection;
-}
 
-static uint64_t _reflect_crc64(uint64_t data)
-{
-    uint64_t reflection = 0;
-    for (uint8_t i = 0; i < 64; i++)
+    // Finalization is an XOR with the value of a zero register and a bit permutation of the register.
+    _final_crc(rolling->crc, 0u, &zero);
+    zero = _load_value(&zero, size);
+    match ^= zero & mask;
+    *reg_mask = 0u;
+    *reg_match = 0u;
+
+    for (uint8_t i = 0; i < rolling->bits; i++)
     {
-        if (data & (1ULL << i))
-            reflection |= (1ULL << (63 - i));
+        _final_crc(rolling->crc, (uint64_t)1u << i, &value);
+        value = _load_value(&value, size) ^ zero;
+        covered |= value;
+        if (0u != (value & mask))
+        {
+            *reg_mask |= (uint64_t)1u << i;
+        }
+        if (0u != (value & match))
+        {
+            *reg_match |= (uint64_t)1u << i;
+        }
     }
-    return reflection;
+
+    // Bits of the value above the CRC width are always zero.
+    return (0u == (match & ~covered));
 }
 
 // --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,335 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc_file.c
+ * @brief       CRC calculation of files. Regular files are memory mapped in sliding windows and the mapping is handed
+ *              directly to the kernel bound at init (no copies into user-space buffers), other descriptors (pipes,
+ *              sockets) are read into one buffer.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-06
+ * @version     1.0.0
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+// O_CLOEXEC, madvise and posix_fadvise need POSIX/BSD declarations also with strict ISO C (-std=c11), files larger than
+// 4 GB on 32-bit targets need 64-bit file offsets.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif /* _FILE_OFFSET_BITS */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if __has_include("calc_crc_conf.h")
+#include "calc_crc_conf.h"
+#endif /* __has_include("calc_crc_conf.h") */
+
+#include "calc_crc/calc_crc_ptypes.h"
+#include "calc_crc/calc_crc_gtypes.h"
+#include "calc_crc/calc_crc.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Enable memory mapped file calculation (POSIX), files are read with stdio otherwise.
+ */
+#ifndef CALC_CRC_CONF_FILE_USE
+#if defined(__unix__) || defined(__APPLE__)
+#define CALC_CRC_CONF_FILE_USE (true)
+#else
+#define CALC_CRC_CONF_FILE_USE (false)
+#endif
+#endif /* CALC_CRC_CONF_FILE_USE */
+
+/**
+ * @brief   Length (bytes) of the file window mapped at once (rounded up to the page size).
+ */
+#ifndef CALC_CRC_CONF_FILE_WINDOW
+#define CALC_CRC_CONF_FILE_WINDOW (64u * 1024u * 1024u)
+#endif /* CALC_CRC_CONF_FILE_WINDOW */
+
+/**
+ * @brief   Length (bytes) of the buffer used for files which can not be mapped.
+ */
+#ifndef CALC_CRC_CONF_FILE_BUFFER
+#define CALC_CRC_CONF_FILE_BUFFER (64u * 1024u)
+#endif /* CALC_CRC_CONF_FILE_BUFFER */
+
+#if (true == CALC_CRC_CONF_FILE_USE)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* (true == CALC_CRC_CONF_FILE_USE) */
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+#if (true == CALC_CRC_CONF_FILE_USE)
+
+/**
+ * @brief   Get the window length rounded up to the page size.
+ * @return  Window length in bytes.
+ */
+static size_t _file_window(void);
+
+/**
+ * @brief   Update the CRC value with a regular file mapped window by window.
+ * @param   crc         Pointer to the CRC instance (update in progress).
+ * @param   fd          File descriptor.
+ * @param   size        Size of the file in bytes.
+ * @return  Status code indicating success or failure.
+ */
+static calc_crc_status_e _file_map(calc_crc_t *crc, int fd, uint64_t size);
+
+/**
+ * @brief   Update the CRC value with data read from a descriptor until end of file.
+ * @param   crc         Pointer to the CRC instance (update in progress).
+ * @param   fd          File descriptor.
+ * @return  Status code indicating success or failure.
+ */
+static calc_crc_status_e _file_read(calc_crc_t *crc, int fd);
+
+#else
+
+/**
+ * @brief   Update the CRC value with data read from a stdio stream until end of file.
+ * @param   crc         Pointer to the CRC instance (update in progress).
+ * @param   file        Stdio stream.
+ * @return  Status code indicating success or failure.
+ */
+static calc_crc_status_e _file_stream(calc_crc_t *crc, FILE *file);
+
+#endif /* (true == CALC_CRC_CONF_FILE_USE) */
+
+// --- Private Variables -----------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Runtime configuration (set with CALC_CRC_SetFileWindow).
+ */
+static size_t _window = CALC_CRC_CONF_FILE_WINDOW;
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+calc_crc_status_e CALC_CRC_CalculateFile(calc_crc_t *crc, const char *path, void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(path, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+#if (true == CALC_CRC_CONF_FILE_USE)
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+    if (0 > fd)
+    {
+        return CALC_CRC_STATUS_ERROR;
+    }
+
+    calc_crc_status_e status = CALC_CRC_CalculateFd(crc, fd, result);
+    close(fd);
+
+    return status;
+#else
+    FILE *file = fopen(path, "rb");
+
+    if (NULL == file)
+    {
+        return CALC_CRC_STATUS_ERROR;
+    }
+
+    CALC_CRC_Start(crc);
+    calc_crc_status_e status = _file_stream(crc, file);
+    fclose(file);
+
+    if (CALC_CRC_STATUS_OK != status)
+    {
+        crc->update_in_progress = false;
+        return status;
+    }
+
+    return CALC_CRC_Finalize(crc, result);
+#endif /* (true == CALC_CRC_CONF_FILE_USE) */
+}
+
+calc_crc_status_e CALC_CRC_CalculateFd(calc_crc_t *crc, int fd, void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (0 > fd)
+    {
+        return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+#if (true == CALC_CRC_CONF_FILE_USE)
+    struct stat info;
+
+    if (0 != fstat(fd, &info))
+    {
+        return CALC_CRC_STATUS_ERROR;
+    }
+
+    // Empty files give the CRC value of empty data.
+    CALC_CRC_Start(crc);
+    calc_crc_status_e status =
+        (0 != S_ISREG(info.st_mode)) ? _file_map(crc, fd, (uint64_t)info.st_size) : _file_read(crc, fd);
+
+    if (CALC_CRC_STATUS_OK != status)
+    {
+        crc->update_in_progress = false;
+        return status;
+    }
+
+    return CALC_CRC_Finalize(crc, result);
+#else
+    return CALC_CRC_STATUS_ERROR;
+#endif /* (true == CALC_CRC_CONF_FILE_USE) */
+}
+
+calc_crc_status_e CALC_CRC_SetFileWindow(size_t window)
+{
+    CHECK_ARGS_SIZE(window, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    _window = window;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+#if (true == CALC_CRC_CONF_FILE_USE)
+
+static size_t _file_window(void)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    size_t align = (0 < page) ? (size_t)page : 4096u;
+
+    return ((_window + align - 1u) / align) * align;
+}
+
+static calc_crc_status_e _file_map(calc_crc_t *crc, int fd, uint64_t size)
+{
+    size_t window = _file_window();
+
+#if defined(POSIX_FADV_SEQUENTIAL)
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif /* defined(POSIX_FADV_SEQUENTIAL) */
+
+    for (uint64_t offset = 0; offset < size; offset += window)
+    {
+        size_t length = ((size - offset) < window) ? (size_t)(size - offset) : window;
+        void *map = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, (off_t)offset);
+
+        if (MAP_FAILED == map)
+        {
+            return CALC_CRC_STATUS_ERROR;
+        }
+
+        madvise(map, length, MADV_SEQUENTIAL);
+        madvise(map, length, MADV_WILLNEED);
+#if defined(POSIX_FADV_WILLNEED)
+        // Readahead of the next window runs while the current one is calculated.
+        if ((offset + length) < size)
+        {
+            posix_fadvise(fd, (off_t)(offset + length), (off_t)window, POSIX_FADV_WILLNEED);
+        }
+#endif /* defined(POSIX_FADV_WILLNEED) */
+
+        calc_crc_status_e status = CALC_CRC_Update(crc, map, length);
+        munmap(map, length);
+
+        if (CALC_CRC_STATUS_OK != status)
+        {
+            return status;
+        }
+    }
+
+    return CALC_CRC_STATUS_OK;
+}
+
+static calc_crc_status_e _file_read(calc_crc_t *crc, int fd)
+{
+    uint8_t *buffer = (uint8_t *)malloc(CALC_CRC_CONF_FILE_BUFFER);
+    calc_crc_status_e status = CALC_CRC_STATUS_OK;
+
+    if (NULL == buffer)
+    {
+        return CALC_CRC_STATUS_ERROR;
+    }
+
+    while (CALC_CRC_STATUS_OK == status)
+    {
+        ssize_t length = read(fd, buffer, CALC_CRC_CONF_FILE_BUFFER);
+
+        if (0 < length)
+        {
+            status = CALC_CRC_Update(crc, buffer, (size_t)length);
+        }
+        else if (0 == length)
+        {
+            break;
+        }
+        else if (EINTR != errno)
+        {
+            status = CALC_CRC_STATUS_ERROR;
+        }
+    }
+
+    free(buffer);
+
+    return status;
+}
+
+#else
+
+static calc_crc_status_e _file_stream(calc_crc_t *crc, FILE *file)
+{
+    uint8_t *buffer = (uint8_t *)malloc(CALC_CRC_CONF_FILE_BUFFER);
+    calc_crc_status_e status = CALC_CRC_STATUS_OK;
+
+    if (NULL == buffer)
+    {
+        return CALC_CRC_STATUS_ERROR;
+    }
+
+    while (CALC_CRC_STATUS_OK == status)
+    {
+        size_t length = fread(buffer, 1, CALC_CRC_CONF_FILE_BUFFER, file);
+
+        if (0u != length)
+        {
+            status = CALC_CRC_Update(crc, buffer, length);
+        }
+        if (CALC_CRC_CONF_FILE_BUFFER != length)
+        {
+            status = (0 != ferror(file)) ? CALC_CRC_STATUS_ERROR : status;
+            break;
+        }
+    }
+
+    free(buffer);
+
+    return status;
+}
+
+#endif /* (true == CALC_CRC_CONF_FILE_USE) */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,320 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc_models.c
+ * @brief       Catalogue of standard CRC models (parameters and check values as in the CRC RevEng catalogue) and
+ *              checksums, initialization of CRC instances by model id or name.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-06
+ * @version     1.0.0
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if __has_include("calc_crc_conf.h")
+#include "calc_crc_conf.h"
+#endif /* __has_include("calc_crc_conf.h") */
+
+#include "calc_crc/calc_crc_ptypes.h"
+#include "calc_crc/calc_crc_gtypes.h"
+#include "calc_crc/calc_crc_tables.h"
+#include "calc_crc/calc_crc.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Table hint of a model, precomputed tables are not referenced when the engine is fixed to a table-less one.
+ */
+#if defined(CALC_CRC_CONF_ENGINE) && (CALC_CRC_ENGINE_TABLE != CALC_CRC_CONF_ENGINE)
+#define CALC_CRC_MODEL_TABLES(tables) (NULL)
+#else
+#define CALC_CRC_MODEL_TABLES(tables) (&(tables))
+#endif
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+/**
+ * @brief   Compare model names ignoring case and separators ('-', '/', '_' and ' '), so "crc32c" matches "CRC-32C".
+ * @param   name        Name to compare.
+ * @param   model_name  Name of the catalogue model.
+ * @return  True if the names are equal.
+ */
+static bool _name_equal(const char *name, const char *model_name);
+
+// --- Private Variables -----------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Catalogue of standard models (indexed by calc_crc_model_e).
+ */
+static const calc_crc_model_t _models[CALC_CRC_MODEL_MAX] = {
+    [CALC_CRC_MODEL_CRC8_SMBUS] = {"CRC-8/SMBUS", "CRC-8", CALC_CRC_TYPE_8BIT, 8, 0x07, 0x00, 0x00, false, false, 0xF4,
+                                   CALC_CRC_KERNEL_PCLMUL, CALC_CRC_MODEL_TABLES(calc_crc_tables_crc8)},
+    [CALC_CRC_MODEL_CRC8_I_432_1] = {"CRC-8/I-432-1", "CRC-8/ITU", CALC_CRC_TYPE_8BIT, 8, 0x07, 0x00, 0x55, false,
+                                     false, 0xA1, CALC_CRC_KERNEL_PCLMUL, CALC_CRC_MODEL_TABLES(calc_crc_tables_crc8)},
+    [CALC_CRC_MODEL_CRC8_AUTOSAR] = {"CRC-8/AUTOSAR", NULL, CALC_CRC_TYPE_8BIT, 8, 0x2F, 0xFF, 0xFF, false, false, 0xDF,
+                                     CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC8_MAXIM_DOW] = {"CRC-8/MAXIM-DOW", "CRC-8/MAXIM", CALC_CRC_TYPE_8BIT, 8, 0x31, 0x00, 0x00, true,
+                                       true, 0xA1, CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC16_IBM_3740] = {"CRC-16/IBM-3740", "CRC-16/CCITT-FALSE", CALC_CRC_TYPE_16BIT, 16, 0x1021, 0xFFFF,
+                                       0x0000, false, false, 0x29B1, CALC_CRC_KERNEL_PCLMUL,
+                                       CALC_CRC_MODEL_TABLES(calc_crc_tables_crc16_ccitt)},
+    [CALC_CRC_MODEL_CRC16_XMODEM] = {"CRC-16/XMODEM", NULL, CALC_CRC_TYPE_16BIT, 16, 0x1021, 0x0000, 0x0000, false,
+                                     false, 0x31C3, CALC_CRC_KERNEL_PCLMUL,
+                                     CALC_CRC_MODEL_TABLES(calc_crc_tables_crc16_ccitt)},
+    [CALC_CRC_MODEL_CRC16_KERMIT] = {"CRC-16/KERMIT", "CRC-16/CCITT", CALC_CRC_TYPE_16BIT, 16, 0x1021, 0x0000, 0x0000,
+                                     true, true, 0x2189, CALC_CRC_KERNEL_PCLMUL,
+                                     CALC_CRC_MODEL_TABLES(calc_crc_tables_crc16_kermit)},
+    [CALC_CRC_MODEL_CRC16_IBM_SDLC] = {"CRC-16/IBM-SDLC", "CRC-16/X-25", CALC_CRC_TYPE_16BIT, 16, 0x1021, 0xFFFF,
+                                       0xFFFF, true, true, 0x906E, CALC_CRC_KERNEL_PCLMUL,
+                                       CALC_CRC_MODEL_TABLES(calc_crc_tables_crc16_kermit)},
+    [CALC_CRC_MODEL_CRC16_ARC] = {"CRC-16/ARC", NULL, CALC_CRC_TYPE_16BIT, 16, 0x8005, 0x0000, 0x0000, true, true,
+                                  0xBB3D, CALC_CRC_KERNEL_PCLMUL, CALC_CRC_MODEL_TABLES(calc_crc_tables_crc16_arc)},
+    [CALC_CRC_MODEL_CRC16_MODBUS] = {"CRC-16/MODBUS", NULL, CALC_CRC_TYPE_16BIT, 16, 0x8005, 0xFFFF, 0x0000, true, true,
+                                     0x4B37, CALC_CRC_KERNEL_PCLMUL, CALC_CRC_MODEL_TABLES(calc_crc_tables_crc16_arc)},
+    [CALC_CRC_MODEL_CRC16_USB] = {"CRC-16/USB", NULL, CALC_CRC_TYPE_16BIT, 16, 0x8005, 0xFFFF, 0xFFFF, true, true,
+                                  0xB4C8, CALC_CRC_KERNEL_PCLMUL, CALC_CRC_MODEL_TABLES(calc_crc_tables_crc16_arc)},
+    [CALC_CRC_MODEL_CRC32_ISO_HDLC] = {"CRC-32/ISO-HDLC", "CRC-32", CALC_CRC_TYPE_32BIT, 32, 0x04C11DB7, 0xFFFFFFFF,
+                                       0xFFFFFFFF, true, true, 0xCBF43926, CALC_CRC_KERNEL_PCLMUL,
+                                       CALC_CRC_MODEL_TABLES(calc_crc_tables_crc32)},
+    [CALC_CRC_MODEL_CRC32_BZIP2] = {"CRC-32/BZIP2", NULL, CALC_CRC_TYPE_32BIT, 32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF,
+                                    false, false, 0xFC891918, CALC_CRC_KERNEL_PCLMUL,
+                                    CALC_CRC_MODEL_TABLES(calc_crc_tables_crc32_bzip2)},
+    [CALC_CRC_MODEL_CRC32_MPEG_2] = {"CRC-32/MPEG-2", NULL, CALC_CRC_TYPE_32BIT, 32, 0x04C11DB7, 0xFFFFFFFF, 0x00000000,
+                                     false, false, 0x0376E6E7, CALC_CRC_KERNEL_PCLMUL,
+                                     CALC_CRC_MODEL_TABLES(calc_crc_tables_crc32_bzip2)},
+    [CALC_CRC_MODEL_CRC32_JAMCRC] = {"CRC-32/JAMCRC", NULL, CALC_CRC_TYPE_32BIT, 32, 0x04C11DB7, 0xFFFFFFFF, 0x00000000,
+                                     true, true, 0x340BC6D9, CALC_CRC_KERNEL_PCLMUL,
+                                     CALC_CRC_MODEL_TABLES(calc_crc_tables_crc32)},
+    [CALC_CRC_MODEL_CRC32_ISCSI] = {"CRC-32/ISCSI", "CRC-32C", CALC_CRC_TYPE_32BIT, 32, 0x1EDC6F41, 0xFFFFFFFF,
+                                    0xFFFFFFFF, true, true, 0xE3069283, CALC_CRC_KERNEL_SSE42,
+                                    CALC_CRC_MODEL_TABLES(calc_crc_tables_crc32c)},
+    [CALC_CRC_MODEL_CRC64_XZ] = {"CRC-64/XZ", NULL, CALC_CRC_TYPE_64BIT, 64, 0x42F0E1EBA9EA3693, UINT64_MAX, UINT64_MAX,
+                                 true, true, 0x995DC9BBDF1939FA, CALC_CRC_KERNEL_PCLMUL,
+                                 CALC_CRC_MODEL_TABLES(calc_crc_tables_crc64_xz)},
+    [CALC_CRC_MODEL_CRC64_ECMA_182] = {"CRC-64/ECMA-182", "CRC-64/ECMA", CALC_CRC_TYPE_64BIT, 64, 0x42F0E1EBA9EA3693, 0,
+                                       0, false, false, 0x6C40DF5F0B497347, CALC_CRC_KERNEL_PCLMUL,
+                                       CALC_CRC_MODEL_TABLES(calc_crc_tables_crc64_ecma)},
+    [CALC_CRC_MODEL_CRC64_WE] = {"CRC-64/WE", NULL, CALC_CRC_TYPE_64BIT, 64, 0x42F0E1EBA9EA3693, UINT64_MAX, UINT64_MAX,
+                                 false, false, 0x62EC59E3F1A4F00A, CALC_CRC_KERNEL_PCLMUL,
+                                 CALC_CRC_MODEL_TABLES(calc_crc_tables_crc64_ecma)},
+    [CALC_CRC_MODEL_CRC64_GO_ISO] = {"CRC-64/GO-ISO", NULL, CALC_CRC_TYPE_64BIT, 64, 0x000000000000001B, UINT64_MAX,
+                                     UINT64_MAX, true, true, 0xB90956C775A41001, CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC5_USB] = {"CRC-5/USB", NULL, CALC_CRC_TYPE_8BIT, 5, 0x05, 0x1F, 0x1F, true, true, 0x19,
+                                 CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC11_FLEXRAY] = {"CRC-11/FLEXRAY", "CRC-11", CALC_CRC_TYPE_16BIT, 11, 0x0385, 0x001A, 0x0000,
+                                      false, false, 0x05A3, CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC15_CAN] = {"CRC-15/CAN", "CRC-15", CALC_CRC_TYPE_16BIT, 15, 0x4599, 0x0000, 0x0000, false, false,
+                                  0x059E, CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC17_CAN_FD] = {"CRC-17/CAN-FD", NULL, CALC_CRC_TYPE_32BIT, 17, 0x0001685B, 0x00000000, 0x00000000,
+                                     false, false, 0x00004F03, CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC21_CAN_FD] = {"CRC-21/CAN-FD", NULL, CALC_CRC_TYPE_32BIT, 21, 0x00102899, 0x00000000, 0x00000000,
+                                     false, false, 0x000ED841, CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC24_OPENPGP] = {"CRC-24/OPENPGP", "CRC-24", CALC_CRC_TYPE_32BIT, 24, 0x00864CFB, 0x00B704CE,
+                                      0x00000000, false, false, 0x0021CF02, CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC31_PHILIPS] = {"CRC-31/PHILIPS", NULL, CALC_CRC_TYPE_32BIT, 31, 0x04C11DB7, 0x7FFFFFFF,
+                                      0x7FFFFFFF, false, false, 0x0CE9E46C, CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_CRC40_GSM] = {"CRC-40/GSM", NULL, CALC_CRC_TYPE_64BIT, 40, 0x0000000004820009, 0x0000000000000000,
+                                  0x000000FFFFFFFFFF, false, false, 0x000000D4164FC646, CALC_CRC_KERNEL_PCLMUL, NULL},
+    [CALC_CRC_MODEL_SUM8] = {"SUM-8", NULL, CALC_CRC_TYPE_SUM8, 8, 0, 0, 0, false, false, 0xDD, CALC_CRC_KERNEL_AVX2,
+                             NULL},
+    [CALC_CRC_MODEL_LRC8] = {"LRC-8", "LRC", CALC_CRC_TYPE_LRC8, 8, 0, 0, 0, false, false, 0x23, CALC_CRC_KERNEL_AVX2,
+                             NULL},
+    [CALC_CRC_MODEL_FLETCHER16] = {"FLETCHER-16", NULL, CALC_CRC_TYPE_FLETCHER16, 16, 0, 0, 0, false, false, 0x1EDE,
+                                   CALC_CRC_KERNEL_AVX2, NULL},
+    [CALC_CRC_MODEL_FLETCHER32] = {"FLETCHER-32", NULL, CALC_CRC_TYPE_FLETCHER32, 32, 0, 0, 0, false, false,
+                                   0xDF09D509, CALC_CRC_KERNEL_AVX2, NULL},
+    [CALC_CRC_MODEL_FLETCHER64] = {"FLETCHER-64", NULL, CALC_CRC_TYPE_FLETCHER64, 64, 0, 0, 0, false, false,
+                                   0x0D0803376C6A689F, CALC_CRC_KERNEL_AVX2, NULL},
+    [CALC_CRC_MODEL_ADLER32] = {"ADLER-32", NULL, CALC_CRC_TYPE_ADLER32, 32, 0, 1, 0, false, false, 0x091E01DE,
+                                CALC_CRC_KERNEL_AVX2, NULL},
+    [CALC_CRC_MODEL_INTERNET16] = {"INTERNET-16", "INET", CALC_CRC_TYPE_INET16, 16, 0, 0, 0, false, false, 0xF62A,
+                                   CALC_CRC_KERNEL_AVX2, NULL},
+};
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+calc_crc_status_e CALC_CRC_GetModel(calc_crc_model_e model, const calc_crc_model_t **info)
+{
+    CHECK_ARGS_NULL_PTR(info, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_MODEL_MAX <= model)
+    {
+        return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    *info = &_models[model];
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_FindModel(const char *name, calc_crc_model_e *model)
+{
+    CHECK_ARGS_NULL_PTR(name, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(model, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    for (size_t i = 0; i < (size_t)CALC_CRC_MODEL_MAX; i++)
+    {
+        if ((true == _name_equal(name, _models[i].name)) ||
+            ((NULL != _models[i].alias) && (true == _name_equal(name, _models[i].alias))))
+        {
+            *model = (calc_crc_model_e)i;
+            return CALC_CRC_STATUS_OK;
+        }
+    }
+
+    return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+}
+
+calc_crc_status_e CALC_CRC_InitModel(calc_crc_t *crc, calc_crc_conf_t *conf, calc_crc_model_e model)
+{
+    const calc_crc_model_t *info;
+    calc_crc_status_e status = CALC_CRC_GetModel(model, &info);
+
+    if (CALC_CRC_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    return CALC_CRC_InitParams(crc, conf, info);
+}
+
+calc_crc_status_e CALC_CRC_InitParams(calc_crc_t *crc, calc_crc_conf_t *conf, const calc_crc_model_t *info)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(conf, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(info, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    MEMSET(conf, 0, sizeof(calc_crc_conf_t));
+
+    // Table hint is used as precomputed tables including its slicing rows, so no table is generated at init.
+    switch (info->type)
+    {
+        // ---- 8-bit calculator
+        case CALC_CRC_TYPE_8BIT:
+        {
+            const calc_crc_8bit_tables_t *tables = (const calc_crc_8bit_tables_t *)info->tables;
+            conf->conf_8bit.polynomial = (uint8_t)info->polynomial;
+            conf->conf_8bit.initial_value = (uint8_t)info->initial_value;
+            conf->conf_8bit.final_value = (uint8_t)info->final_value;
+            conf->conf_8bit.input_reflected = info->input_reflected;
+            conf->conf_8bit.output_reflected = info->output_reflected;
+            conf->conf_8bit.slices = (NULL != tables) ? tables->slices : 0u;
+            conf->conf_8bit.tables = tables;
+            conf->conf_8bit.width = info->width;
+            break;
+        }
+        // ---- 16-bit calculator
+        case CALC_CRC_TYPE_16BIT:
+        {
+            const calc_crc_16bit_tables_t *tables = (const calc_crc_16bit_tables_t *)info->tables;
+            conf->conf_16bit.polynomial = (uint16_t)info->polynomial;
+            conf->conf_16bit.initial_value = (uint16_t)info->initial_value;
+            conf->conf_16bit.final_value = (uint16_t)info->final_value;
+            conf->conf_16bit.input_reflected = info->input_reflected;
+            conf->conf_16bit.output_reflected = info->output_reflected;
+            conf->conf_16bit.slices = (NULL != tables) ? tables->slices : 0u;
+            conf->conf_16bit.tables = tables;
+            conf->conf_16bit.width = info->width;
+            break;
+        }
+        // ---- 32-bit calculator
+        case CALC_CRC_TYPE_32BIT:
+        {
+            const calc_crc_32bit_tables_t *tables = (const calc_crc_32bit_tables_t *)info->tables;
+            conf->conf_32bit.polynomial = (uint32_t)info->polynomial;
+            conf->conf_32bit.initial_value = (uint32_t)info->initial_value;
+            conf->conf_32bit.final_value = (uint32_t)info->final_value;
+            conf->conf_32bit.input_reflected = info->input_reflected;
+            conf->conf_32bit.output_reflected = info->output_reflected;
+            conf->conf_32bit.slices = (NULL != tables) ? tables->slices : 0u;
+            conf->conf_32bit.tables = tables;
+            conf->conf_32bit.width = info->width;
+            break;
+        }
+        // ---- 64-bit calculator
+        case CALC_CRC_TYPE_64BIT:
+        {
+            const calc_crc_64bit_tables_t *tables = (const calc_crc_64bit_tables_t *)info->tables;
+            conf->conf_64bit.polynomial = info->polynomial;
+            conf->conf_64bit.initial_value = info->initial_value;
+            conf->conf_64bit.final_value = info->final_value;
+            conf->conf_64bit.input_reflected = info->input_reflected;
+            conf->conf_64bit.output_reflected = info->output_reflected;
+            conf->conf_64bit.slices = (NULL != tables) ? tables->slices : 0u;
+            conf->conf_64bit.tables = tables;
+            conf->conf_64bit.width = info->width;
+            break;
+        }
+        // ---- Checksums
+        case CALC_CRC_TYPE_SUM8:
+        case CALC_CRC_TYPE_LRC8:
+        case CALC_CRC_TYPE_FLETCHER16:
+        case CALC_CRC_TYPE_FLETCHER32:
+        case CALC_CRC_TYPE_FLETCHER64:
+        case CALC_CRC_TYPE_ADLER32:
+        case CALC_CRC_TYPE_INET16:
+        {
+            conf->conf_checksum.initial_value = info->initial_value;
+            break;
+        }
+        // -------------------- Default exit (should not come to here)
+        default:
+        {
+            return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+        }
+    }
+
+    return CALC_CRC_Init(crc, conf, info->type);
+}
+
+calc_crc_status_e CALC_CRC_InitName(calc_crc_t *crc, calc_crc_conf_t *conf, const char *name)
+{
+    calc_crc_model_e model;
+    calc_crc_status_e status = CALC_CRC_FindModel(name, &model);
+
+    if (CALC_CRC_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    return CALC_CRC_InitModel(crc, conf, model);
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+static bool _name_equal(const char *name, const char *model_name)
+{
+    for (;;)
+    {
+        while (('-' == *name) || ('/' == *name) || ('_' == *name) || (' ' == *name))
+        {
+            name++;
+        }
+        while (('-' == *model_name) || ('/' == *model_name) || ('_' == *model_name) || (' ' == *model_name))
+        {
+            model_name++;
+        }
+
+        char a = (('a' <= *name) && ('z' >= *name)) ? (char)(*name - 'a' + 'A') : *name;
+        char b = (('a' <= *model_name) && ('z' >= *model_name)) ? (char)(*model_name - 'a' + 'A') : *model_name;
+
+        if (a != b)
+        {
+            return false;
+        }
+        if ('\0' == a)
+        {
+            return true;
+        }
+
+        name++;
+        model_name++;
+    }
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,442 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc_parallel.c
+ * @brief       Multi-threaded CRC calculation of large buffers. The buffer is split into spans, partial CRC values are
+ *              calculated on a persistent work-stealing thread pool and merged with CALC_CRC_Combine into the value
+ *              produced by CALC_CRC_Calculate.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-06
+ * @version     1.0.0
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if __has_include("calc_crc_conf.h")
+#include "calc_crc_conf.h"
+#endif /* __has_include("calc_crc_conf.h") */
+
+#include "calc_crc/calc_crc_ptypes.h"
+#include "calc_crc/calc_crc_gtypes.h"
+#include "calc_crc/calc_crc.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Enable multi-threaded calculation (POSIX threads), sequential calculation is used otherwise.
+ */
+#ifndef CALC_CRC_CONF_PARALLEL_USE
+#if defined(__unix__) || defined(__APPLE__)
+#define CALC_CRC_CONF_PARALLEL_USE (true)
+#else
+#define CALC_CRC_CONF_PARALLEL_USE (false)
+#endif
+#endif /* CALC_CRC_CONF_PARALLEL_USE */
+
+/**
+ * @brief   Number of threads used for calculation, including the calling one (0 = number of online CPUs).
+ */
+#ifndef CALC_CRC_CONF_PARALLEL_THREADS
+#define CALC_CRC_CONF_PARALLEL_THREADS (0u)
+#endif /* CALC_CRC_CONF_PARALLEL_THREADS */
+
+/**
+ * @brief   Maximal number of threads in the pool.
+ */
+#ifndef CALC_CRC_CONF_PARALLEL_THREADS_MAX
+#define CALC_CRC_CONF_PARALLEL_THREADS_MAX (128u)
+#endif /* CALC_CRC_CONF_PARALLEL_THREADS_MAX */
+
+/**
+ * @brief   Minimal span length (bytes) calculated by one thread.
+ */
+#ifndef CALC_CRC_CONF_PARALLEL_MIN_SPAN
+#define CALC_CRC_CONF_PARALLEL_MIN_SPAN (1024u * 1024u)
+#endif /* CALC_CRC_CONF_PARALLEL_MIN_SPAN */
+
+/**
+ * @brief   Spans per thread, more spans than threads let idle threads steal work from slower ones.
+ */
+#define CALC_CRC_PARALLEL_SPANS_PER_THREAD (4u)
+
+/**
+ * @brief   Maximal number of spans of one calculation.
+ */
+#define CALC_CRC_PARALLEL_SPANS_MAX (CALC_CRC_CONF_PARALLEL_THREADS_MAX * CALC_CRC_PARALLEL_SPANS_PER_THREAD)
+
+#if (true == CALC_CRC_CONF_PARALLEL_USE)
+#include <pthread.h>
+#include <unistd.h>
+#endif /* (true == CALC_CRC_CONF_PARALLEL_USE) */
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+#if (true == CALC_CRC_CONF_PARALLEL_USE)
+
+/**
+ * @brief   Span queue of one thread, owner takes spans from the front and other threads steal from the back.
+ */
+typedef struct
+{
+    pthread_mutex_t lock; // Queue lock.
+    size_t begin;         // First span index not taken yet.
+    size_t end;           // One past the last span index not taken yet.
+} calc_crc_queue_t;
+
+/**
+ * @brief   Persistent thread pool with the currently calculated job.
+ */
+typedef struct
+{
+    pthread_mutex_t submit;                                      // Serializes callers, one job at a time.
+    pthread_mutex_t lock;                                        // Protects generation, pending and stop.
+    pthread_cond_t start;                                        // Signals workers a new job (or stop).
+    pthread_cond_t done;                                         // Signals the caller all spans are calculated.
+    pthread_t threads[CALC_CRC_CONF_PARALLEL_THREADS_MAX];       // Worker threads (caller is thread 0).
+    calc_crc_queue_t queues[CALC_CRC_CONF_PARALLEL_THREADS_MAX]; // Span queues per thread.
+    size_t started;                                              // Number of threads (including caller) in pool.
+    size_t requested;                                            // Number of threads the pool was started with.
+    uint64_t generation;                                         // Job counter, workers wake up when changed.
+    size_t pending;                                              // Spans of the current job not calculated yet.
+    bool stop;                                                   // Request workers to exit.
+    calc_crc_t crc;                                              // Copy of the instance of the current job.
+    const uint8_t *data;                                         // Data buffer of the current job.
+    size_t length;                                               // Length of the data buffer.
+    size_t span;                                                 // Span length (last span can be shorter).
+    uint64_t results[CALC_CRC_PARALLEL_SPANS_MAX];               // Span CRC values (instance type width).
+} calc_crc_pool_t;
+
+#endif /* (true == CALC_CRC_CONF_PARALLEL_USE) */
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+#if (true == CALC_CRC_CONF_PARALLEL_USE)
+
+/**
+ * @brief   Get number of threads to use (configured or number of online CPUs), called with submit lock held.
+ * @return  Number of threads, including the calling one.
+ */
+static size_t _parallel_threads(void);
+
+/**
+ * @brief   Start pool threads if pool is not running with the requested number of threads.
+ * @param   threads     Number of threads, including the calling one.
+ * @return  Number of threads in the running pool.
+ */
+static size_t _pool_start(size_t threads);
+
+/**
+ * @brief   Stop and join all pool threads.
+ */
+static void _pool_stop(void);
+
+/**
+ * @brief   Take one span, first from own queue, then steal from queues of other threads.
+ * @param   self        Index of the calling thread.
+ * @param   index       Pointer to store the taken span index.
+ * @return  True if span was taken, false if all queues are empty.
+ */
+static bool _pool_take(size_t self, size_t *index);
+
+/**
+ * @brief   Calculate spans until all queues are empty.
+ * @param   self        Index of the calling thread.
+ */
+static void _pool_work(size_t self);
+
+/**
+ * @brief   Pool worker thread entry.
+ * @param   arg         Index of the thread (as pointer sized integer).
+ * @return  Always NULL.
+ */
+static void *_pool_thread(void *arg);
+
+#endif /* (true == CALC_CRC_CONF_PARALLEL_USE) */
+
+// --- Private Variables -----------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Runtime configuration (set with CALC_CRC_SetParallel).
+ */
+static size_t _threads = CALC_CRC_CONF_PARALLEL_THREADS;
+static size_t _min_span = CALC_CRC_CONF_PARALLEL_MIN_SPAN;
+
+#if (true == CALC_CRC_CONF_PARALLEL_USE)
+
+/**
+ * @brief   Thread pool, created at first parallel calculation.
+ */
+static calc_crc_pool_t _pool = {
+    .submit = PTHREAD_MUTEX_INITIALIZER,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .start = PTHREAD_COND_INITIALIZER,
+    .done = PTHREAD_COND_INITIALIZER,
+};
+
+#endif /* (true == CALC_CRC_CONF_PARALLEL_USE) */
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+calc_crc_status_e CALC_CRC_CalculateParallel(calc_crc_t *crc, const void *data, size_t length, void *result)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(length, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+#if (true == CALC_CRC_CONF_PARALLEL_USE)
+    static const size_t sizes[CALC_CRC_TYPE_MAX] = {sizeof(uint8_t),  sizeof(uint16_t), sizeof(uint32_t),
+                                                    sizeof(uint64_t), sizeof(uint8_t),  sizeof(uint8_t),
+                                                    sizeof(uint16_t), sizeof(uint32_t), sizeof(uint64_t),
+                                                    sizeof(uint32_t), sizeof(uint16_t)};
+
+    // Settings changed by CALC_CRC_SetParallel are read under the same lock.
+    pthread_mutex_lock(&_pool.submit);
+
+    size_t threads = _parallel_threads();
+    size_t spans = length / _min_span;
+
+    if (spans > (threads * CALC_CRC_PARALLEL_SPANS_PER_THREAD))
+    {
+        spans = threads * CALC_CRC_PARALLEL_SPANS_PER_THREAD;
+    }
+
+    if ((2u > threads) || (2u > spans))
+    {
+        pthread_mutex_unlock(&_pool.submit);
+        return CALC_CRC_Calculate(crc, data, length, result);
+    }
+
+    threads = _pool_start(threads);
+
+    _pool.crc = *crc;
+    _pool.data = (const uint8_t *)data;
+    _pool.length = length;
+    _pool.span = (length + spans - 1u) / spans;
+    _pool.span = (_pool.span + 63u) & ~(size_t)63u; // Whole words of every checksum type end each span.
+    spans = (length + _pool.span - 1u) / _pool.span;
+
+    // Pending count is set before any span is queued, a worker still stealing after the previous job can take one.
+    pthread_mutex_lock(&_pool.lock);
+    _pool.pending = spans;
+    _pool.generation++;
+
+    // Spans are split into contiguous ranges per thread.
+    for (size_t i = 0; i < threads; i++)
+    {
+        pthread_mutex_lock(&_pool.queues[i].lock);
+        _pool.queues[i].begin = (spans * i) / threads;
+        _pool.queues[i].end = (spans * (i + 1u)) / threads;
+        pthread_mutex_unlock(&_pool.queues[i].lock);
+    }
+
+    pthread_cond_broadcast(&_pool.start);
+    pthread_mutex_unlock(&_pool.lock);
+
+    _pool_work(0);
+
+    pthread_mutex_lock(&_pool.lock);
+    while (0u != _pool.pending)
+    {
+        pthread_cond_wait(&_pool.done, &_pool.lock);
+    }
+    pthread_mutex_unlock(&_pool.lock);
+
+    // Merge partial results in data order, values are stored with the width of the instance type.
+    uint64_t value = _pool.results[0];
+    for (size_t i = 1; i < spans; i++)
+    {
+        size_t span = ((i + 1u) < spans) ? _pool.span : (length - (i * _pool.span));
+        CALC_CRC_Combine(crc, &value, &_pool.results[i], span, &value);
+    }
+    memcpy(result, &value, sizes[crc->type]);
+
+    pthread_mutex_unlock(&_pool.submit);
+
+    return CALC_CRC_STATUS_OK;
+#else
+    return CALC_CRC_Calculate(crc, data, length, result);
+#endif /* (true == CALC_CRC_CONF_PARALLEL_USE) */
+}
+
+calc_crc_status_e CALC_CRC_SetParallel(size_t threads, size_t min_span)
+{
+    if ((CALC_CRC_CONF_PARALLEL_THREADS_MAX < threads) || (0u == min_span))
+    {
+        return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+    }
+
+#if (true == CALC_CRC_CONF_PARALLEL_USE)
+    pthread_mutex_lock(&_pool.submit);
+    _threads = threads;
+    _min_span = min_span;
+    pthread_mutex_unlock(&_pool.submit);
+#else
+    _threads = threads;
+    _min_span = min_span;
+#endif /* (true == CALC_CRC_CONF_PARALLEL_USE) */
+
+    return CALC_CRC_STATUS_OK;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+#if (true == CALC_CRC_CONF_PARALLEL_USE)
+
+static size_t _parallel_threads(void)
+{
+    size_t threads = _threads;
+
+    if (0u == threads)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (0 < online) ? (size_t)online : 1u;
+    }
+
+    return (CALC_CRC_CONF_PARALLEL_THREADS_MAX < threads) ? CALC_CRC_CONF_PARALLEL_THREADS_MAX : threads;
+}
+
+static size_t _pool_start(size_t threads)
+{
+    // Pool with fewer threads than requested (failed pthread_create) is kept, not respawned on every call.
+    if (threads == _pool.requested)
+    {
+        return _pool.started;
+    }
+
+    _pool_stop();
+    _pool.requested = threads;
+
+    // Thread 0 is the caller, it only needs its queue.
+    pthread_mutex_init(&_pool.queues[0].lock, NULL);
+    _pool.started = 1u;
+
+    for (size_t i = 1; i < threads; i++)
+    {
+        pthread_mutex_init(&_pool.queues[i].lock, NULL);
+        _pool.queues[i].begin = 0u;
+        _pool.queues[i].end = 0u;
+        if (0 != pthread_create(&_pool.threads[i], NULL, _pool_thread, (void *)(uintptr_t)i))
+        {
+            pthread_mutex_destroy(&_pool.queues[i].lock);
+            break;
+        }
+        _pool.started++;
+    }
+
+    return _pool.started;
+}
+
+static void _pool_stop(void)
+{
+    if (0u == _pool.started)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&_pool.lock);
+    _pool.stop = true;
+    pthread_cond_broadcast(&_pool.start);
+    pthread_mutex_unlock(&_pool.lock);
+
+    for (size_t i = 1; i < _pool.started; i++)
+    {
+        pthread_join(_pool.threads[i], NULL);
+    }
+    for (size_t i = 0; i < _pool.started; i++)
+    {
+        pthread_mutex_destroy(&_pool.queues[i].lock);
+    }
+
+    _pool.stop = false;
+    _pool.started = 0u;
+    _pool.requested = 0u;
+}
+
+static bool _pool_take(size_t self, size_t *index)
+{
+    for (size_t n = 0; n < _pool.started; n++)
+    {
+        size_t victim = (self + n) % _pool.started;
+        calc_crc_queue_t *queue = &_pool.queues[victim];
+        bool taken = false;
+
+        pthread_mutex_lock(&queue->lock);
+        if (queue->begin < queue->end)
+        {
+            *index = (victim == self) ? queue->begin++ : --queue->end;
+            taken = true;
+        }
+        pthread_mutex_unlock(&queue->lock);
+
+        if (true == taken)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void _pool_work(size_t self)
+{
+    size_t index;
+
+    while (true == _pool_take(self, &index))
+    {
+        calc_crc_t crc = _pool.crc;
+        size_t offset = index * _pool.span;
+        size_t length = ((_pool.length - offset) < _pool.span) ? (_pool.length - offset) : _pool.span;
+
+        CALC_CRC_Calculate(&crc, &_pool.data[offset], length, &_pool.results[index]);
+
+        pthread_mutex_lock(&_pool.lock);
+        if (0u == --_pool.pending)
+        {
+            pthread_cond_signal(&_pool.done);
+        }
+        pthread_mutex_unlock(&_pool.lock);
+    }
+}
+
+static void *_pool_thread(void *arg)
+{
+    size_t self = (size_t)(uintptr_t)arg;
+    uint64_t generation = 0u;
+
+    pthread_mutex_lock(&_pool.lock);
+    generation = _pool.generation;
+
+    while (false == _pool.stop)
+    {
+        if (generation == _pool.generation)
+        {
+            pthread_cond_wait(&_pool.start, &_pool.lock);
+            continue;
+        }
+
+        generation = _pool.generation;
+        pthread_mutex_unlock(&_pool.lock);
+        _pool_work(self);
+        pthread_mutex_lock(&_pool.lock);
+    }
+
+    pthread_mutex_unlock(&_pool.lock);
+
+    return NULL;
+}
+
+#endif /* (true == CALC_CRC_CONF_PARALLEL_USE) */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,412 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc_shared.c
+ * @brief       Immutable reference-counted models shared by many small per-stream contexts. Models are interned in a
+ *              global cache, so all streams of the same parameters use one lookup table (precomputed read-only tables
+ *              when available) and one bound kernel.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-06
+ * @version     1.0.0
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __has_include("calc_crc_conf.h")
+#include "calc_crc_conf.h"
+#endif /* __has_include("calc_crc_conf.h") */
+
+#include "calc_crc/calc_crc_ptypes.h"
+#include "calc_crc/calc_crc_gtypes.h"
+#include "calc_crc/calc_crc.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Protect the model cache with a mutex (POSIX threads), required when models are acquired from many threads.
+ */
+#ifndef CALC_CRC_CONF_SHARED_LOCK_USE
+#if defined(__unix__) || defined(__APPLE__)
+#define CALC_CRC_CONF_SHARED_LOCK_USE (true)
+#else
+#define CALC_CRC_CONF_SHARED_LOCK_USE (false)
+#endif
+#endif /* CALC_CRC_CONF_SHARED_LOCK_USE */
+
+/**
+ * @brief   Number of buckets of the model cache (power of two).
+ */
+#ifndef CALC_CRC_CONF_SHARED_BUCKETS
+#define CALC_CRC_CONF_SHARED_BUCKETS (64u)
+#endif /* CALC_CRC_CONF_SHARED_BUCKETS */
+
+#if (true == CALC_CRC_CONF_SHARED_LOCK_USE)
+#include <pthread.h>
+#define CALC_CRC_SHARED_LOCK()   pthread_mutex_lock(&_cache_lock)
+#define CALC_CRC_SHARED_UNLOCK() pthread_mutex_unlock(&_cache_lock)
+#else
+#define CALC_CRC_SHARED_LOCK()
+#define CALC_CRC_SHARED_UNLOCK()
+#endif /* (true == CALC_CRC_CONF_SHARED_LOCK_USE) */
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Shared model, never modified after it is inserted into the cache (except the reference count).
+ */
+struct calc_crc_shared
+{
+    calc_crc_shared_t *next; // Next model in the cache bucket.
+    size_t refs;             // Number of references (protected by the cache lock).
+    calc_crc_model_t info;   // Model parameters (cache key).
+    calc_crc_t crc;          // Instance bound at creation, copied by calculations.
+    calc_crc_conf_t conf;    // Configuration of the instance (table used when no precomputed tables exist).
+};
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+/**
+ * @brief   Get width of the CRC type in bits.
+ * @param   type        Type of CRC calculation.
+ * @return  Width of the register in bits.
+ */
+static uint8_t _type_width(calc_crc_type_e type);
+
+/**
+ * @brief   Get mask of the valid bits of a CRC width.
+ * @param   width       CRC width in bits (1 - 64).
+ * @return  Mask of the CRC bits.
+ */
+static uint64_t _width_mask(uint8_t width);
+
+/**
+ * @brief   Get cache bucket of the model parameters.
+ * @param   info        Pointer to the model parameters (masked to the width).
+ * @return  Bucket index.
+ */
+static size_t _bucket(const calc_crc_model_t *info);
+
+/**
+ * @brief   Compare parameters of two models (name, alias, check and hints are not compared).
+ * @param   a           Pointer to the first model parameters.
+ * @param   b           Pointer to the second model parameters.
+ * @return  True if the models calculate the same CRC.
+ */
+static bool _same_model(const calc_crc_model_t *a, const calc_crc_model_t *b);
+
+/**
+ * @brief   Find precomputed tables of the polynomial and reflection in the model catalogue.
+ * @param   info        Pointer to the model parameters.
+ * @return  Pointer to the precomputed tables or NULL.
+ */
+static const void *_find_tables(const calc_crc_model_t *info);
+
+/**
+ * @brief   Create a per-call instance of the shared model with the stream state.
+ * @param   crc         Pointer to the instance to fill.
+ * @param   stream      Pointer to the stream context.
+ */
+static void _stream_load(calc_crc_t *crc, const calc_crc_stream_t *stream);
+
+/**
+ * @brief   Store the stream state of a per-call instance into the stream context.
+ * @param   stream      Pointer to the stream context.
+ * @param   crc         Pointer to the instance.
+ */
+static void _stream_store(calc_crc_stream_t *stream, const calc_crc_t *crc);
+
+// --- Private Variables -----------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Interning cache of the shared models.
+ */
+static calc_crc_shared_t *_cache[CALC_CRC_CONF_SHARED_BUCKETS];
+
+#if (true == CALC_CRC_CONF_SHARED_LOCK_USE)
+
+/**
+ * @brief   Lock of the cache and reference counts.
+ */
+static pthread_mutex_t _cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+#endif /* (true == CALC_CRC_CONF_SHARED_LOCK_USE) */
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+calc_crc_status_e CALC_CRC_SharedAcquire(const calc_crc_model_t *info, calc_crc_shared_t **model)
+{
+    CHECK_ARGS_NULL_PTR(info, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(model, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= info->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    uint8_t width = ((0u == info->width) || (64u < info->width)) ? _type_width(info->type) : info->width;
+    uint64_t mask = _width_mask(width);
+    calc_crc_model_t key = {
+        .type = info->type,
+        .width = (0u == info->width) ? width : info->width,
+        .polynomial = info->polynomial & mask,
+        .initial_value = info->initial_value & mask,
+        .final_value = info->final_value & mask,
+        .input_reflected = info->input_reflected,
+        .output_reflected = info->output_reflected,
+        .kernel = info->kernel,
+        .tables = info->tables,
+    };
+    size_t bucket = _bucket(&key);
+
+    CALC_CRC_SHARED_LOCK();
+
+    for (calc_crc_shared_t *entry = _cache[bucket]; NULL != entry; entry = entry->next)
+    {
+        if (true == _same_model(&entry->info, &key))
+        {
+            entry->refs++;
+            CALC_CRC_SHARED_UNLOCK();
+            *model = entry;
+            return CALC_CRC_STATUS_OK;
+        }
+    }
+
+    calc_crc_shared_t *entry = (calc_crc_shared_t *)calloc(1, sizeof(calc_crc_shared_t));
+
+    if (NULL == entry)
+    {
+        CALC_CRC_SHARED_UNLOCK();
+        return CALC_CRC_STATUS_ERROR;
+    }
+
+    // Precomputed tables of the catalogue are used when they match, so most models need no table of their own.
+    if (NULL == key.tables)
+    {
+        key.tables = _find_tables(&key);
+    }
+
+    calc_crc_status_e status = CALC_CRC_InitParams(&entry->crc, &entry->conf, &key);
+
+    if (CALC_CRC_STATUS_OK != status)
+    {
+        CALC_CRC_SHARED_UNLOCK();
+        free(entry);
+        return status;
+    }
+
+    entry->info = key;
+    entry->refs = 1u;
+    entry->next = _cache[bucket];
+    _cache[bucket] = entry;
+
+    CALC_CRC_SHARED_UNLOCK();
+
+    *model = entry;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_SharedRelease(calc_crc_shared_t *model)
+{
+    CHECK_ARGS_NULL_PTR(model, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    size_t bucket = _bucket(&model->info);
+    bool last = false;
+
+    CALC_CRC_SHARED_LOCK();
+
+    if (0u == model->refs)
+    {
+        CALC_CRC_SHARED_UNLOCK();
+        return CALC_CRC_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    model->refs--;
+    if (0u == model->refs)
+    {
+        calc_crc_shared_t **link = &_cache[bucket];
+
+        while (model != *link)
+        {
+            link = &(*link)->next;
+        }
+        *link = model->next;
+        last = true;
+    }
+
+    CALC_CRC_SHARED_UNLOCK();
+
+    if (true == last)
+    {
+        free(model);
+    }
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_SharedCalculate(const calc_crc_shared_t *model, const void *data, size_t length,
+                                           void *result)
+{
+    CHECK_ARGS_NULL_PTR(model, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    // Calculation writes intermediate values into the instance, shared instance is only copied.
+    calc_crc_t crc = model->crc;
+
+    return CALC_CRC_Calculate(&crc, data, length, result);
+}
+
+calc_crc_status_e CALC_CRC_StreamInit(calc_crc_stream_t *stream, const calc_crc_shared_t *model)
+{
+    CHECK_ARGS_NULL_PTR(stream, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(model, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    MEMSET(stream, 0, sizeof(calc_crc_stream_t));
+    stream->model = model;
+
+    return CALC_CRC_STATUS_OK;
+}
+
+calc_crc_status_e CALC_CRC_StreamUpdate(calc_crc_stream_t *stream, const void *data, size_t length)
+{
+    CHECK_ARGS_NULL_PTR(stream, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stream->model, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    calc_crc_t crc;
+
+    _stream_load(&crc, stream);
+    calc_crc_status_e status = CALC_CRC_Update(&crc, data, length);
+    _stream_store(stream, &crc);
+
+    return status;
+}
+
+calc_crc_status_e CALC_CRC_StreamUpdateFill(calc_crc_stream_t *stream, uint8_t byte, size_t count)
+{
+    CHECK_ARGS_NULL_PTR(stream, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stream->model, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    calc_crc_t crc;
+
+    _stream_load(&crc, stream);
+    calc_crc_status_e status = CALC_CRC_UpdateFill(&crc, byte, count);
+    _stream_store(stream, &crc);
+
+    return status;
+}
+
+calc_crc_status_e CALC_CRC_StreamFinalize(calc_crc_stream_t *stream, void *result)
+{
+    CHECK_ARGS_NULL_PTR(stream, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stream->model, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    calc_crc_t crc;
+
+    _stream_load(&crc, stream);
+    calc_crc_status_e status = CALC_CRC_Finalize(&crc, result);
+    _stream_store(stream, &crc);
+
+    return status;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+static uint8_t _type_width(calc_crc_type_e type)
+{
+    switch (type)
+    {
+        // ---- 8-bit calculator
+        case CALC_CRC_TYPE_8BIT:
+        case CALC_CRC_TYPE_SUM8:
+        case CALC_CRC_TYPE_LRC8:
+        {
+            return 8u;
+        }
+        // ---- 16-bit calculator
+        case CALC_CRC_TYPE_16BIT:
+        case CALC_CRC_TYPE_FLETCHER16:
+        case CALC_CRC_TYPE_INET16:
+        {
+            return 16u;
+        }
+        // ---- 32-bit calculator
+        case CALC_CRC_TYPE_32BIT:
+        case CALC_CRC_TYPE_FLETCHER32:
+        case CALC_CRC_TYPE_ADLER32:
+        {
+            return 32u;
+        }
+        // -------------------- Default exit (64-bit calculator)
+        default:
+        {
+            return 64u;
+        }
+    }
+}
+
+static uint64_t _width_mask(uint8_t width)
+{
+    return ((uint64_t)1u << (width - 1u)) | (((uint64_t)1u << (width - 1u)) - 1u);
+}
+
+static size_t _bucket(const calc_crc_model_t *info)
+{
+    uint64_t hash = ((uint64_t)info->type << 8) ^ info->width;
+
+    hash = (hash ^ info->polynomial) * 0x9E3779B97F4A7C15u;
+    hash = (hash ^ info->initial_value) * 0x9E3779B97F4A7C15u;
+    hash = (hash ^ info->final_value) * 0x9E3779B97F4A7C15u;
+    hash = (hash ^ ((uint64_t)info->input_reflected << 1) ^ (uint64_t)info->output_reflected) * 0x9E3779B97F4A7C15u;
+
+    return (size_t)(hash >> 32) & (CALC_CRC_CONF_SHARED_BUCKETS - 1u);
+}
+
+static bool _same_model(const calc_crc_model_t *a, const calc_crc_model_t *b)
+{
+    return (a->type == b->type) && (a->width == b->width) && (a->polynomial == b->polynomial) &&
+           (a->initial_value == b->initial_value) && (a->final_value == b->final_value) &&
+           (a->input_reflected == b->input_reflected) && (a->output_reflected == b->output_reflected);
+}
+
+static const void *_find_tables(const calc_crc_model_t *info)
+{
+    const calc_crc_model_t *entry;
+
+    for (size_t i = 0; i < (size_t)CALC_CRC_MODEL_MAX; i++)
+    {
+        CALC_CRC_GetModel((calc_crc_model_e)i, &entry);
+        if ((NULL != entry->tables) && (entry->type == info->type) && (entry->width == info->width) &&
+            (entry->polynomial == info->polynomial) && (entry->input_reflected == info->input_reflected))
+        {
+            return entry->tables;
+        }
+    }
+
+    return NULL;
+}
+
+static void _stream_load(calc_crc_t *crc, const calc_crc_stream_t *stream)
+{
+    *crc = stream->model->crc;
+    crc->update_crc = stream->update_crc;
+    crc->update_chunk = stream->update_chunk;
+    crc->update_in_progress = stream->update_in_progress;
+    crc->update_tail = stream->update_tail;
+    crc->update_tail_length = stream->update_tail_length;
+}
+
+static void _stream_store(calc_crc_stream_t *stream, const calc_crc_t *crc)
+{
+    stream->update_crc = crc->update_crc;
+    stream->update_chunk = crc->update_chunk;
+    stream->update_in_progress = crc->update_in_progress;
+    stream->update_tail = crc->update_tail;
+    stream->update_tail_length = crc->update_tail_length;
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,1871 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc_tables.c
+ * @brief       Precomputed read-only lookup tables of frequently used CRC polynomials. Tables are the same as generated
+ *              by CALC_CRC_Init; the 32-bit and 64-bit bundles also contain slicing-by-8 rows.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-06
+ * @version     1.0.0
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "calc_crc/calc_crc_gtypes.h"
+#include "calc_crc/calc_crc_tables.h"
+
+// --- calc_crc_tables_crc8 --------------------------------------------------------------------------------------------
+
+static const uint8_t _table_crc8[256] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+    0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+    0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+    0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+    0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+    0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+    0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+    0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+    0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+    0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+    0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3,
+};
+
+/**
+ * @brief   CRC-8 tables (polynomial 0x07, MSB-first), e.g. CRC-8/SMBUS, CRC-8/I-432-1.
+ */
+const calc_crc_8bit_tables_t calc_crc_tables_crc8 = {
+    .polynomial = 0x07,
+    .reflected = false,
+    .slices = 0,
+    .table = _table_crc8,
+    .slice_table = NULL,
+    .fold_constants = {0x0000000000000010u, 0x0000000000000037u, 0x0000000000000008u, 0x0000000000000098u,
+                       0x0000000000000004u, 0x000000000000004Cu, 0x0000000000000002u, 0x0000000000000026u},
+};
+
+// --- calc_crc_tables_crc16_ccitt -------------------------------------------------------------------------------------
+
+static const uint16_t _table_crc16_ccitt[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B,
+    0xC18C, 0xD1AD, 0xE1CE, 0xF1EF, 0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE, 0x2462, 0x3443, 0x0420, 0x1401,
+    0x64E6, 0x74C7, 0x44A4, 0x5485, 0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4, 0xB75B, 0xA77A, 0x9719, 0x8738,
+    0xF7DF, 0xE7FE, 0xD79D, 0xC7BC, 0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B, 0x5AF5, 0x4AD4, 0x7AB7, 0x6A96,
+    0x1A71, 0x0A50, 0x3A33, 0x2A12, 0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41, 0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD,
+    0xAD2A, 0xBD0B, 0x8D68, 0x9D49, 0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78, 0x9188, 0x81A9, 0xB1CA, 0xA1EB,
+    0xD10C, 0xC12D, 0xF14E, 0xE16F, 0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E, 0x02B1, 0x1290, 0x22F3, 0x32D2,
+    0x4235, 0x5214, 0x6277, 0x7256, 0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405, 0xA7DB, 0xB7FA, 0x8799, 0x97B8,
+    0xE75F, 0xF77E, 0xC71D, 0xD73C, 0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB, 0x5844, 0x4865, 0x7806, 0x6827,
+    0x18C0, 0x08E1, 0x3882, 0x28A3, 0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92, 0xFD2E, 0xED0F, 0xDD6C, 0xCD4D,
+    0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9, 0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8, 0x6E17, 0x7E36, 0x4E55, 0x5E74,
+    0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+/**
+ * @brief   CRC-16 tables (polynomial 0x1021, MSB-first), e.g. CRC-16/IBM-3740, CRC-16/XMODEM.
+ */
+const calc_crc_16bit_tables_t calc_crc_tables_crc16_ccitt = {
+    .polynomial = 0x1021,
+    .reflected = false,
+    .slices = 0,
+    .table = _table_crc16_ccitt,
+    .slice_table = NULL,
+    .fold_constants = {0x00000000000013FCu, 0x0000000000008832u, 0x000000000000CDE2u, 0x0000000000002535u,
+                       0x0000000000008E29u, 0x00000000000026AAu, 0x000000000000AEFCu, 0x000000000000650Bu},
+};
+
+// --- calc_crc_tables_crc16_kermit ------------------------------------------------------------------------------------
+
+static const uint16_t _table_crc16_kermit[256] = {
+    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF, 0x8C48, 0x9DC1, 0xAF5A, 0xBED3,
+    0xCA6C, 0xDBE5, 0xE97E, 0xF8F7, 0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
+    0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876, 0x2102, 0x308B, 0x0210, 0x1399,
+    0x6726, 0x76AF, 0x4434, 0x55BD, 0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C, 0xBDCB, 0xAC42, 0x9ED9, 0x8F50,
+    0xFBEF, 0xEA66, 0xD8FD, 0xC974, 0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
+    0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3, 0x5285, 0x430C, 0x7197, 0x601E,
+    0x14A1, 0x0528, 0x37B3, 0x263A, 0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9, 0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5,
+    0xA96A, 0xB8E3, 0x8A78, 0x9BF1, 0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
+    0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70, 0x8408, 0x9581, 0xA71A, 0xB693,
+    0xC22C, 0xD3A5, 0xE13E, 0xF0B7, 0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036, 0x18C1, 0x0948, 0x3BD3, 0x2A5A,
+    0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E, 0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
+    0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD, 0xB58B, 0xA402, 0x9699, 0x8710,
+    0xF3AF, 0xE226, 0xD0BD, 0xC134, 0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3, 0x4A44, 0x5BCD, 0x6956, 0x78DF,
+    0x0C60, 0x1DE9, 0x2F72, 0x3EFB, 0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
+    0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A, 0xE70E, 0xF687, 0xC41C, 0xD595,
+    0xA12A, 0xB0A3, 0x8238, 0x93B1, 0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330, 0x7BC7, 0x6A4E, 0x58D5, 0x495C,
+    0x3DE3, 0x2C6A, 0x1EF1, 0x0F78,
+};
+
+/**
+ * @brief   CRC-16 tables (polynomial 0x1021, LSB-first), e.g. CRC-16/KERMIT, CRC-16/IBM-SDLC.
+ */
+const calc_crc_16bit_tables_t calc_crc_tables_crc16_kermit = {
+    .polynomial = 0x1021,
+    .reflected = true,
+    .slices = 0,
+    .table = _table_crc16_kermit,
+    .slice_table = NULL,
+    .fold_constants = {0x9822000000000000u, 0x7F90000000000000u, 0x5159000000000000u, 0x8F66000000000000u,
+                       0xAAC8000000000000u, 0x20F3000000000000u, 0xA95D000000000000u, 0x7EEA000000000000u},
+};
+
+// --- calc_crc_tables_crc16_arc ---------------------------------------------------------------------------------------
+
+static const uint16_t _table_crc16_arc[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741,
+    0x0500, 0xC5C1, 0xC481, 0x0440, 0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841, 0xD801, 0x18C0, 0x1980, 0xD941,
+    0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641, 0xD201, 0x12C0, 0x1380, 0xD341,
+    0x1100, 0xD1C1, 0xD081, 0x1040, 0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441, 0x3C00, 0xFCC1, 0xFD81, 0x3D40,
+    0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41,
+    0x2D00, 0xEDC1, 0xEC81, 0x2C40, 0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041, 0xA001, 0x60C0, 0x6180, 0xA141,
+    0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0, 0x6B80, 0xAB41,
+    0x6900, 0xA9C1, 0xA881, 0x6840, 0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40, 0xB401, 0x74C0, 0x7580, 0xB541,
+    0x7700, 0xB7C1, 0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741,
+    0x5500, 0x95C1, 0x9481, 0x5440, 0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841, 0x8801, 0x48C0, 0x4980, 0x8941,
+    0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341,
+    0x4100, 0x81C1, 0x8081, 0x4040,
+};
+
+/**
+ * @brief   CRC-16 tables (polynomial 0x8005, LSB-first), e.g. CRC-16/ARC, CRC-16/MODBUS, CRC-16/USB.
+ */
+const calc_crc_16bit_tables_t calc_crc_tables_crc16_arc = {
+    .polynomial = 0x8005,
+    .reflected = true,
+    .slices = 0,
+    .table = _table_crc16_arc,
+    .slice_table = NULL,
+    .fold_constants = {0xC450000000000000u, 0x8101000000000000u, 0xAAA4000000000000u, 0xAC91000000000000u,
+                       0xC991000000000000u, 0x5001000000000000u, 0xCCD0000000000000u, 0xC100000000000000u},
+};
+
+// --- calc_crc_tables_crc32 -------------------------------------------------------------------------------------------
+
+static const uint32_t _table_crc32[256] = {
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D,
+};
+
+static const uint32_t _slice_table_crc32[1792] = {
+    0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3, 0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+    0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB, 0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+    0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192, 0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+    0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A, 0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+    0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761, 0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+    0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69, 0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+    0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530, 0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+    0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38, 0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+    0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6, 0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+    0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE, 0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+    0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97, 0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+    0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F, 0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+    0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864, 0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+    0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C, 0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+    0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35, 0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+    0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D, 0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+    0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88, 0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+    0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180, 0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+    0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9, 0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+    0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1, 0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+    0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A, 0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+    0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522, 0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+    0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B, 0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+    0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773, 0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+    0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D, 0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+    0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85, 0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+    0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC, 0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+    0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4, 0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+    0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F, 0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+    0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27, 0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+    0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E, 0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+    0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876, 0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72,
+    0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59, 0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+    0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1, 0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+    0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29, 0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+    0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91, 0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+    0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9, 0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+    0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901, 0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+    0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9, 0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+    0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71, 0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+    0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399, 0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+    0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221, 0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+    0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9, 0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+    0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151, 0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+    0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579, 0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+    0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1, 0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+    0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609, 0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+    0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1, 0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+    0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9, 0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+    0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461, 0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+    0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9, 0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+    0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711, 0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+    0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339, 0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+    0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281, 0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+    0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049, 0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+    0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1, 0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+    0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819, 0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+    0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1, 0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+    0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69, 0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+    0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1, 0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+    0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9, 0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+    0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41, 0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+    0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89, 0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+    0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31, 0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED,
+    0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE, 0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+    0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701, 0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+    0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871, 0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+    0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E, 0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+    0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0, 0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+    0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F, 0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+    0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F, 0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+    0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0, 0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+    0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3, 0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+    0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C, 0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+    0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C, 0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+    0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3, 0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+    0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED, 0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+    0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002, 0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+    0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72, 0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+    0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D, 0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+    0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5, 0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+    0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A, 0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+    0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A, 0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+    0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5, 0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+    0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB, 0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+    0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04, 0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+    0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174, 0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+    0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B, 0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+    0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8, 0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+    0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907, 0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+    0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677, 0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+    0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98, 0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+    0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6, 0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+    0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639, 0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+    0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949, 0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+    0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6, 0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1,
+    0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0, 0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+    0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111, 0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+    0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52, 0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+    0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693, 0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+    0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4, 0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+    0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15, 0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+    0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256, 0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+    0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997, 0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+    0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299, 0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+    0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958, 0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+    0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B, 0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+    0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA, 0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+    0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D, 0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+    0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C, 0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+    0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F, 0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+    0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE, 0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+    0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42, 0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+    0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183, 0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+    0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0, 0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+    0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601, 0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+    0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546, 0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+    0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87, 0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+    0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4, 0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+    0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905, 0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+    0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B, 0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+    0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA, 0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+    0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589, 0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+    0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48, 0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+    0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F, 0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+    0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE, 0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+    0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D, 0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+    0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C, 0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C,
+    0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE, 0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+    0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3, 0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+    0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035, 0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+    0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258, 0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+    0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798, 0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+    0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5, 0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+    0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503, 0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+    0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E, 0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+    0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2, 0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+    0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF, 0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+    0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59, 0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+    0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834, 0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+    0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4, 0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+    0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99, 0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+    0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F, 0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+    0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02, 0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+    0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676, 0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+    0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B, 0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+    0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED, 0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+    0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680, 0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+    0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340, 0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+    0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D, 0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+    0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB, 0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+    0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6, 0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+    0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A, 0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+    0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77, 0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+    0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81, 0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+    0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC, 0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+    0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C, 0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+    0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41, 0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+    0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7, 0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+    0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA, 0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC,
+    0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D, 0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+    0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA, 0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+    0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653, 0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+    0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834, 0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+    0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301, 0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+    0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66, 0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+    0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF, 0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+    0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8, 0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+    0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4, 0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+    0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183, 0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+    0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A, 0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+    0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D, 0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+    0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678, 0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+    0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F, 0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+    0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6, 0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+    0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1, 0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+    0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F, 0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+    0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08, 0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+    0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1, 0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+    0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6, 0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+    0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3, 0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+    0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794, 0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+    0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D, 0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+    0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A, 0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+    0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516, 0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+    0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71, 0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+    0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8, 0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+    0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF, 0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+    0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A, 0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+    0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED, 0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+    0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044, 0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+    0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23, 0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30,
+    0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3, 0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+    0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56, 0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+    0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8, 0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+    0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D, 0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+    0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5, 0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+    0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00, 0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+    0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E, 0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+    0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B, 0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+    0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E, 0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+    0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB, 0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+    0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425, 0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+    0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90, 0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+    0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758, 0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+    0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED, 0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+    0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673, 0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+    0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6, 0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+    0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239, 0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+    0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C, 0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+    0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312, 0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+    0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7, 0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+    0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F, 0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+    0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA, 0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+    0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144, 0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+    0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1, 0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+    0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4, 0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+    0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61, 0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+    0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF, 0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+    0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A, 0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+    0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282, 0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+    0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937, 0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+    0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9, 0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+    0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C, 0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6,
+};
+
+/**
+ * @brief   CRC-32 tables (polynomial 0x04C11DB7, LSB-first), e.g. CRC-32/ISO-HDLC, CRC-32/JAMCRC.
+ */
+const calc_crc_32bit_tables_t calc_crc_tables_crc32 = {
+    .polynomial = 0x04C11DB7,
+    .reflected = true,
+    .slices = 8,
+    .table = _table_crc32,
+    .slice_table = _slice_table_crc32,
+    .fold_constants = {0x653D982200000000u, 0xCAD38E8F00000000u, 0x69CCFC0D00000000u, 0x2A28386200000000u,
+                       0x9570D49500000000u, 0x01B5FD1D00000000u, 0x65673B4600000000u, 0x9BA54C6F00000000u},
+};
+
+// --- calc_crc_tables_crc32_bzip2 -------------------------------------------------------------------------------------
+
+static const uint32_t _table_crc32_bzip2[256] = {
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+    0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75,
+    0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
+    0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
+    0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
+    0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
+    0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
+    0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072,
+    0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
+    0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
+    0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
+    0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
+    0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
+    0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2,
+    0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
+    0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
+    0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
+    0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
+    0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
+    0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B,
+    0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
+    0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
+    0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
+    0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
+    0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
+    0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
+    0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
+    0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
+    0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
+    0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
+    0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4,
+};
+
+static const uint32_t _slice_table_crc32_bzip2[1792] = {
+    0x00000000, 0xD219C1DC, 0xA0F29E0F, 0x72EB5FD3, 0x452421A9, 0x973DE075, 0xE5D6BFA6, 0x37CF7E7A,
+    0x8A484352, 0x5851828E, 0x2ABADD5D, 0xF8A31C81, 0xCF6C62FB, 0x1D75A327, 0x6F9EFCF4, 0xBD873D28,
+    0x10519B13, 0xC2485ACF, 0xB0A3051C, 0x62BAC4C0, 0x5575BABA, 0x876C7B66, 0xF58724B5, 0x279EE569,
+    0x9A19D841, 0x4800199D, 0x3AEB464E, 0xE8F28792, 0xDF3DF9E8, 0x0D243834, 0x7FCF67E7, 0xADD6A63B,
+    0x20A33626, 0xF2BAF7FA, 0x8051A829, 0x524869F5, 0x6587178F, 0xB79ED653, 0xC5758980, 0x176C485C,
+    0xAAEB7574, 0x78F2B4A8, 0x0A19EB7B, 0xD8002AA7, 0xEFCF54DD, 0x3DD69501, 0x4F3DCAD2, 0x9D240B0E,
+    0x30F2AD35, 0xE2EB6CE9, 0x9000333A, 0x4219F2E6, 0x75D68C9C, 0xA7CF4D40, 0xD5241293, 0x073DD34F,
+    0xBABAEE67, 0x68A32FBB, 0x1A487068, 0xC851B1B4, 0xFF9ECFCE, 0x2D870E12, 0x5F6C51C1, 0x8D75901D,
+    0x41466C4C, 0x935FAD90, 0xE1B4F243, 0x33AD339F, 0x04624DE5, 0xD67B8C39, 0xA490D3EA, 0x76891236,
+    0xCB0E2F1E, 0x1917EEC2, 0x6BFCB111, 0xB9E570CD, 0x8E2A0EB7, 0x5C33CF6B, 0x2ED890B8, 0xFCC15164,
+    0x5117F75F, 0x830E3683, 0xF1E56950, 0x23FCA88C, 0x1433D6F6, 0xC62A172A, 0xB4C148F9, 0x66D88925,
+    0xDB5FB40D, 0x094675D1, 0x7BAD2A02, 0xA9B4EBDE, 0x9E7B95A4, 0x4C625478, 0x3E890BAB, 0xEC90CA77,
+    0x61E55A6A, 0xB3FC9BB6, 0xC117C465, 0x130E05B9, 0x24C17BC3, 0xF6D8BA1F, 0x8433E5CC, 0x562A2410,
+    0xEBAD1938, 0x39B4D8E4, 0x4B5F8737, 0x994646EB, 0xAE893891, 0x7C90F94D, 0x0E7BA69E, 0xDC626742,
+    0x71B4C179, 0xA3AD00A5, 0xD1465F76, 0x035F9EAA, 0x3490E0D0, 0xE689210C, 0x94627EDF, 0x467BBF03,
+    0xFBFC822B, 0x29E543F7, 0x5B0E1C24, 0x8917DDF8, 0xBED8A382, 0x6CC1625E, 0x1E2A3D8D, 0xCC33FC51,
+    0x828CD898, 0x50951944, 0x227E4697, 0xF067874B, 0xC7A8F931, 0x15B138ED, 0x675A673E, 0xB543A6E2,
+    0x08C49BCA, 0xDADD5A16, 0xA83605C5, 0x7A2FC419, 0x4DE0BA63, 0x9FF97BBF, 0xED12246C, 0x3F0BE5B0,
+    0x92DD438B, 0x40C48257, 0x322FDD84, 0xE0361C58, 0xD7F96222, 0x05E0A3FE, 0x770BFC2D, 0xA5123DF1,
+    0x189500D9, 0xCA8CC105, 0xB8679ED6, 0x6A7E5F0A, 0x5DB12170, 0x8FA8E0AC, 0xFD43BF7F, 0x2F5A7EA3,
+    0xA22FEEBE, 0x70362F62, 0x02DD70B1, 0xD0C4B16D, 0xE70BCF17, 0x35120ECB, 0x47F95118, 0x95E090C4,
+    0x2867ADEC, 0xFA7E6C30, 0x889533E3, 0x5A8CF23F, 0x6D438C45, 0xBF5A4D99, 0xCDB1124A, 0x1FA8D396,
+    0xB27E75AD, 0x6067B471, 0x128CEBA2, 0xC0952A7E, 0xF75A5404, 0x254395D8, 0x57A8CA0B, 0x85B10BD7,
+    0x383636FF, 0xEA2FF723, 0x98C4A8F0, 0x4ADD692C, 0x7D121756, 0xAF0BD68A, 0xDDE08959, 0x0FF94885,
+    0xC3CAB4D4, 0x11D37508, 0x63382ADB, 0xB121EB07, 0x86EE957D, 0x54F754A1, 0x261C0B72, 0xF405CAAE,
+    0x4982F786, 0x9B9B365A, 0xE9706989, 0x3B69A855, 0x0CA6D62F, 0xDEBF17F3, 0xAC544820, 0x7E4D89FC,
+    0xD39B2FC7, 0x0182EE1B, 0x7369B1C8, 0xA1707014, 0x96BF0E6E, 0x44A6CFB2, 0x364D9061, 0xE45451BD,
+    0x59D36C95, 0x8BCAAD49, 0xF921F29A, 0x2B383346, 0x1CF74D3C, 0xCEEE8CE0, 0xBC05D333, 0x6E1C12EF,
+    0xE36982F2, 0x3170432E, 0x439B1CFD, 0x9182DD21, 0xA64DA35B, 0x74546287, 0x06BF3D54, 0xD4A6FC88,
+    0x6921C1A0, 0xBB38007C, 0xC9D35FAF, 0x1BCA9E73, 0x2C05E009, 0xFE1C21D5, 0x8CF77E06, 0x5EEEBFDA,
+    0xF33819E1, 0x2121D83D, 0x53CA87EE, 0x81D34632, 0xB61C3848, 0x6405F994, 0x16EEA647, 0xC4F7679B,
+    0x79705AB3, 0xAB699B6F, 0xD982C4BC, 0x0B9B0560, 0x3C547B1A, 0xEE4DBAC6, 0x9CA6E515, 0x4EBF24C9,
+    0x00000000, 0x01D8AC87, 0x03B1590E, 0x0269F589, 0x0762B21C, 0x06BA1E9B, 0x04D3EB12, 0x050B4795,
+    0x0EC56438, 0x0F1DC8BF, 0x0D743D36, 0x0CAC91B1, 0x09A7D624, 0x087F7AA3, 0x0A168F2A, 0x0BCE23AD,
+    0x1D8AC870, 0x1C5264F7, 0x1E3B917E, 0x1FE33DF9, 0x1AE87A6C, 0x1B30D6EB, 0x19592362, 0x18818FE5,
+    0x134FAC48, 0x129700CF, 0x10FEF546, 0x112659C1, 0x142D1E54, 0x15F5B2D3, 0x179C475A, 0x1644EBDD,
+    0x3B1590E0, 0x3ACD3C67, 0x38A4C9EE, 0x397C6569, 0x3C7722FC, 0x3DAF8E7B, 0x3FC67BF2, 0x3E1ED775,
+    0x35D0F4D8, 0x3408585F, 0x3661ADD6, 0x37B90151, 0x32B246C4, 0x336AEA43, 0x31031FCA, 0x30DBB34D,
+    0x269F5890, 0x2747F417, 0x252E019E, 0x24F6AD19, 0x21FDEA8C, 0x2025460B, 0x224CB382, 0x23941F05,
+    0x285A3CA8, 0x2982902F, 0x2BEB65A6, 0x2A33C921, 0x2F388EB4, 0x2EE02233, 0x2C89D7BA, 0x2D517B3D,
+    0x762B21C0, 0x77F38D47, 0x759A78CE, 0x7442D449, 0x714993DC, 0x70913F5B, 0x72F8CAD2, 0x73206655,
+    0x78EE45F8, 0x7936E97F, 0x7B5F1CF6, 0x7A87B071, 0x7F8CF7E4, 0x7E545B63, 0x7C3DAEEA, 0x7DE5026D,
+    0x6BA1E9B0, 0x6A794537, 0x6810B0BE, 0x69C81C39, 0x6CC35BAC, 0x6D1BF72B, 0x6F7202A2, 0x6EAAAE25,
+    0x65648D88, 0x64BC210F, 0x66D5D486, 0x670D7801, 0x62063F94, 0x63DE9313, 0x61B7669A, 0x606FCA1D,
+    0x4D3EB120, 0x4CE61DA7, 0x4E8FE82E, 0x4F5744A9, 0x4A5C033C, 0x4B84AFBB, 0x49ED5A32, 0x4835F6B5,
+    0x43FBD518, 0x4223799F, 0x404A8C16, 0x41922091, 0x44996704, 0x4541CB83, 0x47283E0A, 0x46F0928D,
+    0x50B47950, 0x516CD5D7, 0x5305205E, 0x52DD8CD9, 0x57D6CB4C, 0x560E67CB, 0x54679242, 0x55BF3EC5,
+    0x5E711D68, 0x5FA9B1EF, 0x5DC04466, 0x5C18E8E1, 0x5913AF74, 0x58CB03F3, 0x5AA2F67A, 0x5B7A5AFD,
+    0xEC564380, 0xED8EEF07, 0xEFE71A8E, 0xEE3FB609, 0xEB34F19C, 0xEAEC5D1B, 0xE885A892, 0xE95D0415,
+    0xE29327B8, 0xE34B8B3F, 0xE1227EB6, 0xE0FAD231, 0xE5F195A4, 0xE4293923, 0xE640CCAA, 0xE798602D,
+    0xF1DC8BF0, 0xF0042777, 0xF26DD2FE, 0xF3B57E79, 0xF6BE39EC, 0xF766956B, 0xF50F60E2, 0xF4D7CC65,
+    0xFF19EFC8, 0xFEC1434F, 0xFCA8B6C6, 0xFD701A41, 0xF87B5DD4, 0xF9A3F153, 0xFBCA04DA, 0xFA12A85D,
+    0xD743D360, 0xD69B7FE7, 0xD4F28A6E, 0xD52A26E9, 0xD021617C, 0xD1F9CDFB, 0xD3903872, 0xD24894F5,
+    0xD986B758, 0xD85E1BDF, 0xDA37EE56, 0xDBEF42D1, 0xDEE40544, 0xDF3CA9C3, 0xDD555C4A, 0xDC8DF0CD,
+    0xCAC91B10, 0xCB11B797, 0xC978421E, 0xC8A0EE99, 0xCDABA90C, 0xCC73058B, 0xCE1AF002, 0xCFC25C85,
+    0xC40C7F28, 0xC5D4D3AF, 0xC7BD2626, 0xC6658AA1, 0xC36ECD34, 0xC2B661B3, 0xC0DF943A, 0xC10738BD,
+    0x9A7D6240, 0x9BA5CEC7, 0x99CC3B4E, 0x981497C9, 0x9D1FD05C, 0x9CC77CDB, 0x9EAE8952, 0x9F7625D5,
+    0x94B80678, 0x9560AAFF, 0x97095F76, 0x96D1F3F1, 0x93DAB464, 0x920218E3, 0x906BED6A, 0x91B341ED,
+    0x87F7AA30, 0x862F06B7, 0x8446F33E, 0x859E5FB9, 0x8095182C, 0x814DB4AB, 0x83244122, 0x82FCEDA5,
+    0x8932CE08, 0x88EA628F, 0x8A839706, 0x8B5B3B81, 0x8E507C14, 0x8F88D093, 0x8DE1251A, 0x8C39899D,
+    0xA168F2A0, 0xA0B05E27, 0xA2D9ABAE, 0xA3010729, 0xA60A40BC, 0xA7D2EC3B, 0xA5BB19B2, 0xA463B535,
+    0xAFAD9698, 0xAE753A1F, 0xAC1CCF96, 0xADC46311, 0xA8CF2484, 0xA9178803, 0xAB7E7D8A, 0xAAA6D10D,
+    0xBCE23AD0, 0xBD3A9657, 0xBF5363DE, 0xBE8BCF59, 0xBB8088CC, 0xBA58244B, 0xB831D1C2, 0xB9E97D45,
+    0xB2275EE8, 0xB3FFF26F, 0xB19607E6, 0xB04EAB61, 0xB545ECF4, 0xB49D4073, 0xB6F4B5FA, 0xB72C197D,
+    0x00000000, 0xDC6D9AB7, 0xBC1A28D9, 0x6077B26E, 0x7CF54C05, 0xA098D6B2, 0xC0EF64DC, 0x1C82FE6B,
+    0xF9EA980A, 0x258702BD, 0x45F0B0D3, 0x999D2A64, 0x851FD40F, 0x59724EB8, 0x3905FCD6, 0xE5686661,
+    0xF7142DA3, 0x2B79B714, 0x4B0E057A, 0x97639FCD, 0x8BE161A6, 0x578CFB11, 0x37FB497F, 0xEB96D3C8,
+    0x0EFEB5A9, 0xD2932F1E, 0xB2E49D70, 0x6E8907C7, 0x720BF9AC, 0xAE66631B, 0xCE11D175, 0x127C4BC2,
+    0xEAE946F1, 0x3684DC46, 0x56F36E28, 0x8A9EF49F, 0x961C0AF4, 0x4A719043, 0x2A06222D, 0xF66BB89A,
+    0x1303DEFB, 0xCF6E444C, 0xAF19F622, 0x73746C95, 0x6FF692FE, 0xB39B0849, 0xD3ECBA27, 0x0F812090,
+    0x1DFD6B52, 0xC190F1E5, 0xA1E7438B, 0x7D8AD93C, 0x61082757, 0xBD65BDE0, 0xDD120F8E, 0x017F9539,
+    0xE417F358, 0x387A69EF, 0x580DDB81, 0x84604136, 0x98E2BF5D, 0x448F25EA, 0x24F89784, 0xF8950D33,
+    0xD1139055, 0x0D7E0AE2, 0x6D09B88C, 0xB164223B, 0xADE6DC50, 0x718B46E7, 0x11FCF489, 0xCD916E3E,
+    0x28F9085F, 0xF49492E8, 0x94E32086, 0x488EBA31, 0x540C445A, 0x8861DEED, 0xE8166C83, 0x347BF634,
+    0x2607BDF6, 0xFA6A2741, 0x9A1D952F, 0x46700F98, 0x5AF2F1F3, 0x869F6B44, 0xE6E8D92A, 0x3A85439D,
+    0xDFED25FC, 0x0380BF4B, 0x63F70D25, 0xBF9A9792, 0xA31869F9, 0x7F75F34E, 0x1F024120, 0xC36FDB97,
+    0x3BFAD6A4, 0xE7974C13, 0x87E0FE7D, 0x5B8D64CA, 0x470F9AA1, 0x9B620016, 0xFB15B278, 0x277828CF,
+    0xC2104EAE, 0x1E7DD419, 0x7E0A6677, 0xA267FCC0, 0xBEE502AB, 0x6288981C, 0x02FF2A72, 0xDE92B0C5,
+    0xCCEEFB07, 0x108361B0, 0x70F4D3DE, 0xAC994969, 0xB01BB702, 0x6C762DB5, 0x0C019FDB, 0xD06C056C,
+    0x3504630D, 0xE969F9BA, 0x891E4BD4, 0x5573D163, 0x49F12F08, 0x959CB5BF, 0xF5EB07D1, 0x29869D66,
+    0xA6E63D1D, 0x7A8BA7AA, 0x1AFC15C4, 0xC6918F73, 0xDA137118, 0x067EEBAF, 0x660959C1, 0xBA64C376,
+    0x5F0CA517, 0x83613FA0, 0xE3168DCE, 0x3F7B1779, 0x23F9E912, 0xFF9473A5, 0x9FE3C1CB, 0x438E5B7C,
+    0x51F210BE, 0x8D9F8A09, 0xEDE83867, 0x3185A2D0, 0x2D075CBB, 0xF16AC60C, 0x911D7462, 0x4D70EED5,
+    0xA81888B4, 0x74751203, 0x1402A06D, 0xC86F3ADA, 0xD4EDC4B1, 0x08805E06, 0x68F7EC68, 0xB49A76DF,
+    0x4C0F7BEC, 0x9062E15B, 0xF0155335, 0x2C78C982, 0x30FA37E9, 0xEC97AD5E, 0x8CE01F30, 0x508D8587,
+    0xB5E5E3E6, 0x69887951, 0x09FFCB3F, 0xD5925188, 0xC910AFE3, 0x157D3554, 0x750A873A, 0xA9671D8D,
+    0xBB1B564F, 0x6776CCF8, 0x07017E96, 0xDB6CE421, 0xC7EE1A4A, 0x1B8380FD, 0x7BF43293, 0xA799A824,
+    0x42F1CE45, 0x9E9C54F2, 0xFEEBE69C, 0x22867C2B, 0x3E048240, 0xE26918F7, 0x821EAA99, 0x5E73302E,
+    0x77F5AD48, 0xAB9837FF, 0xCBEF8591, 0x17821F26, 0x0B00E14D, 0xD76D7BFA, 0xB71AC994, 0x6B775323,
+    0x8E1F3542, 0x5272AFF5, 0x32051D9B, 0xEE68872C, 0xF2EA7947, 0x2E87E3F0, 0x4EF0519E, 0x929DCB29,
+    0x80E180EB, 0x5C8C1A5C, 0x3CFBA832, 0xE0963285, 0xFC14CCEE, 0x20795659, 0x400EE437, 0x9C637E80,
+    0x790B18E1, 0xA5668256, 0xC5113038, 0x197CAA8F, 0x05FE54E4, 0xD993CE53, 0xB9E47C3D, 0x6589E68A,
+    0x9D1CEBB9, 0x4171710E, 0x2106C360, 0xFD6B59D7, 0xE1E9A7BC, 0x3D843D0B, 0x5DF38F65, 0x819E15D2,
+    0x64F673B3, 0xB89BE904, 0xD8EC5B6A, 0x0481C1DD, 0x18033FB6, 0xC46EA501, 0xA419176F, 0x78748DD8,
+    0x6A08C61A, 0xB6655CAD, 0xD612EEC3, 0x0A7F7474, 0x16FD8A1F, 0xCA9010A8, 0xAAE7A2C6, 0x768A3871,
+    0x93E25E10, 0x4F8FC4A7, 0x2FF876C9, 0xF395EC7E, 0xEF171215, 0x337A88A2, 0x530D3ACC, 0x8F60A07B,
+    0x00000000, 0x490D678D, 0x921ACF1A, 0xDB17A897, 0x20F48383, 0x69F9E40E, 0xB2EE4C99, 0xFBE32B14,
+    0x41E90706, 0x08E4608B, 0xD3F3C81C, 0x9AFEAF91, 0x611D8485, 0x2810E308, 0xF3074B9F, 0xBA0A2C12,
+    0x83D20E0C, 0xCADF6981, 0x11C8C116, 0x58C5A69B, 0xA3268D8F, 0xEA2BEA02, 0x313C4295, 0x78312518,
+    0xC23B090A, 0x8B366E87, 0x5021C610, 0x192CA19D, 0xE2CF8A89, 0xABC2ED04, 0x70D54593, 0x39D8221E,
+    0x036501AF, 0x4A686622, 0x917FCEB5, 0xD872A938, 0x2391822C, 0x6A9CE5A1, 0xB18B4D36, 0xF8862ABB,
+    0x428C06A9, 0x0B816124, 0xD096C9B3, 0x999BAE3E, 0x6278852A, 0x2B75E2A7, 0xF0624A30, 0xB96F2DBD,
+    0x80B70FA3, 0xC9BA682E, 0x12ADC0B9, 0x5BA0A734, 0xA0438C20, 0xE94EEBAD, 0x3259433A, 0x7B5424B7,
+    0xC15E08A5, 0x88536F28, 0x5344C7BF, 0x1A49A032, 0xE1AA8B26, 0xA8A7ECAB, 0x73B0443C, 0x3ABD23B1,
+    0x06CA035E, 0x4FC764D3, 0x94D0CC44, 0xDDDDABC9, 0x263E80DD, 0x6F33E750, 0xB4244FC7, 0xFD29284A,
+    0x47230458, 0x0E2E63D5, 0xD539CB42, 0x9C34ACCF, 0x67D787DB, 0x2EDAE056, 0xF5CD48C1, 0xBCC02F4C,
+    0x85180D52, 0xCC156ADF, 0x1702C248, 0x5E0FA5C5, 0xA5EC8ED1, 0xECE1E95C, 0x37F641CB, 0x7EFB2646,
+    0xC4F10A54, 0x8DFC6DD9, 0x56EBC54E, 0x1FE6A2C3, 0xE40589D7, 0xAD08EE5A, 0x761F46CD, 0x3F122140,
+    0x05AF02F1, 0x4CA2657C, 0x97B5CDEB, 0xDEB8AA66, 0x255B8172, 0x6C56E6FF, 0xB7414E68, 0xFE4C29E5,
+    0x444605F7, 0x0D4B627A, 0xD65CCAED, 0x9F51AD60, 0x64B28674, 0x2DBFE1F9, 0xF6A8496E, 0xBFA52EE3,
+    0x867D0CFD, 0xCF706B70, 0x1467C3E7, 0x5D6AA46A, 0xA6898F7E, 0xEF84E8F3, 0x34934064, 0x7D9E27E9,
+    0xC7940BFB, 0x8E996C76, 0x558EC4E1, 0x1C83A36C, 0xE7608878, 0xAE6DEFF5, 0x757A4762, 0x3C7720EF,
+    0x0D9406BC, 0x44996131, 0x9F8EC9A6, 0xD683AE2B, 0x2D60853F, 0x646DE2B2, 0xBF7A4A25, 0xF6772DA8,
+    0x4C7D01BA, 0x05706637, 0xDE67CEA0, 0x976AA92D, 0x6C898239, 0x2584E5B4, 0xFE934D23, 0xB79E2AAE,
+    0x8E4608B0, 0xC74B6F3D, 0x1C5CC7AA, 0x5551A027, 0xAEB28B33, 0xE7BFECBE, 0x3CA84429, 0x75A523A4,
+    0xCFAF0FB6, 0x86A2683B, 0x5DB5C0AC, 0x14B8A721, 0xEF5B8C35, 0xA656EBB8, 0x7D41432F, 0x344C24A2,
+    0x0EF10713, 0x47FC609E, 0x9CEBC809, 0xD5E6AF84, 0x2E058490, 0x6708E31D, 0xBC1F4B8A, 0xF5122C07,
+    0x4F180015, 0x06156798, 0xDD02CF0F, 0x940FA882, 0x6FEC8396, 0x26E1E41B, 0xFDF64C8C, 0xB4FB2B01,
+    0x8D23091F, 0xC42E6E92, 0x1F39C605, 0x5634A188, 0xADD78A9C, 0xE4DAED11, 0x3FCD4586, 0x76C0220B,
+    0xCCCA0E19, 0x85C76994, 0x5ED0C103, 0x17DDA68E, 0xEC3E8D9A, 0xA533EA17, 0x7E244280, 0x3729250D,
+    0x0B5E05E2, 0x4253626F, 0x9944CAF8, 0xD049AD75, 0x2BAA8661, 0x62A7E1EC, 0xB9B0497B, 0xF0BD2EF6,
+    0x4AB702E4, 0x03BA6569, 0xD8ADCDFE, 0x91A0AA73, 0x6A438167, 0x234EE6EA, 0xF8594E7D, 0xB15429F0,
+    0x888C0BEE, 0xC1816C63, 0x1A96C4F4, 0x539BA379, 0xA878886D, 0xE175EFE0, 0x3A624777, 0x736F20FA,
+    0xC9650CE8, 0x80686B65, 0x5B7FC3F2, 0x1272A47F, 0xE9918F6B, 0xA09CE8E6, 0x7B8B4071, 0x328627FC,
+    0x083B044D, 0x413663C0, 0x9A21CB57, 0xD32CACDA, 0x28CF87CE, 0x61C2E043, 0xBAD548D4, 0xF3D82F59,
+    0x49D2034B, 0x00DF64C6, 0xDBC8CC51, 0x92C5ABDC, 0x692680C8, 0x202BE745, 0xFB3C4FD2, 0xB231285F,
+    0x8BE90A41, 0xC2E46DCC, 0x19F3C55B, 0x50FEA2D6, 0xAB1D89C2, 0xE210EE4F, 0x390746D8, 0x700A2155,
+    0xCA000D47, 0x830D6ACA, 0x581AC25D, 0x1117A5D0, 0xEAF48EC4, 0xA3F9E949, 0x78EE41DE, 0x31E32653,
+    0x00000000, 0x1B280D78, 0x36501AF0, 0x2D781788, 0x6CA035E0, 0x77883898, 0x5AF02F10, 0x41D82268,
+    0xD9406BC0, 0xC26866B8, 0xEF107130, 0xF4387C48, 0xB5E05E20, 0xAEC85358, 0x83B044D0, 0x989849A8,
+    0xB641CA37, 0xAD69C74F, 0x8011D0C7, 0x9B39DDBF, 0xDAE1FFD7, 0xC1C9F2AF, 0xECB1E527, 0xF799E85F,
+    0x6F01A1F7, 0x7429AC8F, 0x5951BB07, 0x4279B67F, 0x03A19417, 0x1889996F, 0x35F18EE7, 0x2ED9839F,
+    0x684289D9, 0x736A84A1, 0x5E129329, 0x453A9E51, 0x04E2BC39, 0x1FCAB141, 0x32B2A6C9, 0x299AABB1,
+    0xB102E219, 0xAA2AEF61, 0x8752F8E9, 0x9C7AF591, 0xDDA2D7F9, 0xC68ADA81, 0xEBF2CD09, 0xF0DAC071,
+    0xDE0343EE, 0xC52B4E96, 0xE853591E, 0xF37B5466, 0xB2A3760E, 0xA98B7B76, 0x84F36CFE, 0x9FDB6186,
+    0x0743282E, 0x1C6B2556, 0x311332DE, 0x2A3B3FA6, 0x6BE31DCE, 0x70CB10B6, 0x5DB3073E, 0x469B0A46,
+    0xD08513B2, 0xCBAD1ECA, 0xE6D50942, 0xFDFD043A, 0xBC252652, 0xA70D2B2A, 0x8A753CA2, 0x915D31DA,
+    0x09C57872, 0x12ED750A, 0x3F956282, 0x24BD6FFA, 0x65654D92, 0x7E4D40EA, 0x53355762, 0x481D5A1A,
+    0x66C4D985, 0x7DECD4FD, 0x5094C375, 0x4BBCCE0D, 0x0A64EC65, 0x114CE11D, 0x3C34F695, 0x271CFBED,
+    0xBF84B245, 0xA4ACBF3D, 0x89D4A8B5, 0x92FCA5CD, 0xD32487A5, 0xC80C8ADD, 0xE5749D55, 0xFE5C902D,
+    0xB8C79A6B, 0xA3EF9713, 0x8E97809B, 0x95BF8DE3, 0xD467AF8B, 0xCF4FA2F3, 0xE237B57B, 0xF91FB803,
+    0x6187F1AB, 0x7AAFFCD3, 0x57D7EB5B, 0x4CFFE623, 0x0D27C44B, 0x160FC933, 0x3B77DEBB, 0x205FD3C3,
+    0x0E86505C, 0x15AE5D24, 0x38D64AAC, 0x23FE47D4, 0x622665BC, 0x790E68C4, 0x54767F4C, 0x4F5E7234,
+    0xD7C63B9C, 0xCCEE36E4, 0xE196216C, 0xFABE2C14, 0xBB660E7C, 0xA04E0304, 0x8D36148C, 0x961E19F4,
+    0xA5CB3AD3, 0xBEE337AB, 0x939B2023, 0x88B32D5B, 0xC96B0F33, 0xD243024B, 0xFF3B15C3, 0xE41318BB,
+    0x7C8B5113, 0x67A35C6B, 0x4ADB4BE3, 0x51F3469B, 0x102B64F3, 0x0B03698B, 0x267B7E03, 0x3D53737B,
+    0x138AF0E4, 0x08A2FD9C, 0x25DAEA14, 0x3EF2E76C, 0x7F2AC504, 0x6402C87C, 0x497ADFF4, 0x5252D28C,
+    0xCACA9B24, 0xD1E2965C, 0xFC9A81D4, 0xE7B28CAC, 0xA66AAEC4, 0xBD42A3BC, 0x903AB434, 0x8B12B94C,
+    0xCD89B30A, 0xD6A1BE72, 0xFBD9A9FA, 0xE0F1A482, 0xA12986EA, 0xBA018B92, 0x97799C1A, 0x8C519162,
+    0x14C9D8CA, 0x0FE1D5B2, 0x2299C23A, 0x39B1CF42, 0x7869ED2A, 0x6341E052, 0x4E39F7DA, 0x5511FAA2,
+    0x7BC8793D, 0x60E07445, 0x4D9863CD, 0x56B06EB5, 0x17684CDD, 0x0C4041A5, 0x2138562D, 0x3A105B55,
+    0xA28812FD, 0xB9A01F85, 0x94D8080D, 0x8FF00575, 0xCE28271D, 0xD5002A65, 0xF8783DED, 0xE3503095,
+    0x754E2961, 0x6E662419, 0x431E3391, 0x58363EE9, 0x19EE1C81, 0x02C611F9, 0x2FBE0671, 0x34960B09,
+    0xAC0E42A1, 0xB7264FD9, 0x9A5E5851, 0x81765529, 0xC0AE7741, 0xDB867A39, 0xF6FE6DB1, 0xEDD660C9,
+    0xC30FE356, 0xD827EE2E, 0xF55FF9A6, 0xEE77F4DE, 0xAFAFD6B6, 0xB487DBCE, 0x99FFCC46, 0x82D7C13E,
+    0x1A4F8896, 0x016785EE, 0x2C1F9266, 0x37379F1E, 0x76EFBD76, 0x6DC7B00E, 0x40BFA786, 0x5B97AAFE,
+    0x1D0CA0B8, 0x0624ADC0, 0x2B5CBA48, 0x3074B730, 0x71AC9558, 0x6A849820, 0x47FC8FA8, 0x5CD482D0,
+    0xC44CCB78, 0xDF64C600, 0xF21CD188, 0xE934DCF0, 0xA8ECFE98, 0xB3C4F3E0, 0x9EBCE468, 0x8594E910,
+    0xAB4D6A8F, 0xB06567F7, 0x9D1D707F, 0x86357D07, 0xC7ED5F6F, 0xDCC55217, 0xF1BD459F, 0xEA9548E7,
+    0x720D014F, 0x69250C37, 0x445D1BBF, 0x5F7516C7, 0x1EAD34AF, 0x058539D7, 0x28FD2E5F, 0x33D52327,
+    0x00000000, 0x4F576811, 0x9EAED022, 0xD1F9B833, 0x399CBDF3, 0x76CBD5E2, 0xA7326DD1, 0xE86505C0,
+    0x73397BE6, 0x3C6E13F7, 0xED97ABC4, 0xA2C0C3D5, 0x4AA5C615, 0x05F2AE04, 0xD40B1637, 0x9B5C7E26,
+    0xE672F7CC, 0xA9259FDD, 0x78DC27EE, 0x378B4FFF, 0xDFEE4A3F, 0x90B9222E, 0x41409A1D, 0x0E17F20C,
+    0x954B8C2A, 0xDA1CE43B, 0x0BE55C08, 0x44B23419, 0xACD731D9, 0xE38059C8, 0x3279E1FB, 0x7D2E89EA,
+    0xC824F22F, 0x87739A3E, 0x568A220D, 0x19DD4A1C, 0xF1B84FDC, 0xBEEF27CD, 0x6F169FFE, 0x2041F7EF,
+    0xBB1D89C9, 0xF44AE1D8, 0x25B359EB, 0x6AE431FA, 0x8281343A, 0xCDD65C2B, 0x1C2FE418, 0x53788C09,
+    0x2E5605E3, 0x61016DF2, 0xB0F8D5C1, 0xFFAFBDD0, 0x17CAB810, 0x589DD001, 0x89646832, 0xC6330023,
+    0x5D6F7E05, 0x12381614, 0xC3C1AE27, 0x8C96C636, 0x64F3C3F6, 0x2BA4ABE7, 0xFA5D13D4, 0xB50A7BC5,
+    0x9488F9E9, 0xDBDF91F8, 0x0A2629CB, 0x457141DA, 0xAD14441A, 0xE2432C0B, 0x33BA9438, 0x7CEDFC29,
+    0xE7B1820F, 0xA8E6EA1E, 0x791F522D, 0x36483A3C, 0xDE2D3FFC, 0x917A57ED, 0x4083EFDE, 0x0FD487CF,
+    0x72FA0E25, 0x3DAD6634, 0xEC54DE07, 0xA303B616, 0x4B66B3D6, 0x0431DBC7, 0xD5C863F4, 0x9A9F0BE5,
+    0x01C375C3, 0x4E941DD2, 0x9F6DA5E1, 0xD03ACDF0, 0x385FC830, 0x7708A021, 0xA6F11812, 0xE9A67003,
+    0x5CAC0BC6, 0x13FB63D7, 0xC202DBE4, 0x8D55B3F5, 0x6530B635, 0x2A67DE24, 0xFB9E6617, 0xB4C90E06,
+    0x2F957020, 0x60C21831, 0xB13BA002, 0xFE6CC813, 0x1609CDD3, 0x595EA5C2, 0x88A71DF1, 0xC7F075E0,
+    0xBADEFC0A, 0xF589941B, 0x24702C28, 0x6B274439, 0x834241F9, 0xCC1529E8, 0x1DEC91DB, 0x52BBF9CA,
+    0xC9E787EC, 0x86B0EFFD, 0x574957CE, 0x181E3FDF, 0xF07B3A1F, 0xBF2C520E, 0x6ED5EA3D, 0x2182822C,
+    0x2DD0EE65, 0x62878674, 0xB37E3E47, 0xFC295656, 0x144C5396, 0x5B1B3B87, 0x8AE283B4, 0xC5B5EBA5,
+    0x5EE99583, 0x11BEFD92, 0xC04745A1, 0x8F102DB0, 0x67752870, 0x28224061, 0xF9DBF852, 0xB68C9043,
+    0xCBA219A9, 0x84F571B8, 0x550CC98B, 0x1A5BA19A, 0xF23EA45A, 0xBD69CC4B, 0x6C907478, 0x23C71C69,
+    0xB89B624F, 0xF7CC0A5E, 0x2635B26D, 0x6962DA7C, 0x8107DFBC, 0xCE50B7AD, 0x1FA90F9E, 0x50FE678F,
+    0xE5F41C4A, 0xAAA3745B, 0x7B5ACC68, 0x340DA479, 0xDC68A1B9, 0x933FC9A8, 0x42C6719B, 0x0D91198A,
+    0x96CD67AC, 0xD99A0FBD, 0x0863B78E, 0x4734DF9F, 0xAF51DA5F, 0xE006B24E, 0x31FF0A7D, 0x7EA8626C,
+    0x0386EB86, 0x4CD18397, 0x9D283BA4, 0xD27F53B5, 0x3A1A5675, 0x754D3E64, 0xA4B48657, 0xEBE3EE46,
+    0x70BF9060, 0x3FE8F871, 0xEE114042, 0xA1462853, 0x49232D93, 0x06744582, 0xD78DFDB1, 0x98DA95A0,
+    0xB958178C, 0xF60F7F9D, 0x27F6C7AE, 0x68A1AFBF, 0x80C4AA7F, 0xCF93C26E, 0x1E6A7A5D, 0x513D124C,
+    0xCA616C6A, 0x8536047B, 0x54CFBC48, 0x1B98D459, 0xF3FDD199, 0xBCAAB988, 0x6D5301BB, 0x220469AA,
+    0x5F2AE040, 0x107D8851, 0xC1843062, 0x8ED35873, 0x66B65DB3, 0x29E135A2, 0xF8188D91, 0xB74FE580,
+    0x2C139BA6, 0x6344F3B7, 0xB2BD4B84, 0xFDEA2395, 0x158F2655, 0x5AD84E44, 0x8B21F677, 0xC4769E66,
+    0x717CE5A3, 0x3E2B8DB2, 0xEFD23581, 0xA0855D90, 0x48E05850, 0x07B73041, 0xD64E8872, 0x9919E063,
+    0x02459E45, 0x4D12F654, 0x9CEB4E67, 0xD3BC2676, 0x3BD923B6, 0x748E4BA7, 0xA577F394, 0xEA209B85,
+    0x970E126F, 0xD8597A7E, 0x09A0C24D, 0x46F7AA5C, 0xAE92AF9C, 0xE1C5C78D, 0x303C7FBE, 0x7F6B17AF,
+    0xE4376989, 0xAB600198, 0x7A99B9AB, 0x35CED1BA, 0xDDABD47A, 0x92FCBC6B, 0x43050458, 0x0C526C49,
+    0x00000000, 0x5BA1DCCA, 0xB743B994, 0xECE2655E, 0x6A466E9F, 0x31E7B255, 0xDD05D70B, 0x86A40BC1,
+    0xD48CDD3E, 0x8F2D01F4, 0x63CF64AA, 0x386EB860, 0xBECAB3A1, 0xE56B6F6B, 0x09890A35, 0x5228D6FF,
+    0xADD8A7CB, 0xF6797B01, 0x1A9B1E5F, 0x413AC295, 0xC79EC954, 0x9C3F159E, 0x70DD70C0, 0x2B7CAC0A,
+    0x79547AF5, 0x22F5A63F, 0xCE17C361, 0x95B61FAB, 0x1312146A, 0x48B3C8A0, 0xA451ADFE, 0xFFF07134,
+    0x5F705221, 0x04D18EEB, 0xE833EBB5, 0xB392377F, 0x35363CBE, 0x6E97E074, 0x8275852A, 0xD9D459E0,
+    0x8BFC8F1F, 0xD05D53D5, 0x3CBF368B, 0x671EEA41, 0xE1BAE180, 0xBA1B3D4A, 0x56F95814, 0x0D5884DE,
+    0xF2A8F5EA, 0xA9092920, 0x45EB4C7E, 0x1E4A90B4, 0x98EE9B75, 0xC34F47BF, 0x2FAD22E1, 0x740CFE2B,
+    0x262428D4, 0x7D85F41E, 0x91679140, 0xCAC64D8A, 0x4C62464B, 0x17C39A81, 0xFB21FFDF, 0xA0802315,
+    0xBEE0A442, 0xE5417888, 0x09A31DD6, 0x5202C11C, 0xD4A6CADD, 0x8F071617, 0x63E57349, 0x3844AF83,
+    0x6A6C797C, 0x31CDA5B6, 0xDD2FC0E8, 0x868E1C22, 0x002A17E3, 0x5B8BCB29, 0xB769AE77, 0xECC872BD,
+    0x13380389, 0x4899DF43, 0xA47BBA1D, 0xFFDA66D7, 0x797E6D16, 0x22DFB1DC, 0xCE3DD482, 0x959C0848,
+    0xC7B4DEB7, 0x9C15027D, 0x70F76723, 0x2B56BBE9, 0xADF2B028, 0xF6536CE2, 0x1AB109BC, 0x4110D576,
+    0xE190F663, 0xBA312AA9, 0x56D34FF7, 0x0D72933D, 0x8BD698FC, 0xD0774436, 0x3C952168, 0x6734FDA2,
+    0x351C2B5D, 0x6EBDF797, 0x825F92C9, 0xD9FE4E03, 0x5F5A45C2, 0x04FB9908, 0xE819FC56, 0xB3B8209C,
+    0x4C4851A8, 0x17E98D62, 0xFB0BE83C, 0xA0AA34F6, 0x260E3F37, 0x7DAFE3FD, 0x914D86A3, 0xCAEC5A69,
+    0x98C48C96, 0xC365505C, 0x2F873502, 0x7426E9C8, 0xF282E209, 0xA9233EC3, 0x45C15B9D, 0x1E608757,
+    0x79005533, 0x22A189F9, 0xCE43ECA7, 0x95E2306D, 0x13463BAC, 0x48E7E766, 0xA4058238, 0xFFA45EF2,
+    0xAD8C880D, 0xF62D54C7, 0x1ACF3199, 0x416EED53, 0xC7CAE692, 0x9C6B3A58, 0x70895F06, 0x2B2883CC,
+    0xD4D8F2F8, 0x8F792E32, 0x639B4B6C, 0x383A97A6, 0xBE9E9C67, 0xE53F40AD, 0x09DD25F3, 0x527CF939,
+    0x00542FC6, 0x5BF5F30C, 0xB7179652, 0xECB64A98, 0x6A124159, 0x31B39D93, 0xDD51F8CD, 0x86F02407,
+    0x26700712, 0x7DD1DBD8, 0x9133BE86, 0xCA92624C, 0x4C36698D, 0x1797B547, 0xFB75D019, 0xA0D40CD3,
+    0xF2FCDA2C, 0xA95D06E6, 0x45BF63B8, 0x1E1EBF72, 0x98BAB4B3, 0xC31B6879, 0x2FF90D27, 0x7458D1ED,
+    0x8BA8A0D9, 0xD0097C13, 0x3CEB194D, 0x674AC587, 0xE1EECE46, 0xBA4F128C, 0x56AD77D2, 0x0D0CAB18,
+    0x5F247DE7, 0x0485A12D, 0xE867C473, 0xB3C618B9, 0x35621378, 0x6EC3CFB2, 0x8221AAEC, 0xD9807626,
+    0xC7E0F171, 0x9C412DBB, 0x70A348E5, 0x2B02942F, 0xADA69FEE, 0xF6074324, 0x1AE5267A, 0x4144FAB0,
+    0x136C2C4F, 0x48CDF085, 0xA42F95DB, 0xFF8E4911, 0x792A42D0, 0x228B9E1A, 0xCE69FB44, 0x95C8278E,
+    0x6A3856BA, 0x31998A70, 0xDD7BEF2E, 0x86DA33E4, 0x007E3825, 0x5BDFE4EF, 0xB73D81B1, 0xEC9C5D7B,
+    0xBEB48B84, 0xE515574E, 0x09F73210, 0x5256EEDA, 0xD4F2E51B, 0x8F5339D1, 0x63B15C8F, 0x38108045,
+    0x9890A350, 0xC3317F9A, 0x2FD31AC4, 0x7472C60E, 0xF2D6CDCF, 0xA9771105, 0x4595745B, 0x1E34A891,
+    0x4C1C7E6E, 0x17BDA2A4, 0xFB5FC7FA, 0xA0FE1B30, 0x265A10F1, 0x7DFBCC3B, 0x9119A965, 0xCAB875AF,
+    0x3548049B, 0x6EE9D851, 0x820BBD0F, 0xD9AA61C5, 0x5F0E6A04, 0x04AFB6CE, 0xE84DD390, 0xB3EC0F5A,
+    0xE1C4D9A5, 0xBA65056F, 0x56876031, 0x0D26BCFB, 0x8B82B73A, 0xD0236BF0, 0x3CC10EAE, 0x6760D264,
+};
+
+/**
+ * @brief   CRC-32 tables (polynomial 0x04C11DB7, MSB-first), e.g. CRC-32/BZIP2, CRC-32/MPEG-2.
+ */
+const calc_crc_32bit_tables_t calc_crc_tables_crc32_bzip2 = {
+    .polynomial = 0x04C11DB7,
+    .reflected = false,
+    .slices = 8,
+    .table = _table_crc32_bzip2,
+    .slice_table = _slice_table_crc32_bzip2,
+    .fold_constants = {0x00000000E6228B11u, 0x000000008833794Cu, 0x000000008C3828A8u, 0x0000000064BF7A9Bu,
+                       0x0000000075BE46B7u, 0x00000000569700E5u, 0x00000000E8A45605u, 0x00000000C5B9CD4Cu},
+};
+
+// --- calc_crc_tables_crc32c ------------------------------------------------------------------------------------------
+
+static const uint32_t _table_crc32c[256] = {
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351,
+};
+
+static const uint32_t _slice_table_crc32c[1792] = {
+    0x00000000, 0x13A29877, 0x274530EE, 0x34E7A899, 0x4E8A61DC, 0x5D28F9AB, 0x69CF5132, 0x7A6DC945,
+    0x9D14C3B8, 0x8EB65BCF, 0xBA51F356, 0xA9F36B21, 0xD39EA264, 0xC03C3A13, 0xF4DB928A, 0xE7790AFD,
+    0x3FC5F181, 0x2C6769F6, 0x1880C16F, 0x0B225918, 0x714F905D, 0x62ED082A, 0x560AA0B3, 0x45A838C4,
+    0xA2D13239, 0xB173AA4E, 0x859402D7, 0x96369AA0, 0xEC5B53E5, 0xFFF9CB92, 0xCB1E630B, 0xD8BCFB7C,
+    0x7F8BE302, 0x6C297B75, 0x58CED3EC, 0x4B6C4B9B, 0x310182DE, 0x22A31AA9, 0x1644B230, 0x05E62A47,
+    0xE29F20BA, 0xF13DB8CD, 0xC5DA1054, 0xD6788823, 0xAC154166, 0xBFB7D911, 0x8B507188, 0x98F2E9FF,
+    0x404E1283, 0x53EC8AF4, 0x670B226D, 0x74A9BA1A, 0x0EC4735F, 0x1D66EB28, 0x298143B1, 0x3A23DBC6,
+    0xDD5AD13B, 0xCEF8494C, 0xFA1FE1D5, 0xE9BD79A2, 0x93D0B0E7, 0x80722890, 0xB4958009, 0xA737187E,
+    0xFF17C604, 0xECB55E73, 0xD852F6EA, 0xCBF06E9D, 0xB19DA7D8, 0xA23F3FAF, 0x96D89736, 0x857A0F41,
+    0x620305BC, 0x71A19DCB, 0x45463552, 0x56E4AD25, 0x2C896460, 0x3F2BFC17, 0x0BCC548E, 0x186ECCF9,
+    0xC0D23785, 0xD370AFF2, 0xE797076B, 0xF4359F1C, 0x8E585659, 0x9DFACE2E, 0xA91D66B7, 0xBABFFEC0,
+    0x5DC6F43D, 0x4E646C4A, 0x7A83C4D3, 0x69215CA4, 0x134C95E1, 0x00EE0D96, 0x3409A50F, 0x27AB3D78,
+    0x809C2506, 0x933EBD71, 0xA7D915E8, 0xB47B8D9F, 0xCE1644DA, 0xDDB4DCAD, 0xE9537434, 0xFAF1EC43,
+    0x1D88E6BE, 0x0E2A7EC9, 0x3ACDD650, 0x296F4E27, 0x53028762, 0x40A01F15, 0x7447B78C, 0x67E52FFB,
+    0xBF59D487, 0xACFB4CF0, 0x981CE469, 0x8BBE7C1E, 0xF1D3B55B, 0xE2712D2C, 0xD69685B5, 0xC5341DC2,
+    0x224D173F, 0x31EF8F48, 0x050827D1, 0x16AABFA6, 0x6CC776E3, 0x7F65EE94, 0x4B82460D, 0x5820DE7A,
+    0xFBC3FAF9, 0xE861628E, 0xDC86CA17, 0xCF245260, 0xB5499B25, 0xA6EB0352, 0x920CABCB, 0x81AE33BC,
+    0x66D73941, 0x7575A136, 0x419209AF, 0x523091D8, 0x285D589D, 0x3BFFC0EA, 0x0F186873, 0x1CBAF004,
+    0xC4060B78, 0xD7A4930F, 0xE3433B96, 0xF0E1A3E1, 0x8A8C6AA4, 0x992EF2D3, 0xADC95A4A, 0xBE6BC23D,
+    0x5912C8C0, 0x4AB050B7, 0x7E57F82E, 0x6DF56059, 0x1798A91C, 0x043A316B, 0x30DD99F2, 0x237F0185,
+    0x844819FB, 0x97EA818C, 0xA30D2915, 0xB0AFB162, 0xCAC27827, 0xD960E050, 0xED8748C9, 0xFE25D0BE,
+    0x195CDA43, 0x0AFE4234, 0x3E19EAAD, 0x2DBB72DA, 0x57D6BB9F, 0x447423E8, 0x70938B71, 0x63311306,
+    0xBB8DE87A, 0xA82F700D, 0x9CC8D894, 0x8F6A40E3, 0xF50789A6, 0xE6A511D1, 0xD242B948, 0xC1E0213F,
+    0x26992BC2, 0x353BB3B5, 0x01DC1B2C, 0x127E835B, 0x68134A1E, 0x7BB1D269, 0x4F567AF0, 0x5CF4E287,
+    0x04D43CFD, 0x1776A48A, 0x23910C13, 0x30339464, 0x4A5E5D21, 0x59FCC556, 0x6D1B6DCF, 0x7EB9F5B8,
+    0x99C0FF45, 0x8A626732, 0xBE85CFAB, 0xAD2757DC, 0xD74A9E99, 0xC4E806EE, 0xF00FAE77, 0xE3AD3600,
+    0x3B11CD7C, 0x28B3550B, 0x1C54FD92, 0x0FF665E5, 0x759BACA0, 0x663934D7, 0x52DE9C4E, 0x417C0439,
+    0xA6050EC4, 0xB5A796B3, 0x81403E2A, 0x92E2A65D, 0xE88F6F18, 0xFB2DF76F, 0xCFCA5FF6, 0xDC68C781,
+    0x7B5FDFFF, 0x68FD4788, 0x5C1AEF11, 0x4FB87766, 0x35D5BE23, 0x26772654, 0x12908ECD, 0x013216BA,
+    0xE64B1C47, 0xF5E98430, 0xC10E2CA9, 0xD2ACB4DE, 0xA8C17D9B, 0xBB63E5EC, 0x8F844D75, 0x9C26D502,
+    0x449A2E7E, 0x5738B609, 0x63DF1E90, 0x707D86E7, 0x0A104FA2, 0x19B2D7D5, 0x2D557F4C, 0x3EF7E73B,
+    0xD98EEDC6, 0xCA2C75B1, 0xFECBDD28, 0xED69455F, 0x97048C1A, 0x84A6146D, 0xB041BCF4, 0xA3E32483,
+    0x00000000, 0xA541927E, 0x4F6F520D, 0xEA2EC073, 0x9EDEA41A, 0x3B9F3664, 0xD1B1F617, 0x74F06469,
+    0x38513EC5, 0x9D10ACBB, 0x773E6CC8, 0xD27FFEB6, 0xA68F9ADF, 0x03CE08A1, 0xE9E0C8D2, 0x4CA15AAC,
+    0x70A27D8A, 0xD5E3EFF4, 0x3FCD2F87, 0x9A8CBDF9, 0xEE7CD990, 0x4B3D4BEE, 0xA1138B9D, 0x045219E3,
+    0x48F3434F, 0xEDB2D131, 0x079C1142, 0xA2DD833C, 0xD62DE755, 0x736C752B, 0x9942B558, 0x3C032726,
+    0xE144FB14, 0x4405696A, 0xAE2BA919, 0x0B6A3B67, 0x7F9A5F0E, 0xDADBCD70, 0x30F50D03, 0x95B49F7D,
+    0xD915C5D1, 0x7C5457AF, 0x967A97DC, 0x333B05A2, 0x47CB61CB, 0xE28AF3B5, 0x08A433C6, 0xADE5A1B8,
+    0x91E6869E, 0x34A714E0, 0xDE89D493, 0x7BC846ED, 0x0F382284, 0xAA79B0FA, 0x40577089, 0xE516E2F7,
+    0xA9B7B85B, 0x0CF62A25, 0xE6D8EA56, 0x43997828, 0x37691C41, 0x92288E3F, 0x78064E4C, 0xDD47DC32,
+    0xC76580D9, 0x622412A7, 0x880AD2D4, 0x2D4B40AA, 0x59BB24C3, 0xFCFAB6BD, 0x16D476CE, 0xB395E4B0,
+    0xFF34BE1C, 0x5A752C62, 0xB05BEC11, 0x151A7E6F, 0x61EA1A06, 0xC4AB8878, 0x2E85480B, 0x8BC4DA75,
+    0xB7C7FD53, 0x12866F2D, 0xF8A8AF5E, 0x5DE93D20, 0x29195949, 0x8C58CB37, 0x66760B44, 0xC337993A,
+    0x8F96C396, 0x2AD751E8, 0xC0F9919B, 0x65B803E5, 0x1148678C, 0xB409F5F2, 0x5E273581, 0xFB66A7FF,
+    0x26217BCD, 0x8360E9B3, 0x694E29C0, 0xCC0FBBBE, 0xB8FFDFD7, 0x1DBE4DA9, 0xF7908DDA, 0x52D11FA4,
+    0x1E704508, 0xBB31D776, 0x511F1705, 0xF45E857B, 0x80AEE112, 0x25EF736C, 0xCFC1B31F, 0x6A802161,
+    0x56830647, 0xF3C29439, 0x19EC544A, 0xBCADC634, 0xC85DA25D, 0x6D1C3023, 0x8732F050, 0x2273622E,
+    0x6ED23882, 0xCB93AAFC, 0x21BD6A8F, 0x84FCF8F1, 0xF00C9C98, 0x554D0EE6, 0xBF63CE95, 0x1A225CEB,
+    0x8B277743, 0x2E66E53D, 0xC448254E, 0x6109B730, 0x15F9D359, 0xB0B84127, 0x5A968154, 0xFFD7132A,
+    0xB3764986, 0x1637DBF8, 0xFC191B8B, 0x595889F5, 0x2DA8ED9C, 0x88E97FE2, 0x62C7BF91, 0xC7862DEF,
+    0xFB850AC9, 0x5EC498B7, 0xB4EA58C4, 0x11ABCABA, 0x655BAED3, 0xC01A3CAD, 0x2A34FCDE, 0x8F756EA0,
+    0xC3D4340C, 0x6695A672, 0x8CBB6601, 0x29FAF47F, 0x5D0A9016, 0xF84B0268, 0x1265C21B, 0xB7245065,
+    0x6A638C57, 0xCF221E29, 0x250CDE5A, 0x804D4C24, 0xF4BD284D, 0x51FCBA33, 0xBBD27A40, 0x1E93E83E,
+    0x5232B292, 0xF77320EC, 0x1D5DE09F, 0xB81C72E1, 0xCCEC1688, 0x69AD84F6, 0x83834485, 0x26C2D6FB,
+    0x1AC1F1DD, 0xBF8063A3, 0x55AEA3D0, 0xF0EF31AE, 0x841F55C7, 0x215EC7B9, 0xCB7007CA, 0x6E3195B4,
+    0x2290CF18, 0x87D15D66, 0x6DFF9D15, 0xC8BE0F6B, 0xBC4E6B02, 0x190FF97C, 0xF321390F, 0x5660AB71,
+    0x4C42F79A, 0xE90365E4, 0x032DA597, 0xA66C37E9, 0xD29C5380, 0x77DDC1FE, 0x9DF3018D, 0x38B293F3,
+    0x7413C95F, 0xD1525B21, 0x3B7C9B52, 0x9E3D092C, 0xEACD6D45, 0x4F8CFF3B, 0xA5A23F48, 0x00E3AD36,
+    0x3CE08A10, 0x99A1186E, 0x738FD81D, 0xD6CE4A63, 0xA23E2E0A, 0x077FBC74, 0xED517C07, 0x4810EE79,
+    0x04B1B4D5, 0xA1F026AB, 0x4BDEE6D8, 0xEE9F74A6, 0x9A6F10CF, 0x3F2E82B1, 0xD50042C2, 0x7041D0BC,
+    0xAD060C8E, 0x08479EF0, 0xE2695E83, 0x4728CCFD, 0x33D8A894, 0x96993AEA, 0x7CB7FA99, 0xD9F668E7,
+    0x9557324B, 0x3016A035, 0xDA386046, 0x7F79F238, 0x0B899651, 0xAEC8042F, 0x44E6C45C, 0xE1A75622,
+    0xDDA47104, 0x78E5E37A, 0x92CB2309, 0x378AB177, 0x437AD51E, 0xE63B4760, 0x0C158713, 0xA954156D,
+    0xE5F54FC1, 0x40B4DDBF, 0xAA9A1DCC, 0x0FDB8FB2, 0x7B2BEBDB, 0xDE6A79A5, 0x3444B9D6, 0x91052BA8,
+    0x00000000, 0xDD45AAB8, 0xBF672381, 0x62228939, 0x7B2231F3, 0xA6679B4B, 0xC4451272, 0x1900B8CA,
+    0xF64463E6, 0x2B01C95E, 0x49234067, 0x9466EADF, 0x8D665215, 0x5023F8AD, 0x32017194, 0xEF44DB2C,
+    0xE964B13D, 0x34211B85, 0x560392BC, 0x8B463804, 0x924680CE, 0x4F032A76, 0x2D21A34F, 0xF06409F7,
+    0x1F20D2DB, 0xC2657863, 0xA047F15A, 0x7D025BE2, 0x6402E328, 0xB9474990, 0xDB65C0A9, 0x06206A11,
+    0xD725148B, 0x0A60BE33, 0x6842370A, 0xB5079DB2, 0xAC072578, 0x71428FC0, 0x136006F9, 0xCE25AC41,
+    0x2161776D, 0xFC24DDD5, 0x9E0654EC, 0x4343FE54, 0x5A43469E, 0x8706EC26, 0xE524651F, 0x3861CFA7,
+    0x3E41A5B6, 0xE3040F0E, 0x81268637, 0x5C632C8F, 0x45639445, 0x98263EFD, 0xFA04B7C4, 0x27411D7C,
+    0xC805C650, 0x15406CE8, 0x7762E5D1, 0xAA274F69, 0xB327F7A3, 0x6E625D1B, 0x0C40D422, 0xD1057E9A,
+    0xABA65FE7, 0x76E3F55F, 0x14C17C66, 0xC984D6DE, 0xD0846E14, 0x0DC1C4AC, 0x6FE34D95, 0xB2A6E72D,
+    0x5DE23C01, 0x80A796B9, 0xE2851F80, 0x3FC0B538, 0x26C00DF2, 0xFB85A74A, 0x99A72E73, 0x44E284CB,
+    0x42C2EEDA, 0x9F874462, 0xFDA5CD5B, 0x20E067E3, 0x39E0DF29, 0xE4A57591, 0x8687FCA8, 0x5BC25610,
+    0xB4868D3C, 0x69C32784, 0x0BE1AEBD, 0xD6A40405, 0xCFA4BCCF, 0x12E11677, 0x70C39F4E, 0xAD8635F6,
+    0x7C834B6C, 0xA1C6E1D4, 0xC3E468ED, 0x1EA1C255, 0x07A17A9F, 0xDAE4D027, 0xB8C6591E, 0x6583F3A6,
+    0x8AC7288A, 0x57828232, 0x35A00B0B, 0xE8E5A1B3, 0xF1E51979, 0x2CA0B3C1, 0x4E823AF8, 0x93C79040,
+    0x95E7FA51, 0x48A250E9, 0x2A80D9D0, 0xF7C57368, 0xEEC5CBA2, 0x3380611A, 0x51A2E823, 0x8CE7429B,
+    0x63A399B7, 0xBEE6330F, 0xDCC4BA36, 0x0181108E, 0x1881A844, 0xC5C402FC, 0xA7E68BC5, 0x7AA3217D,
+    0x52A0C93F, 0x8FE56387, 0xEDC7EABE, 0x30824006, 0x2982F8CC, 0xF4C75274, 0x96E5DB4D, 0x4BA071F5,
+    0xA4E4AAD9, 0x79A10061, 0x1B838958, 0xC6C623E0, 0xDFC69B2A, 0x02833192, 0x60A1B8AB, 0xBDE41213,
+    0xBBC47802, 0x6681D2BA, 0x04A35B83, 0xD9E6F13B, 0xC0E649F1, 0x1DA3E349, 0x7F816A70, 0xA2C4C0C8,
+    0x4D801BE4, 0x90C5B15C, 0xF2E73865, 0x2FA292DD, 0x36A22A17, 0xEBE780AF, 0x89C50996, 0x5480A32E,
+    0x8585DDB4, 0x58C0770C, 0x3AE2FE35, 0xE7A7548D, 0xFEA7EC47, 0x23E246FF, 0x41C0CFC6, 0x9C85657E,
+    0x73C1BE52, 0xAE8414EA, 0xCCA69DD3, 0x11E3376B, 0x08E38FA1, 0xD5A62519, 0xB784AC20, 0x6AC10698,
+    0x6CE16C89, 0xB1A4C631, 0xD3864F08, 0x0EC3E5B0, 0x17C35D7A, 0xCA86F7C2, 0xA8A47EFB, 0x75E1D443,
+    0x9AA50F6F, 0x47E0A5D7, 0x25C22CEE, 0xF8878656, 0xE1873E9C, 0x3CC29424, 0x5EE01D1D, 0x83A5B7A5,
+    0xF90696D8, 0x24433C60, 0x4661B559, 0x9B241FE1, 0x8224A72B, 0x5F610D93, 0x3D4384AA, 0xE0062E12,
+    0x0F42F53E, 0xD2075F86, 0xB025D6BF, 0x6D607C07, 0x7460C4CD, 0xA9256E75, 0xCB07E74C, 0x16424DF4,
+    0x106227E5, 0xCD278D5D, 0xAF050464, 0x7240AEDC, 0x6B401616, 0xB605BCAE, 0xD4273597, 0x09629F2F,
+    0xE6264403, 0x3B63EEBB, 0x59416782, 0x8404CD3A, 0x9D0475F0, 0x4041DF48, 0x22635671, 0xFF26FCC9,
+    0x2E238253, 0xF36628EB, 0x9144A1D2, 0x4C010B6A, 0x5501B3A0, 0x88441918, 0xEA669021, 0x37233A99,
+    0xD867E1B5, 0x05224B0D, 0x6700C234, 0xBA45688C, 0xA345D046, 0x7E007AFE, 0x1C22F3C7, 0xC167597F,
+    0xC747336E, 0x1A0299D6, 0x782010EF, 0xA565BA57, 0xBC65029D, 0x6120A825, 0x0302211C, 0xDE478BA4,
+    0x31035088, 0xEC46FA30, 0x8E647309, 0x5321D9B1, 0x4A21617B, 0x9764CBC3, 0xF54642FA, 0x2803E842,
+    0x00000000, 0x38116FAC, 0x7022DF58, 0x4833B0F4, 0xE045BEB0, 0xD854D11C, 0x906761E8, 0xA8760E44,
+    0xC5670B91, 0xFD76643D, 0xB545D4C9, 0x8D54BB65, 0x2522B521, 0x1D33DA8D, 0x55006A79, 0x6D1105D5,
+    0x8F2261D3, 0xB7330E7F, 0xFF00BE8B, 0xC711D127, 0x6F67DF63, 0x5776B0CF, 0x1F45003B, 0x27546F97,
+    0x4A456A42, 0x725405EE, 0x3A67B51A, 0x0276DAB6, 0xAA00D4F2, 0x9211BB5E, 0xDA220BAA, 0xE2336406,
+    0x1BA8B557, 0x23B9DAFB, 0x6B8A6A0F, 0x539B05A3, 0xFBED0BE7, 0xC3FC644B, 0x8BCFD4BF, 0xB3DEBB13,
+    0xDECFBEC6, 0xE6DED16A, 0xAEED619E, 0x96FC0E32, 0x3E8A0076, 0x069B6FDA, 0x4EA8DF2E, 0x76B9B082,
+    0x948AD484, 0xAC9BBB28, 0xE4A80BDC, 0xDCB96470, 0x74CF6A34, 0x4CDE0598, 0x04EDB56C, 0x3CFCDAC0,
+    0x51EDDF15, 0x69FCB0B9, 0x21CF004D, 0x19DE6FE1, 0xB1A861A5, 0x89B90E09, 0xC18ABEFD, 0xF99BD151,
+    0x37516AAE, 0x0F400502, 0x4773B5F6, 0x7F62DA5A, 0xD714D41E, 0xEF05BBB2, 0xA7360B46, 0x9F2764EA,
+    0xF236613F, 0xCA270E93, 0x8214BE67, 0xBA05D1CB, 0x1273DF8F, 0x2A62B023, 0x625100D7, 0x5A406F7B,
+    0xB8730B7D, 0x806264D1, 0xC851D425, 0xF040BB89, 0x5836B5CD, 0x6027DA61, 0x28146A95, 0x10050539,
+    0x7D1400EC, 0x45056F40, 0x0D36DFB4, 0x3527B018, 0x9D51BE5C, 0xA540D1F0, 0xED736104, 0xD5620EA8,
+    0x2CF9DFF9, 0x14E8B055, 0x5CDB00A1, 0x64CA6F0D, 0xCCBC6149, 0xF4AD0EE5, 0xBC9EBE11, 0x848FD1BD,
+    0xE99ED468, 0xD18FBBC4, 0x99BC0B30, 0xA1AD649C, 0x09DB6AD8, 0x31CA0574, 0x79F9B580, 0x41E8DA2C,
+    0xA3DBBE2A, 0x9BCAD186, 0xD3F96172, 0xEBE80EDE, 0x439E009A, 0x7B8F6F36, 0x33BCDFC2, 0x0BADB06E,
+    0x66BCB5BB, 0x5EADDA17, 0x169E6AE3, 0x2E8F054F, 0x86F90B0B, 0xBEE864A7, 0xF6DBD453, 0xCECABBFF,
+    0x6EA2D55C, 0x56B3BAF0, 0x1E800A04, 0x269165A8, 0x8EE76BEC, 0xB6F60440, 0xFEC5B4B4, 0xC6D4DB18,
+    0xABC5DECD, 0x93D4B161, 0xDBE70195, 0xE3F66E39, 0x4B80607D, 0x73910FD1, 0x3BA2BF25, 0x03B3D089,
+    0xE180B48F, 0xD991DB23, 0x91A26BD7, 0xA9B3047B, 0x01C50A3F, 0x39D46593, 0x71E7D567, 0x49F6BACB,
+    0x24E7BF1E, 0x1CF6D0B2, 0x54C56046, 0x6CD40FEA, 0xC4A201AE, 0xFCB36E02, 0xB480DEF6, 0x8C91B15A,
+    0x750A600B, 0x4D1B0FA7, 0x0528BF53, 0x3D39D0FF, 0x954FDEBB, 0xAD5EB117, 0xE56D01E3, 0xDD7C6E4F,
+    0xB06D6B9A, 0x887C0436, 0xC04FB4C2, 0xF85EDB6E, 0x5028D52A, 0x6839BA86, 0x200A0A72, 0x181B65DE,
+    0xFA2801D8, 0xC2396E74, 0x8A0ADE80, 0xB21BB12C, 0x1A6DBF68, 0x227CD0C4, 0x6A4F6030, 0x525E0F9C,
+    0x3F4F0A49, 0x075E65E5, 0x4F6DD511, 0x777CBABD, 0xDF0AB4F9, 0xE71BDB55, 0xAF286BA1, 0x9739040D,
+    0x59F3BFF2, 0x61E2D05E, 0x29D160AA, 0x11C00F06, 0xB9B60142, 0x81A76EEE, 0xC994DE1A, 0xF185B1B6,
+    0x9C94B463, 0xA485DBCF, 0xECB66B3B, 0xD4A70497, 0x7CD10AD3, 0x44C0657F, 0x0CF3D58B, 0x34E2BA27,
+    0xD6D1DE21, 0xEEC0B18D, 0xA6F30179, 0x9EE26ED5, 0x36946091, 0x0E850F3D, 0x46B6BFC9, 0x7EA7D065,
+    0x13B6D5B0, 0x2BA7BA1C, 0x63940AE8, 0x5B856544, 0xF3F36B00, 0xCBE204AC, 0x83D1B458, 0xBBC0DBF4,
+    0x425B0AA5, 0x7A4A6509, 0x3279D5FD, 0x0A68BA51, 0xA21EB415, 0x9A0FDBB9, 0xD23C6B4D, 0xEA2D04E1,
+    0x873C0134, 0xBF2D6E98, 0xF71EDE6C, 0xCF0FB1C0, 0x6779BF84, 0x5F68D028, 0x175B60DC, 0x2F4A0F70,
+    0xCD796B76, 0xF56804DA, 0xBD5BB42E, 0x854ADB82, 0x2D3CD5C6, 0x152DBA6A, 0x5D1E0A9E, 0x650F6532,
+    0x081E60E7, 0x300F0F4B, 0x783CBFBF, 0x402DD013, 0xE85BDE57, 0xD04AB1FB, 0x9879010F, 0xA0686EA3,
+    0x00000000, 0xEF306B19, 0xDB8CA0C3, 0x34BCCBDA, 0xB2F53777, 0x5DC55C6E, 0x697997B4, 0x8649FCAD,
+    0x6006181F, 0x8F367306, 0xBB8AB8DC, 0x54BAD3C5, 0xD2F32F68, 0x3DC34471, 0x097F8FAB, 0xE64FE4B2,
+    0xC00C303E, 0x2F3C5B27, 0x1B8090FD, 0xF4B0FBE4, 0x72F90749, 0x9DC96C50, 0xA975A78A, 0x4645CC93,
+    0xA00A2821, 0x4F3A4338, 0x7B8688E2, 0x94B6E3FB, 0x12FF1F56, 0xFDCF744F, 0xC973BF95, 0x2643D48C,
+    0x85F4168D, 0x6AC47D94, 0x5E78B64E, 0xB148DD57, 0x370121FA, 0xD8314AE3, 0xEC8D8139, 0x03BDEA20,
+    0xE5F20E92, 0x0AC2658B, 0x3E7EAE51, 0xD14EC548, 0x570739E5, 0xB83752FC, 0x8C8B9926, 0x63BBF23F,
+    0x45F826B3, 0xAAC84DAA, 0x9E748670, 0x7144ED69, 0xF70D11C4, 0x183D7ADD, 0x2C81B107, 0xC3B1DA1E,
+    0x25FE3EAC, 0xCACE55B5, 0xFE729E6F, 0x1142F576, 0x970B09DB, 0x783B62C2, 0x4C87A918, 0xA3B7C201,
+    0x0E045BEB, 0xE13430F2, 0xD588FB28, 0x3AB89031, 0xBCF16C9C, 0x53C10785, 0x677DCC5F, 0x884DA746,
+    0x6E0243F4, 0x813228ED, 0xB58EE337, 0x5ABE882E, 0xDCF77483, 0x33C71F9A, 0x077BD440, 0xE84BBF59,
+    0xCE086BD5, 0x213800CC, 0x1584CB16, 0xFAB4A00F, 0x7CFD5CA2, 0x93CD37BB, 0xA771FC61, 0x48419778,
+    0xAE0E73CA, 0x413E18D3, 0x7582D309, 0x9AB2B810, 0x1CFB44BD, 0xF3CB2FA4, 0xC777E47E, 0x28478F67,
+    0x8BF04D66, 0x64C0267F, 0x507CEDA5, 0xBF4C86BC, 0x39057A11, 0xD6351108, 0xE289DAD2, 0x0DB9B1CB,
+    0xEBF65579, 0x04C63E60, 0x307AF5BA, 0xDF4A9EA3, 0x5903620E, 0xB6330917, 0x828FC2CD, 0x6DBFA9D4,
+    0x4BFC7D58, 0xA4CC1641, 0x9070DD9B, 0x7F40B682, 0xF9094A2F, 0x16392136, 0x2285EAEC, 0xCDB581F5,
+    0x2BFA6547, 0xC4CA0E5E, 0xF076C584, 0x1F46AE9D, 0x990F5230, 0x763F3929, 0x4283F2F3, 0xADB399EA,
+    0x1C08B7D6, 0xF338DCCF, 0xC7841715, 0x28B47C0C, 0xAEFD80A1, 0x41CDEBB8, 0x75712062, 0x9A414B7B,
+    0x7C0EAFC9, 0x933EC4D0, 0xA7820F0A, 0x48B26413, 0xCEFB98BE, 0x21CBF3A7, 0x1577387D, 0xFA475364,
+    0xDC0487E8, 0x3334ECF1, 0x0788272B, 0xE8B84C32, 0x6EF1B09F, 0x81C1DB86, 0xB57D105C, 0x5A4D7B45,
+    0xBC029FF7, 0x5332F4EE, 0x678E3F34, 0x88BE542D, 0x0EF7A880, 0xE1C7C399, 0xD57B0843, 0x3A4B635A,
+    0x99FCA15B, 0x76CCCA42, 0x42700198, 0xAD406A81, 0x2B09962C, 0xC439FD35, 0xF08536EF, 0x1FB55DF6,
+    0xF9FAB944, 0x16CAD25D, 0x22761987, 0xCD46729E, 0x4B0F8E33, 0xA43FE52A, 0x90832EF0, 0x7FB345E9,
+    0x59F09165, 0xB6C0FA7C, 0x827C31A6, 0x6D4C5ABF, 0xEB05A612, 0x0435CD0B, 0x308906D1, 0xDFB96DC8,
+    0x39F6897A, 0xD6C6E263, 0xE27A29B9, 0x0D4A42A0, 0x8B03BE0D, 0x6433D514, 0x508F1ECE, 0xBFBF75D7,
+    0x120CEC3D, 0xFD3C8724, 0xC9804CFE, 0x26B027E7, 0xA0F9DB4A, 0x4FC9B053, 0x7B757B89, 0x94451090,
+    0x720AF422, 0x9D3A9F3B, 0xA98654E1, 0x46B63FF8, 0xC0FFC355, 0x2FCFA84C, 0x1B736396, 0xF443088F,
+    0xD200DC03, 0x3D30B71A, 0x098C7CC0, 0xE6BC17D9, 0x60F5EB74, 0x8FC5806D, 0xBB794BB7, 0x544920AE,
+    0xB206C41C, 0x5D36AF05, 0x698A64DF, 0x86BA0FC6, 0x00F3F36B, 0xEFC39872, 0xDB7F53A8, 0x344F38B1,
+    0x97F8FAB0, 0x78C891A9, 0x4C745A73, 0xA344316A, 0x250DCDC7, 0xCA3DA6DE, 0xFE816D04, 0x11B1061D,
+    0xF7FEE2AF, 0x18CE89B6, 0x2C72426C, 0xC3422975, 0x450BD5D8, 0xAA3BBEC1, 0x9E87751B, 0x71B71E02,
+    0x57F4CA8E, 0xB8C4A197, 0x8C786A4D, 0x63480154, 0xE501FDF9, 0x0A3196E0, 0x3E8D5D3A, 0xD1BD3623,
+    0x37F2D291, 0xD8C2B988, 0xEC7E7252, 0x034E194B, 0x8507E5E6, 0x6A378EFF, 0x5E8B4525, 0xB1BB2E3C,
+    0x00000000, 0x68032CC8, 0xD0065990, 0xB8057558, 0xA5E0C5D1, 0xCDE3E919, 0x75E69C41, 0x1DE5B089,
+    0x4E2DFD53, 0x262ED19B, 0x9E2BA4C3, 0xF628880B, 0xEBCD3882, 0x83CE144A, 0x3BCB6112, 0x53C84DDA,
+    0x9C5BFAA6, 0xF458D66E, 0x4C5DA336, 0x245E8FFE, 0x39BB3F77, 0x51B813BF, 0xE9BD66E7, 0x81BE4A2F,
+    0xD27607F5, 0xBA752B3D, 0x02705E65, 0x6A7372AD, 0x7796C224, 0x1F95EEEC, 0xA7909BB4, 0xCF93B77C,
+    0x3D5B83BD, 0x5558AF75, 0xED5DDA2D, 0x855EF6E5, 0x98BB466C, 0xF0B86AA4, 0x48BD1FFC, 0x20BE3334,
+    0x73767EEE, 0x1B755226, 0xA370277E, 0xCB730BB6, 0xD696BB3F, 0xBE9597F7, 0x0690E2AF, 0x6E93CE67,
+    0xA100791B, 0xC90355D3, 0x7106208B, 0x19050C43, 0x04E0BCCA, 0x6CE39002, 0xD4E6E55A, 0xBCE5C992,
+    0xEF2D8448, 0x872EA880, 0x3F2BDDD8, 0x5728F110, 0x4ACD4199, 0x22CE6D51, 0x9ACB1809, 0xF2C834C1,
+    0x7AB7077A, 0x12B42BB2, 0xAAB15EEA, 0xC2B27222, 0xDF57C2AB, 0xB754EE63, 0x0F519B3B, 0x6752B7F3,
+    0x349AFA29, 0x5C99D6E1, 0xE49CA3B9, 0x8C9F8F71, 0x917A3FF8, 0xF9791330, 0x417C6668, 0x297F4AA0,
+    0xE6ECFDDC, 0x8EEFD114, 0x36EAA44C, 0x5EE98884, 0x430C380D, 0x2B0F14C5, 0x930A619D, 0xFB094D55,
+    0xA8C1008F, 0xC0C22C47, 0x78C7591F, 0x10C475D7, 0x0D21C55E, 0x6522E996, 0xDD279CCE, 0xB524B006,
+    0x47EC84C7, 0x2FEFA80F, 0x97EADD57, 0xFFE9F19F, 0xE20C4116, 0x8A0F6DDE, 0x320A1886, 0x5A09344E,
+    0x09C17994, 0x61C2555C, 0xD9C72004, 0xB1C40CCC, 0xAC21BC45, 0xC422908D, 0x7C27E5D5, 0x1424C91D,
+    0xDBB77E61, 0xB3B452A9, 0x0BB127F1, 0x63B20B39, 0x7E57BBB0, 0x16549778, 0xAE51E220, 0xC652CEE8,
+    0x959A8332, 0xFD99AFFA, 0x459CDAA2, 0x2D9FF66A, 0x307A46E3, 0x58796A2B, 0xE07C1F73, 0x887F33BB,
+    0xF56E0EF4, 0x9D6D223C, 0x25685764, 0x4D6B7BAC, 0x508ECB25, 0x388DE7ED, 0x808892B5, 0xE88BBE7D,
+    0xBB43F3A7, 0xD340DF6F, 0x6B45AA37, 0x034686FF, 0x1EA33676, 0x76A01ABE, 0xCEA56FE6, 0xA6A6432E,
+    0x6935F452, 0x0136D89A, 0xB933ADC2, 0xD130810A, 0xCCD53183, 0xA4D61D4B, 0x1CD36813, 0x74D044DB,
+    0x27180901, 0x4F1B25C9, 0xF71E5091, 0x9F1D7C59, 0x82F8CCD0, 0xEAFBE018, 0x52FE9540, 0x3AFDB988,
+    0xC8358D49, 0xA036A181, 0x1833D4D9, 0x7030F811, 0x6DD54898, 0x05D66450, 0xBDD31108, 0xD5D03DC0,
+    0x8618701A, 0xEE1B5CD2, 0x561E298A, 0x3E1D0542, 0x23F8B5CB, 0x4BFB9903, 0xF3FEEC5B, 0x9BFDC093,
+    0x546E77EF, 0x3C6D5B27, 0x84682E7F, 0xEC6B02B7, 0xF18EB23E, 0x998D9EF6, 0x2188EBAE, 0x498BC766,
+    0x1A438ABC, 0x7240A674, 0xCA45D32C, 0xA246FFE4, 0xBFA34F6D, 0xD7A063A5, 0x6FA516FD, 0x07A63A35,
+    0x8FD9098E, 0xE7DA2546, 0x5FDF501E, 0x37DC7CD6, 0x2A39CC5F, 0x423AE097, 0xFA3F95CF, 0x923CB907,
+    0xC1F4F4DD, 0xA9F7D815, 0x11F2AD4D, 0x79F18185, 0x6414310C, 0x0C171DC4, 0xB412689C, 0xDC114454,
+    0x1382F328, 0x7B81DFE0, 0xC384AAB8, 0xAB878670, 0xB66236F9, 0xDE611A31, 0x66646F69, 0x0E6743A1,
+    0x5DAF0E7B, 0x35AC22B3, 0x8DA957EB, 0xE5AA7B23, 0xF84FCBAA, 0x904CE762, 0x2849923A, 0x404ABEF2,
+    0xB2828A33, 0xDA81A6FB, 0x6284D3A3, 0x0A87FF6B, 0x17624FE2, 0x7F61632A, 0xC7641672, 0xAF673ABA,
+    0xFCAF7760, 0x94AC5BA8, 0x2CA92EF0, 0x44AA0238, 0x594FB2B1, 0x314C9E79, 0x8949EB21, 0xE14AC7E9,
+    0x2ED97095, 0x46DA5C5D, 0xFEDF2905, 0x96DC05CD, 0x8B39B544, 0xE33A998C, 0x5B3FECD4, 0x333CC01C,
+    0x60F48DC6, 0x08F7A10E, 0xB0F2D456, 0xD8F1F89E, 0xC5144817, 0xAD1764DF, 0x15121187, 0x7D113D4F,
+    0x00000000, 0x493C7D27, 0x9278FA4E, 0xDB448769, 0x211D826D, 0x6821FF4A, 0xB3657823, 0xFA590504,
+    0x423B04DA, 0x0B0779FD, 0xD043FE94, 0x997F83B3, 0x632686B7, 0x2A1AFB90, 0xF15E7CF9, 0xB86201DE,
+    0x847609B4, 0xCD4A7493, 0x160EF3FA, 0x5F328EDD, 0xA56B8BD9, 0xEC57F6FE, 0x37137197, 0x7E2F0CB0,
+    0xC64D0D6E, 0x8F717049, 0x5435F720, 0x1D098A07, 0xE7508F03, 0xAE6CF224, 0x7528754D, 0x3C14086A,
+    0x0D006599, 0x443C18BE, 0x9F789FD7, 0xD644E2F0, 0x2C1DE7F4, 0x65219AD3, 0xBE651DBA, 0xF759609D,
+    0x4F3B6143, 0x06071C64, 0xDD439B0D, 0x947FE62A, 0x6E26E32E, 0x271A9E09, 0xFC5E1960, 0xB5626447,
+    0x89766C2D, 0xC04A110A, 0x1B0E9663, 0x5232EB44, 0xA86BEE40, 0xE1579367, 0x3A13140E, 0x732F6929,
+    0xCB4D68F7, 0x827115D0, 0x593592B9, 0x1009EF9E, 0xEA50EA9A, 0xA36C97BD, 0x782810D4, 0x31146DF3,
+    0x1A00CB32, 0x533CB615, 0x8878317C, 0xC1444C5B, 0x3B1D495F, 0x72213478, 0xA965B311, 0xE059CE36,
+    0x583BCFE8, 0x1107B2CF, 0xCA4335A6, 0x837F4881, 0x79264D85, 0x301A30A2, 0xEB5EB7CB, 0xA262CAEC,
+    0x9E76C286, 0xD74ABFA1, 0x0C0E38C8, 0x453245EF, 0xBF6B40EB, 0xF6573DCC, 0x2D13BAA5, 0x642FC782,
+    0xDC4DC65C, 0x9571BB7B, 0x4E353C12, 0x07094135, 0xFD504431, 0xB46C3916, 0x6F28BE7F, 0x2614C358,
+    0x1700AEAB, 0x5E3CD38C, 0x857854E5, 0xCC4429C2, 0x361D2CC6, 0x7F2151E1, 0xA465D688, 0xED59ABAF,
+    0x553BAA71, 0x1C07D756, 0xC743503F, 0x8E7F2D18, 0x7426281C, 0x3D1A553B, 0xE65ED252, 0xAF62AF75,
+    0x9376A71F, 0xDA4ADA38, 0x010E5D51, 0x48322076, 0xB26B2572, 0xFB575855, 0x2013DF3C, 0x692FA21B,
+    0xD14DA3C5, 0x9871DEE2, 0x4335598B, 0x0A0924AC, 0xF05021A8, 0xB96C5C8F, 0x6228DBE6, 0x2B14A6C1,
+    0x34019664, 0x7D3DEB43, 0xA6796C2A, 0xEF45110D, 0x151C1409, 0x5C20692E, 0x8764EE47, 0xCE589360,
+    0x763A92BE, 0x3F06EF99, 0xE44268F0, 0xAD7E15D7, 0x572710D3, 0x1E1B6DF4, 0xC55FEA9D, 0x8C6397BA,
+    0xB0779FD0, 0xF94BE2F7, 0x220F659E, 0x6B3318B9, 0x916A1DBD, 0xD856609A, 0x0312E7F3, 0x4A2E9AD4,
+    0xF24C9B0A, 0xBB70E62D, 0x60346144, 0x29081C63, 0xD3511967, 0x9A6D6440, 0x4129E329, 0x08159E0E,
+    0x3901F3FD, 0x703D8EDA, 0xAB7909B3, 0xE2457494, 0x181C7190, 0x51200CB7, 0x8A648BDE, 0xC358F6F9,
+    0x7B3AF727, 0x32068A00, 0xE9420D69, 0xA07E704E, 0x5A27754A, 0x131B086D, 0xC85F8F04, 0x8163F223,
+    0xBD77FA49, 0xF44B876E, 0x2F0F0007, 0x66337D20, 0x9C6A7824, 0xD5560503, 0x0E12826A, 0x472EFF4D,
+    0xFF4CFE93, 0xB67083B4, 0x6D3404DD, 0x240879FA, 0xDE517CFE, 0x976D01D9, 0x4C2986B0, 0x0515FB97,
+    0x2E015D56, 0x673D2071, 0xBC79A718, 0xF545DA3F, 0x0F1CDF3B, 0x4620A21C, 0x9D642575, 0xD4585852,
+    0x6C3A598C, 0x250624AB, 0xFE42A3C2, 0xB77EDEE5, 0x4D27DBE1, 0x041BA6C6, 0xDF5F21AF, 0x96635C88,
+    0xAA7754E2, 0xE34B29C5, 0x380FAEAC, 0x7133D38B, 0x8B6AD68F, 0xC256ABA8, 0x19122CC1, 0x502E51E6,
+    0xE84C5038, 0xA1702D1F, 0x7A34AA76, 0x3308D751, 0xC951D255, 0x806DAF72, 0x5B29281B, 0x1215553C,
+    0x230138CF, 0x6A3D45E8, 0xB179C281, 0xF845BFA6, 0x021CBAA2, 0x4B20C785, 0x906440EC, 0xD9583DCB,
+    0x613A3C15, 0x28064132, 0xF342C65B, 0xBA7EBB7C, 0x4027BE78, 0x091BC35F, 0xD25F4436, 0x9B633911,
+    0xA777317B, 0xEE4B4C5C, 0x350FCB35, 0x7C33B612, 0x866AB316, 0xCF56CE31, 0x14124958, 0x5D2E347F,
+    0xE54C35A1, 0xAC704886, 0x7734CFEF, 0x3E08B2C8, 0xC451B7CC, 0x8D6DCAEB, 0x56294D82, 0x1F1530A5,
+};
+
+/**
+ * @brief   CRC-32 tables (polynomial 0x1EDC6F41, LSB-first), e.g. CRC-32/ISCSI (CRC-32C).
+ */
+const calc_crc_32bit_tables_t calc_crc_tables_crc32c = {
+    .polynomial = 0x1EDC6F41,
+    .reflected = true,
+    .slices = 8,
+    .table = _table_crc32c,
+    .slice_table = _slice_table_crc32c,
+    .fold_constants = {0x1C19243B00000000u, 0x75BBA45B00000000u, 0xA46EF4AA00000000u, 0x6051243F00000000u,
+                       0x33CCBBBC00000000u, 0xA2158B3400000000u, 0x3743F7BD00000000u, 0x3171D43000000000u},
+};
+
+// --- calc_crc_tables_crc64_xz ----------------------------------------------------------------------------------------
+
+static const uint64_t _table_crc64_xz[256] = {
+    0x0000000000000000, 0xB32E4CBE03A75F6F, 0xF4843657A840A05B, 0x47AA7AE9ABE7FF34, 0x7BD0C384FF8F5E33,
+    0xC8FE8F3AFC28015C, 0x8F54F5D357CFFE68, 0x3C7AB96D5468A107, 0xF7A18709FF1EBC66, 0x448FCBB7FCB9E309,
+    0x0325B15E575E1C3D, 0xB00BFDE054F94352, 0x8C71448D0091E255, 0x3F5F08330336BD3A, 0x78F572DAA8D1420E,
+    0xCBDB3E64AB761D61, 0x7D9BA13851336649, 0xCEB5ED8652943926, 0x891F976FF973C612, 0x3A31DBD1FAD4997D,
+    0x064B62BCAEBC387A, 0xB5652E02AD1B6715, 0xF2CF54EB06FC9821, 0x41E11855055BC74E, 0x8A3A2631AE2DDA2F,
+    0x39146A8FAD8A8540, 0x7EBE1066066D7A74, 0xCD905CD805CA251B, 0xF1EAE5B551A2841C, 0x42C4A90B5205DB73,
+    0x056ED3E2F9E22447, 0xB6409F5CFA457B28, 0xFB374270A266CC92, 0x48190ECEA1C193FD, 0x0FB374270A266CC9,
+    0xBC9D3899098133A6, 0x80E781F45DE992A1, 0x33C9CD4A5E4ECDCE, 0x7463B7A3F5A932FA, 0xC74DFB1DF60E6D95,
+    0x0C96C5795D7870F4, 0xBFB889C75EDF2F9B, 0xF812F32EF538D0AF, 0x4B3CBF90F69F8FC0, 0x774606FDA2F72EC7,
+    0xC4684A43A15071A8, 0x83C230AA0AB78E9C, 0x30EC7C140910D1F3, 0x86ACE348F355AADB, 0x3582AFF6F0F2F5B4,
+    0x7228D51F5B150A80, 0xC10699A158B255EF, 0xFD7C20CC0CDAF4E8, 0x4E526C720F7DAB87, 0x09F8169BA49A54B3,
+    0xBAD65A25A73D0BDC, 0x710D64410C4B16BD, 0xC22328FF0FEC49D2, 0x85895216A40BB6E6, 0x36A71EA8A7ACE989,
+    0x0ADDA7C5F3C4488E, 0xB9F3EB7BF06317E1, 0xFE5991925B84E8D5, 0x4D77DD2C5823B7BA, 0x64B62BCAEBC387A1,
+    0xD7986774E864D8CE, 0x90321D9D438327FA, 0x231C512340247895, 0x1F66E84E144CD992, 0xAC48A4F017EB86FD,
+    0xEBE2DE19BC0C79C9, 0x58CC92A7BFAB26A6, 0x9317ACC314DD3BC7, 0x2039E07D177A64A8, 0x67939A94BC9D9B9C,
+    0xD4BDD62ABF3AC4F3, 0xE8C76F47EB5265F4, 0x5BE923F9E8F53A9B, 0x1C4359104312C5AF, 0xAF6D15AE40B59AC0,
+    0x192D8AF2BAF0E1E8, 0xAA03C64CB957BE87, 0xEDA9BCA512B041B3, 0x5E87F01B11171EDC, 0x62FD4976457FBFDB,
+    0xD1D305C846D8E0B4, 0x96797F21ED3F1F80, 0x2557339FEE9840EF, 0xEE8C0DFB45EE5D8E, 0x5DA24145464902E1,
+    0x1A083BACEDAEFDD5, 0xA9267712EE09A2BA, 0x955CCE7FBA6103BD, 0x267282C1B9C65CD2, 0x61D8F8281221A3E6,
+    0xD2F6B4961186FC89, 0x9F8169BA49A54B33, 0x2CAF25044A02145C, 0x6B055FEDE1E5EB68, 0xD82B1353E242B407,
+    0xE451AA3EB62A1500, 0x577FE680B58D4A6F, 0x10D59C691E6AB55B, 0xA3FBD0D71DCDEA34, 0x6820EEB3B6BBF755,
+    0xDB0EA20DB51CA83A, 0x9CA4D8E41EFB570E, 0x2F8A945A1D5C0861, 0x13F02D374934A966, 0xA0DE61894A93F609,
+    0xE7741B60E174093D, 0x545A57DEE2D35652, 0xE21AC88218962D7A, 0x5134843C1B317215, 0x169EFED5B0D68D21,
+    0xA5B0B26BB371D24E, 0x99CA0B06E7197349, 0x2AE447B8E4BE2C26, 0x6D4E3D514F59D312, 0xDE6071EF4CFE8C7D,
+    0x15BB4F8BE788911C, 0xA6950335E42FCE73, 0xE13F79DC4FC83147, 0x521135624C6F6E28, 0x6E6B8C0F1807CF2F,
+    0xDD45C0B11BA09040, 0x9AEFBA58B0476F74, 0x29C1F6E6B3E0301B, 0xC96C5795D7870F42, 0x7A421B2BD420502D,
+    0x3DE861C27FC7AF19, 0x8EC62D7C7C60F076, 0xB2BC941128085171, 0x0192D8AF2BAF0E1E, 0x4638A2468048F12A,
+    0xF516EEF883EFAE45, 0x3ECDD09C2899B324, 0x8DE39C222B3EEC4B, 0xCA49E6CB80D9137F, 0x7967AA75837E4C10,
+    0x451D1318D716ED17, 0xF6335FA6D4B1B278, 0xB199254F7F564D4C, 0x02B769F17CF11223, 0xB4F7F6AD86B4690B,
+    0x07D9BA1385133664, 0x4073C0FA2EF4C950, 0xF35D8C442D53963F, 0xCF273529793B3738, 0x7C0979977A9C6857,
+    0x3BA3037ED17B9763, 0x888D4FC0D2DCC80C, 0x435671A479AAD56D, 0xF0783D1A7A0D8A02, 0xB7D247F3D1EA7536,
+    0x04FC0B4DD24D2A59, 0x3886B22086258B5E, 0x8BA8FE9E8582D431, 0xCC0284772E652B05, 0x7F2CC8C92DC2746A,
+    0x325B15E575E1C3D0, 0x8175595B76469CBF, 0xC6DF23B2DDA1638B, 0x75F16F0CDE063CE4, 0x498BD6618A6E9DE3,
+    0xFAA59ADF89C9C28C, 0xBD0FE036222E3DB8, 0x0E21AC88218962D7, 0xC5FA92EC8AFF7FB6, 0x76D4DE52895820D9,
+    0x317EA4BB22BFDFED, 0x8250E80521188082, 0xBE2A516875702185, 0x0D041DD676D77EEA, 0x4AAE673FDD3081DE,
+    0xF9802B81DE97DEB1, 0x4FC0B4DD24D2A599, 0xFCEEF8632775FAF6, 0xBB44828A8C9205C2, 0x086ACE348F355AAD,
+    0x34107759DB5DFBAA, 0x873E3BE7D8FAA4C5, 0xC094410E731D5BF1, 0x73BA0DB070BA049E, 0xB86133D4DBCC19FF,
+    0x0B4F7F6AD86B4690, 0x4CE50583738CB9A4, 0xFFCB493D702BE6CB, 0xC3B1F050244347CC, 0x709FBCEE27E418A3,
+    0x3735C6078C03E797, 0x841B8AB98FA4B8F8, 0xADDA7C5F3C4488E3, 0x1EF430E13FE3D78C, 0x595E4A08940428B8,
+    0xEA7006B697A377D7, 0xD60ABFDBC3CBD6D0, 0x6524F365C06C89BF, 0x228E898C6B8B768B, 0x91A0C532682C29E4,
+    0x5A7BFB56C35A3485, 0xE955B7E8C0FD6BEA, 0xAEFFCD016B1A94DE, 0x1DD181BF68BDCBB1, 0x21AB38D23CD56AB6,
+    0x9285746C3F7235D9, 0xD52F0E859495CAED, 0x6601423B97329582, 0xD041DD676D77EEAA, 0x636F91D96ED0B1C5,
+    0x24C5EB30C5374EF1, 0x97EBA78EC690119E, 0xAB911EE392F8B099, 0x18BF525D915FEFF6, 0x5F1528B43AB810C2,
+    0xEC3B640A391F4FAD, 0x27E05A6E926952CC, 0x94CE16D091CE0DA3, 0xD3646C393A29F297, 0x604A2087398EADF8,
+    0x5C3099EA6DE60CFF, 0xEF1ED5546E415390, 0xA8B4AFBDC5A6ACA4, 0x1B9AE303C601F3CB, 0x56ED3E2F9E224471,
+    0xE5C372919D851B1E, 0xA26908783662E42A, 0x114744C635C5BB45, 0x2D3DFDAB61AD1A42, 0x9E13B115620A452D,
+    0xD9B9CBFCC9EDBA19, 0x6A978742CA4AE576, 0xA14CB926613CF817, 0x1262F598629BA778, 0x55C88F71C97C584C,
+    0xE6E6C3CFCADB0723, 0xDA9C7AA29EB3A624, 0x69B2361C9D14F94B, 0x2E184CF536F3067F, 0x9D36004B35545910,
+    0x2B769F17CF112238, 0x9858D3A9CCB67D57, 0xDFF2A94067518263, 0x6CDCE5FE64F6DD0C, 0x50A65C93309E7C0B,
+    0xE388102D33392364, 0xA4226AC498DEDC50, 0x170C267A9B79833F, 0xDCD7181E300F9E5E, 0x6FF954A033A8C131,
+    0x28532E49984F3E05, 0x9B7D62F79BE8616A, 0xA707DB9ACF80C06D, 0x14299724CC279F02, 0x5383EDCD67C06036,
+    0xE0ADA17364673F59,
+};
+
+static const uint64_t _slice_table_crc64_xz[1792] = {
+    0x0000000000000000, 0x54E979925CD0F10D, 0xA9D2F324B9A1E21A, 0xFD3B8AB6E5711317, 0xC17D4962DC4DDAB1,
+    0x959430F0809D2BBC, 0x68AFBA4665EC38AB, 0x3C46C3D4393CC9A6, 0x10223DEE1795ABE7, 0x44CB447C4B455AEA,
+    0xB9F0CECAAE3449FD, 0xED19B758F2E4B8F0, 0xD15F748CCBD87156, 0x85B60D1E9708805B, 0x788D87A87279934C,
+    0x2C64FE3A2EA96241, 0x20447BDC2F2B57CE, 0x74AD024E73FBA6C3, 0x899688F8968AB5D4, 0xDD7FF16ACA5A44D9,
+    0xE13932BEF3668D7F, 0xB5D04B2CAFB67C72, 0x48EBC19A4AC76F65, 0x1C02B80816179E68, 0x3066463238BEFC29,
+    0x648F3FA0646E0D24, 0x99B4B516811F1E33, 0xCD5DCC84DDCFEF3E, 0xF11B0F50E4F32698, 0xA5F276C2B823D795,
+    0x58C9FC745D52C482, 0x0C2085E60182358F, 0x4088F7B85E56AF9C, 0x14618E2A02865E91, 0xE95A049CE7F74D86,
+    0xBDB37D0EBB27BC8B, 0x81F5BEDA821B752D, 0xD51CC748DECB8420, 0x28274DFE3BBA9737, 0x7CCE346C676A663A,
+    0x50AACA5649C3047B, 0x0443B3C41513F576, 0xF9783972F062E661, 0xAD9140E0ACB2176C, 0x91D78334958EDECA,
+    0xC53EFAA6C95E2FC7, 0x380570102C2F3CD0, 0x6CEC098270FFCDDD, 0x60CC8C64717DF852, 0x3425F5F62DAD095F,
+    0xC91E7F40C8DC1A48, 0x9DF706D2940CEB45, 0xA1B1C506AD3022E3, 0xF558BC94F1E0D3EE, 0x086336221491C0F9,
+    0x5C8A4FB0484131F4, 0x70EEB18A66E853B5, 0x2407C8183A38A2B8, 0xD93C42AEDF49B1AF, 0x8DD53B3C839940A2,
+    0xB193F8E8BAA58904, 0xE57A817AE6757809, 0x18410BCC03046B1E, 0x4CA8725E5FD49A13, 0x8111EF70BCAD5F38,
+    0xD5F896E2E07DAE35, 0x28C31C54050CBD22, 0x7C2A65C659DC4C2F, 0x406CA61260E08589, 0x1485DF803C307484,
+    0xE9BE5536D9416793, 0xBD572CA48591969E, 0x9133D29EAB38F4DF, 0xC5DAAB0CF7E805D2, 0x38E121BA129916C5,
+    0x6C0858284E49E7C8, 0x504E9BFC77752E6E, 0x04A7E26E2BA5DF63, 0xF99C68D8CED4CC74, 0xAD75114A92043D79,
+    0xA15594AC938608F6, 0xF5BCED3ECF56F9FB, 0x088767882A27EAEC, 0x5C6E1E1A76F71BE1, 0x6028DDCE4FCBD247,
+    0x34C1A45C131B234A, 0xC9FA2EEAF66A305D, 0x9D135778AABAC150, 0xB177A9428413A311, 0xE59ED0D0D8C3521C,
+    0x18A55A663DB2410B, 0x4C4C23F46162B006, 0x700AE020585E79A0, 0x24E399B2048E88AD, 0xD9D81304E1FF9BBA,
+    0x8D316A96BD2F6AB7, 0xC19918C8E2FBF0A4, 0x9570615ABE2B01A9, 0x684BEBEC5B5A12BE, 0x3CA2927E078AE3B3,
+    0x00E451AA3EB62A15, 0x540D28386266DB18, 0xA936A28E8717C80F, 0xFDDFDB1CDBC73902, 0xD1BB2526F56E5B43,
+    0x85525CB4A9BEAA4E, 0x7869D6024CCFB959, 0x2C80AF90101F4854, 0x10C66C44292381F2, 0x442F15D675F370FF,
+    0xB9149F60908263E8, 0xEDFDE6F2CC5292E5, 0xE1DD6314CDD0A76A, 0xB5341A8691005667, 0x480F903074714570,
+    0x1CE6E9A228A1B47D, 0x20A02A76119D7DDB, 0x744953E44D4D8CD6, 0x8972D952A83C9FC1, 0xDD9BA0C0F4EC6ECC,
+    0xF1FF5EFADA450C8D, 0xA51627688695FD80, 0x582DADDE63E4EE97, 0x0CC4D44C3F341F9A, 0x308217980608D63C,
+    0x646B6E0A5AD82731, 0x9950E4BCBFA93426, 0xCDB99D2EE379C52B, 0x90FB71CAD654A0F5, 0xC41208588A8451F8,
+    0x392982EE6FF542EF, 0x6DC0FB7C3325B3E2, 0x518638A80A197A44, 0x056F413A56C98B49, 0xF854CB8CB3B8985E,
+    0xACBDB21EEF686953, 0x80D94C24C1C10B12, 0xD43035B69D11FA1F, 0x290BBF007860E908, 0x7DE2C69224B01805,
+    0x41A405461D8CD1A3, 0x154D7CD4415C20AE, 0xE876F662A42D33B9, 0xBC9F8FF0F8FDC2B4, 0xB0BF0A16F97FF73B,
+    0xE4567384A5AF0636, 0x196DF93240DE1521, 0x4D8480A01C0EE42C, 0x71C2437425322D8A, 0x252B3AE679E2DC87,
+    0xD810B0509C93CF90, 0x8CF9C9C2C0433E9D, 0xA09D37F8EEEA5CDC, 0xF4744E6AB23AADD1, 0x094FC4DC574BBEC6,
+    0x5DA6BD4E0B9B4FCB, 0x61E07E9A32A7866D, 0x350907086E777760, 0xC8328DBE8B066477, 0x9CDBF42CD7D6957A,
+    0xD073867288020F69, 0x849AFFE0D4D2FE64, 0x79A1755631A3ED73, 0x2D480CC46D731C7E, 0x110ECF10544FD5D8,
+    0x45E7B682089F24D5, 0xB8DC3C34EDEE37C2, 0xEC3545A6B13EC6CF, 0xC051BB9C9F97A48E, 0x94B8C20EC3475583,
+    0x698348B826364694, 0x3D6A312A7AE6B799, 0x012CF2FE43DA7E3F, 0x55C58B6C1F0A8F32, 0xA8FE01DAFA7B9C25,
+    0xFC177848A6AB6D28, 0xF037FDAEA72958A7, 0xA4DE843CFBF9A9AA, 0x59E50E8A1E88BABD, 0x0D0C771842584BB0,
+    0x314AB4CC7B648216, 0x65A3CD5E27B4731B, 0x989847E8C2C5600C, 0xCC713E7A9E159101, 0xE015C040B0BCF340,
+    0xB4FCB9D2EC6C024D, 0x49C73364091D115A, 0x1D2E4AF655CDE057, 0x216889226CF129F1, 0x7581F0B03021D8FC,
+    0x88BA7A06D550CBEB, 0xDC53039489803AE6, 0x11EA9EBA6AF9FFCD, 0x4503E72836290EC0, 0xB8386D9ED3581DD7,
+    0xECD1140C8F88ECDA, 0xD097D7D8B6B4257C, 0x847EAE4AEA64D471, 0x794524FC0F15C766, 0x2DAC5D6E53C5366B,
+    0x01C8A3547D6C542A, 0x5521DAC621BCA527, 0xA81A5070C4CDB630, 0xFCF329E2981D473D, 0xC0B5EA36A1218E9B,
+    0x945C93A4FDF17F96, 0x6967191218806C81, 0x3D8E608044509D8C, 0x31AEE56645D2A803, 0x65479CF41902590E,
+    0x987C1642FC734A19, 0xCC956FD0A0A3BB14, 0xF0D3AC04999F72B2, 0xA43AD596C54F83BF, 0x59015F20203E90A8,
+    0x0DE826B27CEE61A5, 0x218CD888524703E4, 0x7565A11A0E97F2E9, 0x885E2BACEBE6E1FE, 0xDCB7523EB73610F3,
+    0xE0F191EA8E0AD955, 0xB418E878D2DA2858, 0x492362CE37AB3B4F, 0x1DCA1B5C6B7BCA42, 0x5162690234AF5051,
+    0x058B1090687FA15C, 0xF8B09A268D0EB24B, 0xAC59E3B4D1DE4346, 0x901F2060E8E28AE0, 0xC4F659F2B4327BED,
+    0x39CDD344514368FA, 0x6D24AAD60D9399F7, 0x414054EC233AFBB6, 0x15A92D7E7FEA0ABB, 0xE892A7C89A9B19AC,
+    0xBC7BDE5AC64BE8A1, 0x803D1D8EFF772107, 0xD4D4641CA3A7D00A, 0x29EFEEAA46D6C31D, 0x7D0697381A063210,
+    0x712612DE1B84079F, 0x25CF6B4C4754F692, 0xD8F4E1FAA225E585, 0x8C1D9868FEF51488, 0xB05B5BBCC7C9DD2E,
+    0xE4B2222E9B192C23, 0x1989A8987E683F34, 0x4D60D10A22B8CE39, 0x61042F300C11AC78, 0x35ED56A250C15D75,
+    0xC8D6DC14B5B04E62, 0x9C3FA586E960BF6F, 0xA0796652D05C76C9, 0xF4901FC08C8C87C4, 0x09AB957669FD94D3,
+    0x5D42ECE4352D65DE, 0x0000000000000000, 0x3F0BE14A916A6DCB, 0x7E17C29522D4DB96, 0x411C23DFB3BEB65D,
+    0xFC2F852A45A9B72C, 0xC3246460D4C3DAE7, 0x823847BF677D6CBA, 0xBD33A6F5F6170171, 0x6A87A57F245D70DD,
+    0x558C4435B5371D16, 0x149067EA0689AB4B, 0x2B9B86A097E3C680, 0x96A8205561F4C7F1, 0xA9A3C11FF09EAA3A,
+    0xE8BFE2C043201C67, 0xD7B4038AD24A71AC, 0xD50F4AFE48BAE1BA, 0xEA04ABB4D9D08C71, 0xAB18886B6A6E3A2C,
+    0x94136921FB0457E7, 0x2920CFD40D135696, 0x162B2E9E9C793B5D, 0x57370D412FC78D00, 0x683CEC0BBEADE0CB,
+    0xBF88EF816CE79167, 0x80830ECBFD8DFCAC, 0xC19F2D144E334AF1, 0xFE94CC5EDF59273A, 0x43A76AAB294E264B,
+    0x7CAC8BE1B8244B80, 0x3DB0A83E0B9AFDDD, 0x02BB49749AF09016, 0x38C63AD73E7BDDF1, 0x07CDDB9DAF11B03A,
+    0x46D1F8421CAF0667, 0x79DA19088DC56BAC, 0xC4E9BFFD7BD26ADD, 0xFBE25EB7EAB80716, 0xBAFE7D685906B14B,
+    0x85F59C22C86CDC80, 0x52419FA81A26AD2C, 0x6D4A7EE28B4CC0E7, 0x2C565D3D38F276BA, 0x135DBC77A9981B71,
+    0xAE6E1A825F8F1A00, 0x9165FBC8CEE577CB, 0xD079D8177D5BC196, 0xEF72395DEC31AC5D, 0xEDC9702976C13C4B,
+    0xD2C29163E7AB5180, 0x93DEB2BC5415E7DD, 0xACD553F6C57F8A16, 0x11E6F50333688B67, 0x2EED1449A202E6AC,
+    0x6FF1379611BC50F1, 0x50FAD6DC80D63D3A, 0x874ED556529C4C96, 0xB845341CC3F6215D, 0xF95917C370489700,
+    0xC652F689E122FACB, 0x7B61507C1735FBBA, 0x446AB136865F9671, 0x057692E935E1202C, 0x3A7D73A3A48B4DE7,
+    0x718C75AE7CF7BBE2, 0x4E8794E4ED9DD629, 0x0F9BB73B5E236074, 0x30905671CF490DBF, 0x8DA3F084395E0CCE,
+    0xB2A811CEA8346105, 0xF3B432111B8AD758, 0xCCBFD35B8AE0BA93, 0x1B0BD0D158AACB3F, 0x2400319BC9C0A6F4,
+    0x651C12447A7E10A9, 0x5A17F30EEB147D62, 0xE72455FB1D037C13, 0xD82FB4B18C6911D8, 0x9933976E3FD7A785,
+    0xA6387624AEBDCA4E, 0xA4833F50344D5A58, 0x9B88DE1AA5273793, 0xDA94FDC5169981CE, 0xE59F1C8F87F3EC05,
+    0x58ACBA7A71E4ED74, 0x67A75B30E08E80BF, 0x26BB78EF533036E2, 0x19B099A5C25A5B29, 0xCE049A2F10102A85,
+    0xF10F7B65817A474E, 0xB01358BA32C4F113, 0x8F18B9F0A3AE9CD8, 0x322B1F0555B99DA9, 0x0D20FE4FC4D3F062,
+    0x4C3CDD90776D463F, 0x73373CDAE6072BF4, 0x494A4F79428C6613, 0x7641AE33D3E60BD8, 0x375D8DEC6058BD85,
+    0x08566CA6F132D04E, 0xB565CA530725D13F, 0x8A6E2B19964FBCF4, 0xCB7208C625F10AA9, 0xF479E98CB49B6762,
+    0x23CDEA0666D116CE, 0x1CC60B4CF7BB7B05, 0x5DDA28934405CD58, 0x62D1C9D9D56FA093, 0xDFE26F2C2378A1E2,
+    0xE0E98E66B212CC29, 0xA1F5ADB901AC7A74, 0x9EFE4CF390C617BF, 0x9C4505870A3687A9, 0xA34EE4CD9B5CEA62,
+    0xE252C71228E25C3F, 0xDD592658B98831F4, 0x606A80AD4F9F3085, 0x5F6161E7DEF55D4E, 0x1E7D42386D4BEB13,
+    0x2176A372FC2186D8, 0xF6C2A0F82E6BF774, 0xC9C941B2BF019ABF, 0x88D5626D0CBF2CE2, 0xB7DE83279DD54129,
+    0x0AED25D26BC24058, 0x35E6C498FAA82D93, 0x74FAE74749169BCE, 0x4BF1060DD87CF605, 0xE318EB5CF9EF77C4,
+    0xDC130A1668851A0F, 0x9D0F29C9DB3BAC52, 0xA204C8834A51C199, 0x1F376E76BC46C0E8, 0x203C8F3C2D2CAD23,
+    0x6120ACE39E921B7E, 0x5E2B4DA90FF876B5, 0x899F4E23DDB20719, 0xB694AF694CD86AD2, 0xF7888CB6FF66DC8F,
+    0xC8836DFC6E0CB144, 0x75B0CB09981BB035, 0x4ABB2A430971DDFE, 0x0BA7099CBACF6BA3, 0x34ACE8D62BA50668,
+    0x3617A1A2B155967E, 0x091C40E8203FFBB5, 0x4800633793814DE8, 0x770B827D02EB2023, 0xCA382488F4FC2152,
+    0xF533C5C265964C99, 0xB42FE61DD628FAC4, 0x8B2407574742970F, 0x5C9004DD9508E6A3, 0x639BE59704628B68,
+    0x2287C648B7DC3D35, 0x1D8C270226B650FE, 0xA0BF81F7D0A1518F, 0x9FB460BD41CB3C44, 0xDEA84362F2758A19,
+    0xE1A3A228631FE7D2, 0xDBDED18BC794AA35, 0xE4D530C156FEC7FE, 0xA5C9131EE54071A3, 0x9AC2F254742A1C68,
+    0x27F154A1823D1D19, 0x18FAB5EB135770D2, 0x59E69634A0E9C68F, 0x66ED777E3183AB44, 0xB15974F4E3C9DAE8,
+    0x8E5295BE72A3B723, 0xCF4EB661C11D017E, 0xF045572B50776CB5, 0x4D76F1DEA6606DC4, 0x727D1094370A000F,
+    0x3361334B84B4B652, 0x0C6AD20115DEDB99, 0x0ED19B758F2E4B8F, 0x31DA7A3F1E442644, 0x70C659E0ADFA9019,
+    0x4FCDB8AA3C90FDD2, 0xF2FE1E5FCA87FCA3, 0xCDF5FF155BED9168, 0x8CE9DCCAE8532735, 0xB3E23D8079394AFE,
+    0x64563E0AAB733B52, 0x5B5DDF403A195699, 0x1A41FC9F89A7E0C4, 0x254A1DD518CD8D0F, 0x9879BB20EEDA8C7E,
+    0xA7725A6A7FB0E1B5, 0xE66E79B5CC0E57E8, 0xD96598FF5D643A23, 0x92949EF28518CC26, 0xAD9F7FB81472A1ED,
+    0xEC835C67A7CC17B0, 0xD388BD2D36A67A7B, 0x6EBB1BD8C0B17B0A, 0x51B0FA9251DB16C1, 0x10ACD94DE265A09C,
+    0x2FA73807730FCD57, 0xF8133B8DA145BCFB, 0xC718DAC7302FD130, 0x8604F9188391676D, 0xB90F185212FB0AA6,
+    0x043CBEA7E4EC0BD7, 0x3B375FED7586661C, 0x7A2B7C32C638D041, 0x45209D785752BD8A, 0x479BD40CCDA22D9C,
+    0x789035465CC84057, 0x398C1699EF76F60A, 0x0687F7D37E1C9BC1, 0xBBB45126880B9AB0, 0x84BFB06C1961F77B,
+    0xC5A393B3AADF4126, 0xFAA872F93BB52CED, 0x2D1C7173E9FF5D41, 0x121790397895308A, 0x530BB3E6CB2B86D7,
+    0x6C0052AC5A41EB1C, 0xD133F459AC56EA6D, 0xEE3815133D3C87A6, 0xAF2436CC8E8231FB, 0x902FD7861FE85C30,
+    0xAA52A425BB6311D7, 0x9559456F2A097C1C, 0xD44566B099B7CA41, 0xEB4E87FA08DDA78A, 0x567D210FFECAA6FB,
+    0x6976C0456FA0CB30, 0x286AE39ADC1E7D6D, 0x176102D04D7410A6, 0xC0D5015A9F3E610A, 0xFFDEE0100E540CC1,
+    0xBEC2C3CFBDEABA9C, 0x81C922852C80D757, 0x3CFA8470DA97D626, 0x03F1653A4BFDBBED, 0x42ED46E5F8430DB0,
+    0x7DE6A7AF6929607B, 0x7F5DEEDBF3D9F06D, 0x40560F9162B39DA6, 0x014A2C4ED10D2BFB, 0x3E41CD0440674630,
+    0x83726BF1B6704741, 0xBC798ABB271A2A8A, 0xFD65A96494A49CD7, 0xC26E482E05CEF11C, 0x15DA4BA4D78480B0,
+    0x2AD1AAEE46EEED7B, 0x6BCD8931F5505B26, 0x54C6687B643A36ED, 0xE9F5CE8E922D379C, 0xD6FE2FC403475A57,
+    0x97E20C1BB0F9EC0A, 0xA8E9ED51219381C1, 0x0000000000000000, 0x1DEE8A5E222CA1DC, 0x3BDD14BC445943B8,
+    0x26339EE26675E264, 0x77BA297888B28770, 0x6A54A326AA9E26AC, 0x4C673DC4CCEBC4C8, 0x5189B79AEEC76514,
+    0xEF7452F111650EE0, 0xF29AD8AF3349AF3C, 0xD4A9464D553C4D58, 0xC947CC137710EC84, 0x98CE7B8999D78990,
+    0x8520F1D7BBFB284C, 0xA3136F35DD8ECA28, 0xBEFDE56BFFA26BF4, 0x4C300AC98DC40345, 0x51DE8097AFE8A299,
+    0x77ED1E75C99D40FD, 0x6A03942BEBB1E121, 0x3B8A23B105768435, 0x2664A9EF275A25E9, 0x0057370D412FC78D,
+    0x1DB9BD5363036651, 0xA34458389CA10DA5, 0xBEAAD266BE8DAC79, 0x98994C84D8F84E1D, 0x8577C6DAFAD4EFC1,
+    0xD4FE714014138AD5, 0xC910FB1E363F2B09, 0xEF2365FC504AC96D, 0xF2CDEFA2726668B1, 0x986015931B88068A,
+    0x858E9FCD39A4A756, 0xA3BD012F5FD14532, 0xBE538B717DFDE4EE, 0xEFDA3CEB933A81FA, 0xF234B6B5B1162026,
+    0xD4072857D763C242, 0xC9E9A209F54F639E, 0x771447620AED086A, 0x6AFACD3C28C1A9B6, 0x4CC953DE4EB44BD2,
+    0x5127D9806C98EA0E, 0x00AE6E1A825F8F1A, 0x1D40E444A0732EC6, 0x3B737AA6C606CCA2, 0x269DF0F8E42A6D7E,
+    0xD4501F5A964C05CF, 0xC9BE9504B460A413, 0xEF8D0BE6D2154677, 0xF26381B8F039E7AB, 0xA3EA36221EFE82BF,
+    0xBE04BC7C3CD22363, 0x9837229E5AA7C107, 0x85D9A8C0788B60DB, 0x3B244DAB87290B2F, 0x26CAC7F5A505AAF3,
+    0x00F95917C3704897, 0x1D17D349E15CE94B, 0x4C9E64D30F9B8C5F, 0x5170EE8D2DB72D83, 0x7743706F4BC2CFE7,
+    0x6AADFA3169EE6E3B, 0xA218840D981E1391, 0xBFF60E53BA32B24D, 0x99C590B1DC475029, 0x842B1AEFFE6BF1F5,
+    0xD5A2AD7510AC94E1, 0xC84C272B3280353D, 0xEE7FB9C954F5D759, 0xF391339776D97685, 0x4D6CD6FC897B1D71,
+    0x50825CA2AB57BCAD, 0x76B1C240CD225EC9, 0x6B5F481EEF0EFF15, 0x3AD6FF8401C99A01, 0x273875DA23E53BDD,
+    0x010BEB384590D9B9, 0x1CE5616667BC7865, 0xEE288EC415DA10D4, 0xF3C6049A37F6B108, 0xD5F59A785183536C,
+    0xC81B102673AFF2B0, 0x9992A7BC9D6897A4, 0x847C2DE2BF443678, 0xA24FB300D931D41C, 0xBFA1395EFB1D75C0,
+    0x015CDC3504BF1E34, 0x1CB2566B2693BFE8, 0x3A81C88940E65D8C, 0x276F42D762CAFC50, 0x76E6F54D8C0D9944,
+    0x6B087F13AE213898, 0x4D3BE1F1C854DAFC, 0x50D56BAFEA787B20, 0x3A78919E8396151B, 0x27961BC0A1BAB4C7,
+    0x01A58522C7CF56A3, 0x1C4B0F7CE5E3F77F, 0x4DC2B8E60B24926B, 0x502C32B8290833B7, 0x761FAC5A4F7DD1D3,
+    0x6BF126046D51700F, 0xD50CC36F92F31BFB, 0xC8E24931B0DFBA27, 0xEED1D7D3D6AA5843, 0xF33F5D8DF486F99F,
+    0xA2B6EA171A419C8B, 0xBF586049386D3D57, 0x996BFEAB5E18DF33, 0x848574F57C347EEF, 0x76489B570E52165E,
+    0x6BA611092C7EB782, 0x4D958FEB4A0B55E6, 0x507B05B56827F43A, 0x01F2B22F86E0912E, 0x1C1C3871A4CC30F2,
+    0x3A2FA693C2B9D296, 0x27C12CCDE095734A, 0x993CC9A61F3718BE, 0x84D243F83D1BB962, 0xA2E1DD1A5B6E5B06,
+    0xBF0F57447942FADA, 0xEE86E0DE97859FCE, 0xF3686A80B5A93E12, 0xD55BF462D3DCDC76, 0xC8B57E3CF1F07DAA,
+    0xD6E9A7309F3239A7, 0xCB072D6EBD1E987B, 0xED34B38CDB6B7A1F, 0xF0DA39D2F947DBC3, 0xA1538E481780BED7,
+    0xBCBD041635AC1F0B, 0x9A8E9AF453D9FD6F, 0x876010AA71F55CB3, 0x399DF5C18E573747, 0x24737F9FAC7B969B,
+    0x0240E17DCA0E74FF, 0x1FAE6B23E822D523, 0x4E27DCB906E5B037, 0x53C956E724C911EB, 0x75FAC80542BCF38F,
+    0x6814425B60905253, 0x9AD9ADF912F63AE2, 0x873727A730DA9B3E, 0xA104B94556AF795A, 0xBCEA331B7483D886,
+    0xED6384819A44BD92, 0xF08D0EDFB8681C4E, 0xD6BE903DDE1DFE2A, 0xCB501A63FC315FF6, 0x75ADFF0803933402,
+    0x6843755621BF95DE, 0x4E70EBB447CA77BA, 0x539E61EA65E6D666, 0x0217D6708B21B372, 0x1FF95C2EA90D12AE,
+    0x39CAC2CCCF78F0CA, 0x24244892ED545116, 0x4E89B2A384BA3F2D, 0x536738FDA6969EF1, 0x7554A61FC0E37C95,
+    0x68BA2C41E2CFDD49, 0x39339BDB0C08B85D, 0x24DD11852E241981, 0x02EE8F674851FBE5, 0x1F0005396A7D5A39,
+    0xA1FDE05295DF31CD, 0xBC136A0CB7F39011, 0x9A20F4EED1867275, 0x87CE7EB0F3AAD3A9, 0xD647C92A1D6DB6BD,
+    0xCBA943743F411761, 0xED9ADD965934F505, 0xF07457C87B1854D9, 0x02B9B86A097E3C68, 0x1F5732342B529DB4,
+    0x3964ACD64D277FD0, 0x248A26886F0BDE0C, 0x7503911281CCBB18, 0x68ED1B4CA3E01AC4, 0x4EDE85AEC595F8A0,
+    0x53300FF0E7B9597C, 0xEDCDEA9B181B3288, 0xF02360C53A379354, 0xD610FE275C427130, 0xCBFE74797E6ED0EC,
+    0x9A77C3E390A9B5F8, 0x879949BDB2851424, 0xA1AAD75FD4F0F640, 0xBC445D01F6DC579C, 0x74F1233D072C2A36,
+    0x691FA96325008BEA, 0x4F2C37814375698E, 0x52C2BDDF6159C852, 0x034B0A458F9EAD46, 0x1EA5801BADB20C9A,
+    0x38961EF9CBC7EEFE, 0x257894A7E9EB4F22, 0x9B8571CC164924D6, 0x866BFB923465850A, 0xA05865705210676E,
+    0xBDB6EF2E703CC6B2, 0xEC3F58B49EFBA3A6, 0xF1D1D2EABCD7027A, 0xD7E24C08DAA2E01E, 0xCA0CC656F88E41C2,
+    0x38C129F48AE82973, 0x252FA3AAA8C488AF, 0x031C3D48CEB16ACB, 0x1EF2B716EC9DCB17, 0x4F7B008C025AAE03,
+    0x52958AD220760FDF, 0x74A614304603EDBB, 0x69489E6E642F4C67, 0xD7B57B059B8D2793, 0xCA5BF15BB9A1864F,
+    0xEC686FB9DFD4642B, 0xF186E5E7FDF8C5F7, 0xA00F527D133FA0E3, 0xBDE1D8233113013F, 0x9BD246C15766E35B,
+    0x863CCC9F754A4287, 0xEC9136AE1CA42CBC, 0xF17FBCF03E888D60, 0xD74C221258FD6F04, 0xCAA2A84C7AD1CED8,
+    0x9B2B1FD69416ABCC, 0x86C59588B63A0A10, 0xA0F60B6AD04FE874, 0xBD188134F26349A8, 0x03E5645F0DC1225C,
+    0x1E0BEE012FED8380, 0x383870E3499861E4, 0x25D6FABD6BB4C038, 0x745F4D278573A52C, 0x69B1C779A75F04F0,
+    0x4F82599BC12AE694, 0x526CD3C5E3064748, 0xA0A13C6791602FF9, 0xBD4FB639B34C8E25, 0x9B7C28DBD5396C41,
+    0x8692A285F715CD9D, 0xD71B151F19D2A889, 0xCAF59F413BFE0955, 0xECC601A35D8BEB31, 0xF1288BFD7FA74AED,
+    0x4FD56E9680052119, 0x523BE4C8A22980C5, 0x74087A2AC45C62A1, 0x69E6F074E670C37D, 0x386F47EE08B7A669,
+    0x2581CDB02A9B07B5, 0x03B253524CEEE5D1, 0x1E5CD90C6EC2440D, 0x0000000000000000, 0x5C2D776033C4205E,
+    0xB85AEEC0678840BC, 0xE47799A0544C60E2, 0xE26D72AB601E9FFD, 0xBE4005CB53DABFA3, 0x5A379C6B0796DF41,
+    0x061AEB0B3452FF1F, 0x56024A7D6F33217F, 0x0A2F3D1D5CF70121, 0xEE58A4BD08BB61C3, 0xB275D3DD3B7F419D,
+    0xB46F38D60F2DBE82, 0xE8424FB63CE99EDC, 0x0C35D61668A5FE3E, 0x5018A1765B61DE60, 0xAC0494FADE6642FE,
+    0xF029E39AEDA262A0, 0x145E7A3AB9EE0242, 0x48730D5A8A2A221C, 0x4E69E651BE78DD03, 0x124491318DBCFD5D,
+    0xF6330891D9F09DBF, 0xAA1E7FF1EA34BDE1, 0xFA06DE87B1556381, 0xA62BA9E7829143DF, 0x425C3047D6DD233D,
+    0x1E714727E5190363, 0x186BAC2CD14BFC7C, 0x4446DB4CE28FDC22, 0xA03142ECB6C3BCC0, 0xFC1C358C85079C9E,
+    0xCAD186DE13C29B79, 0x96FCF1BE2006BB27, 0x728B681E744ADBC5, 0x2EA61F7E478EFB9B, 0x28BCF47573DC0484,
+    0x74918315401824DA, 0x90E61AB514544438, 0xCCCB6DD527906466, 0x9CD3CCA37CF1BA06, 0xC0FEBBC34F359A58,
+    0x248922631B79FABA, 0x78A4550328BDDAE4, 0x7EBEBE081CEF25FB, 0x2293C9682F2B05A5, 0xC6E450C87B676547,
+    0x9AC927A848A34519, 0x66D51224CDA4D987, 0x3AF86544FE60F9D9, 0xDE8FFCE4AA2C993B, 0x82A28B8499E8B965,
+    0x84B8608FADBA467A, 0xD89517EF9E7E6624, 0x3CE28E4FCA3206C6, 0x60CFF92FF9F62698, 0x30D75859A297F8F8,
+    0x6CFA2F399153D8A6, 0x888DB699C51FB844, 0xD4A0C1F9F6DB981A, 0xD2BA2AF2C2896705, 0x8E975D92F14D475B,
+    0x6AE0C432A50127B9, 0x36CDB35296C507E7, 0x077BA297888B2877, 0x5B56D5F7BB4F0829, 0xBF214C57EF0368CB,
+    0xE30C3B37DCC74895, 0xE516D03CE895B78A, 0xB93BA75CDB5197D4, 0x5D4C3EFC8F1DF736, 0x0161499CBCD9D768,
+    0x5179E8EAE7B80908, 0x0D549F8AD47C2956, 0xE923062A803049B4, 0xB50E714AB3F469EA, 0xB3149A4187A696F5,
+    0xEF39ED21B462B6AB, 0x0B4E7481E02ED649, 0x576303E1D3EAF617, 0xAB7F366D56ED6A89, 0xF752410D65294AD7,
+    0x1325D8AD31652A35, 0x4F08AFCD02A10A6B, 0x491244C636F3F574, 0x153F33A60537D52A, 0xF148AA06517BB5C8,
+    0xAD65DD6662BF9596, 0xFD7D7C1039DE4BF6, 0xA1500B700A1A6BA8, 0x452792D05E560B4A, 0x190AE5B06D922B14,
+    0x1F100EBB59C0D40B, 0x433D79DB6A04F455, 0xA74AE07B3E4894B7, 0xFB67971B0D8CB4E9, 0xCDAA24499B49B30E,
+    0x91875329A88D9350, 0x75F0CA89FCC1F3B2, 0x29DDBDE9CF05D3EC, 0x2FC756E2FB572CF3, 0x73EA2182C8930CAD,
+    0x979DB8229CDF6C4F, 0xCBB0CF42AF1B4C11, 0x9BA86E34F47A9271, 0xC7851954C7BEB22F, 0x23F280F493F2D2CD,
+    0x7FDFF794A036F293, 0x79C51C9F94640D8C, 0x25E86BFFA7A02DD2, 0xC19FF25FF3EC4D30, 0x9DB2853FC0286D6E,
+    0x61AEB0B3452FF1F0, 0x3D83C7D376EBD1AE, 0xD9F45E7322A7B14C, 0x85D9291311639112, 0x83C3C21825316E0D,
+    0xDFEEB57816F54E53, 0x3B992CD842B92EB1, 0x67B45BB8717D0EEF, 0x37ACFACE2A1CD08F, 0x6B818DAE19D8F0D1,
+    0x8FF6140E4D949033, 0xD3DB636E7E50B06D, 0xD5C188654A024F72, 0x89ECFF0579C66F2C, 0x6D9B66A52D8A0FCE,
+    0x31B611C51E4E2F90, 0x0EF7452F111650EE, 0x52DA324F22D270B0, 0xB6ADABEF769E1052, 0xEA80DC8F455A300C,
+    0xEC9A37847108CF13, 0xB0B740E442CCEF4D, 0x54C0D94416808FAF, 0x08EDAE242544AFF1, 0x58F50F527E257191,
+    0x04D878324DE151CF, 0xE0AFE19219AD312D, 0xBC8296F22A691173, 0xBA987DF91E3BEE6C, 0xE6B50A992DFFCE32,
+    0x02C2933979B3AED0, 0x5EEFE4594A778E8E, 0xA2F3D1D5CF701210, 0xFEDEA6B5FCB4324E, 0x1AA93F15A8F852AC,
+    0x468448759B3C72F2, 0x409EA37EAF6E8DED, 0x1CB3D41E9CAAADB3, 0xF8C44DBEC8E6CD51, 0xA4E93ADEFB22ED0F,
+    0xF4F19BA8A043336F, 0xA8DCECC893871331, 0x4CAB7568C7CB73D3, 0x10860208F40F538D, 0x169CE903C05DAC92,
+    0x4AB19E63F3998CCC, 0xAEC607C3A7D5EC2E, 0xF2EB70A39411CC70, 0xC426C3F102D4CB97, 0x980BB4913110EBC9,
+    0x7C7C2D31655C8B2B, 0x20515A515698AB75, 0x264BB15A62CA546A, 0x7A66C63A510E7434, 0x9E115F9A054214D6,
+    0xC23C28FA36863488, 0x9224898C6DE7EAE8, 0xCE09FEEC5E23CAB6, 0x2A7E674C0A6FAA54, 0x7653102C39AB8A0A,
+    0x7049FB270DF97515, 0x2C648C473E3D554B, 0xC81315E76A7135A9, 0x943E628759B515F7, 0x6822570BDCB28969,
+    0x340F206BEF76A937, 0xD078B9CBBB3AC9D5, 0x8C55CEAB88FEE98B, 0x8A4F25A0BCAC1694, 0xD66252C08F6836CA,
+    0x3215CB60DB245628, 0x6E38BC00E8E07676, 0x3E201D76B381A816, 0x620D6A1680458848, 0x867AF3B6D409E8AA,
+    0xDA5784D6E7CDC8F4, 0xDC4D6FDDD39F37EB, 0x806018BDE05B17B5, 0x6417811DB4177757, 0x383AF67D87D35709,
+    0x098CE7B8999D7899, 0x55A190D8AA5958C7, 0xB1D60978FE153825, 0xEDFB7E18CDD1187B, 0xEBE19513F983E764,
+    0xB7CCE273CA47C73A, 0x53BB7BD39E0BA7D8, 0x0F960CB3ADCF8786, 0x5F8EADC5F6AE59E6, 0x03A3DAA5C56A79B8,
+    0xE7D443059126195A, 0xBBF93465A2E23904, 0xBDE3DF6E96B0C61B, 0xE1CEA80EA574E645, 0x05B931AEF13886A7,
+    0x599446CEC2FCA6F9, 0xA588734247FB3A67, 0xF9A50422743F1A39, 0x1DD29D8220737ADB, 0x41FFEAE213B75A85,
+    0x47E501E927E5A59A, 0x1BC87689142185C4, 0xFFBFEF29406DE526, 0xA392984973A9C578, 0xF38A393F28C81B18,
+    0xAFA74E5F1B0C3B46, 0x4BD0D7FF4F405BA4, 0x17FDA09F7C847BFA, 0x11E74B9448D684E5, 0x4DCA3CF47B12A4BB,
+    0xA9BDA5542F5EC459, 0xF590D2341C9AE407, 0xC35D61668A5FE3E0, 0x9F701606B99BC3BE, 0x7B078FA6EDD7A35C,
+    0x272AF8C6DE138302, 0x213013CDEA417C1D, 0x7D1D64ADD9855C43, 0x996AFD0D8DC93CA1, 0xC5478A6DBE0D1CFF,
+    0x955F2B1BE56CC29F, 0xC9725C7BD6A8E2C1, 0x2D05C5DB82E48223, 0x7128B2BBB120A27D, 0x773259B085725D62,
+    0x2B1F2ED0B6B67D3C, 0xCF68B770E2FA1DDE, 0x9345C010D13E3D80, 0x6F59F59C5439A11E, 0x337482FC67FD8140,
+    0xD7031B5C33B1E1A2, 0x8B2E6C3C0075C1FC, 0x8D34873734273EE3, 0xD119F05707E31EBD, 0x356E69F753AF7E5F,
+    0x69431E97606B5E01, 0x395BBFE13B0A8061, 0x6576C88108CEA03F, 0x810151215C82C0DD, 0xDD2C26416F46E083,
+    0xDB36CD4A5B141F9C, 0x871BBA2A68D03FC2, 0x636C238A3C9C5F20, 0x3F4154EA0F587F7E, 0x0000000000000000,
+    0x6184D55F721267C6, 0xC309AABEE424CF8C, 0xA28D7FE19636A84A, 0x14CBFA566747819D, 0x754F2F091555E65B,
+    0xD7C250E883634E11, 0xB64685B7F17129D7, 0x2997F4ACCE8F033A, 0x481321F3BC9D64FC, 0xEA9E5E122AABCCB6,
+    0x8B1A8B4D58B9AB70, 0x3D5C0EFAA9C882A7, 0x5CD8DBA5DBDAE561, 0xFE55A4444DEC4D2B, 0x9FD1711B3FFE2AED,
+    0x532FE9599D1E0674, 0x32AB3C06EF0C61B2, 0x902643E7793AC9F8, 0xF1A296B80B28AE3E, 0x47E4130FFA5987E9,
+    0x2660C650884BE02F, 0x84EDB9B11E7D4865, 0xE5696CEE6C6F2FA3, 0x7AB81DF55391054E, 0x1B3CC8AA21836288,
+    0xB9B1B74BB7B5CAC2, 0xD8356214C5A7AD04, 0x6E73E7A334D684D3, 0x0FF732FC46C4E315, 0xAD7A4D1DD0F24B5F,
+    0xCCFE9842A2E02C99, 0xA65FD2B33A3C0CE8, 0xC7DB07EC482E6B2E, 0x6556780DDE18C364, 0x04D2AD52AC0AA4A2,
+    0xB29428E55D7B8D75, 0xD310FDBA2F69EAB3, 0x719D825BB95F42F9, 0x10195704CB4D253F, 0x8FC8261FF4B30FD2,
+    0xEE4CF34086A16814, 0x4CC18CA11097C05E, 0x2D4559FE6285A798, 0x9B03DC4993F48E4F, 0xFA870916E1E6E989,
+    0x580A76F777D041C3, 0x398EA3A805C22605, 0xF5703BEAA7220A9C, 0x94F4EEB5D5306D5A, 0x367991544306C510,
+    0x57FD440B3114A2D6, 0xE1BBC1BCC0658B01, 0x803F14E3B277ECC7, 0x22B26B022441448D, 0x4336BE5D5653234B,
+    0xDCE7CF4669AD09A6, 0xBD631A191BBF6E60, 0x1FEE65F88D89C62A, 0x7E6AB0A7FF9BA1EC, 0xC82C35100EEA883B,
+    0xA9A8E04F7CF8EFFD, 0x0B259FAEEACE47B7, 0x6AA14AF198DC2071, 0xDE670A4DDB760755, 0xBFE3DF12A9646093,
+    0x1D6EA0F33F52C8D9, 0x7CEA75AC4D40AF1F, 0xCAACF01BBC3186C8, 0xAB282544CE23E10E, 0x09A55AA558154944,
+    0x68218FFA2A072E82, 0xF7F0FEE115F9046F, 0x96742BBE67EB63A9, 0x34F9545FF1DDCBE3, 0x557D810083CFAC25,
+    0xE33B04B772BE85F2, 0x82BFD1E800ACE234, 0x2032AE09969A4A7E, 0x41B67B56E4882DB8, 0x8D48E31446680121,
+    0xECCC364B347A66E7, 0x4E4149AAA24CCEAD, 0x2FC59CF5D05EA96B, 0x99831942212F80BC, 0xF807CC1D533DE77A,
+    0x5A8AB3FCC50B4F30, 0x3B0E66A3B71928F6, 0xA4DF17B888E7021B, 0xC55BC2E7FAF565DD, 0x67D6BD066CC3CD97,
+    0x065268591ED1AA51, 0xB014EDEEEFA08386, 0xD19038B19DB2E440, 0x731D47500B844C0A, 0x1299920F79962BCC,
+    0x7838D8FEE14A0BBD, 0x19BC0DA193586C7B, 0xBB317240056EC431, 0xDAB5A71F777CA3F7, 0x6CF322A8860D8A20,
+    0x0D77F7F7F41FEDE6, 0xAFFA8816622945AC, 0xCE7E5D49103B226A, 0x51AF2C522FC50887, 0x302BF90D5DD76F41,
+    0x92A686ECCBE1C70B, 0xF32253B3B9F3A0CD, 0x4564D6044882891A, 0x24E0035B3A90EEDC, 0x866D7CBAACA64696,
+    0xE7E9A9E5DEB42150, 0x2B1731A77C540DC9, 0x4A93E4F80E466A0F, 0xE81E9B199870C245, 0x899A4E46EA62A583,
+    0x3FDCCBF11B138C54, 0x5E581EAE6901EB92, 0xFCD5614FFF3743D8, 0x9D51B4108D25241E, 0x0280C50BB2DB0EF3,
+    0x63041054C0C96935, 0xC1896FB556FFC17F, 0xA00DBAEA24EDA6B9, 0x164B3F5DD59C8F6E, 0x77CFEA02A78EE8A8,
+    0xD54295E331B840E2, 0xB4C640BC43AA2724, 0x2E16BBB019E2102F, 0x4F926EEF6BF077E9, 0xED1F110EFDC6DFA3,
+    0x8C9BC4518FD4B865, 0x3ADD41E67EA591B2, 0x5B5994B90CB7F674, 0xF9D4EB589A815E3E, 0x98503E07E89339F8,
+    0x07814F1CD76D1315, 0x66059A43A57F74D3, 0xC488E5A23349DC99, 0xA50C30FD415BBB5F, 0x134AB54AB02A9288,
+    0x72CE6015C238F54E, 0xD0431FF4540E5D04, 0xB1C7CAAB261C3AC2, 0x7D3952E984FC165B, 0x1CBD87B6F6EE719D,
+    0xBE30F85760D8D9D7, 0xDFB42D0812CABE11, 0x69F2A8BFE3BB97C6, 0x08767DE091A9F000, 0xAAFB0201079F584A,
+    0xCB7FD75E758D3F8C, 0x54AEA6454A731561, 0x352A731A386172A7, 0x97A70CFBAE57DAED, 0xF623D9A4DC45BD2B,
+    0x40655C132D3494FC, 0x21E1894C5F26F33A, 0x836CF6ADC9105B70, 0xE2E823F2BB023CB6, 0x8849690323DE1CC7,
+    0xE9CDBC5C51CC7B01, 0x4B40C3BDC7FAD34B, 0x2AC416E2B5E8B48D, 0x9C82935544999D5A, 0xFD06460A368BFA9C,
+    0x5F8B39EBA0BD52D6, 0x3E0FECB4D2AF3510, 0xA1DE9DAFED511FFD, 0xC05A48F09F43783B, 0x62D737110975D071,
+    0x0353E24E7B67B7B7, 0xB51567F98A169E60, 0xD491B2A6F804F9A6, 0x761CCD476E3251EC, 0x179818181C20362A,
+    0xDB66805ABEC01AB3, 0xBAE25505CCD27D75, 0x186F2AE45AE4D53F, 0x79EBFFBB28F6B2F9, 0xCFAD7A0CD9879B2E,
+    0xAE29AF53AB95FCE8, 0x0CA4D0B23DA354A2, 0x6D2005ED4FB13364, 0xF2F174F6704F1989, 0x9375A1A9025D7E4F,
+    0x31F8DE48946BD605, 0x507C0B17E679B1C3, 0xE63A8EA017089814, 0x87BE5BFF651AFFD2, 0x2533241EF32C5798,
+    0x44B7F141813E305E, 0xF071B1FDC294177A, 0x91F564A2B08670BC, 0x33781B4326B0D8F6, 0x52FCCE1C54A2BF30,
+    0xE4BA4BABA5D396E7, 0x853E9EF4D7C1F121, 0x27B3E11541F7596B, 0x4637344A33E53EAD, 0xD9E645510C1B1440,
+    0xB862900E7E097386, 0x1AEFEFEFE83FDBCC, 0x7B6B3AB09A2DBC0A, 0xCD2DBF076B5C95DD, 0xACA96A58194EF21B,
+    0x0E2415B98F785A51, 0x6FA0C0E6FD6A3D97, 0xA35E58A45F8A110E, 0xC2DA8DFB2D9876C8, 0x6057F21ABBAEDE82,
+    0x01D32745C9BCB944, 0xB795A2F238CD9093, 0xD61177AD4ADFF755, 0x749C084CDCE95F1F, 0x1518DD13AEFB38D9,
+    0x8AC9AC0891051234, 0xEB4D7957E31775F2, 0x49C006B67521DDB8, 0x2844D3E90733BA7E, 0x9E02565EF64293A9,
+    0xFF8683018450F46F, 0x5D0BFCE012665C25, 0x3C8F29BF60743BE3, 0x562E634EF8A81B92, 0x37AAB6118ABA7C54,
+    0x9527C9F01C8CD41E, 0xF4A31CAF6E9EB3D8, 0x42E599189FEF9A0F, 0x23614C47EDFDFDC9, 0x81EC33A67BCB5583,
+    0xE068E6F909D93245, 0x7FB997E2362718A8, 0x1E3D42BD44357F6E, 0xBCB03D5CD203D724, 0xDD34E803A011B0E2,
+    0x6B726DB451609935, 0x0AF6B8EB2372FEF3, 0xA87BC70AB54456B9, 0xC9FF1255C756317F, 0x05018A1765B61DE6,
+    0x64855F4817A47A20, 0xC60820A98192D26A, 0xA78CF5F6F380B5AC, 0x11CA704102F19C7B, 0x704EA51E70E3FBBD,
+    0xD2C3DAFFE6D553F7, 0xB3470FA094C73431, 0x2C967EBBAB391EDC, 0x4D12ABE4D92B791A, 0xEF9FD4054F1DD150,
+    0x8E1B015A3D0FB696, 0x385D84EDCC7E9F41, 0x59D951B2BE6CF887, 0xFB542E53285A50CD, 0x9AD0FB0C5A48370B,
+    0x0000000000000000, 0x22EF0D5934F964EC, 0x45DE1AB269F2C9D8, 0x673117EB5D0BAD34, 0x8BBC3564D3E593B0,
+    0xA953383DE71CF75C, 0xCE622FD6BA175A68, 0xEC8D228F8EEE3E84, 0x85A0C5E208C539E5, 0xA74FC8BB3C3C5D09,
+    0xC07EDF506137F03D, 0xE291D20955CE94D1, 0x0E1CF086DB20AA55, 0x2CF3FDDFEFD9CEB9, 0x4BC2EA34B2D2638D,
+    0x692DE76D862B0761, 0x999924EFBE846D4F, 0xBB7629B68A7D09A3, 0xDC473E5DD776A497, 0xFEA83304E38FC07B,
+    0x1225118B6D61FEFF, 0x30CA1CD259989A13, 0x57FB0B3904933727, 0x75140660306A53CB, 0x1C39E10DB64154AA,
+    0x3ED6EC5482B83046, 0x59E7FBBFDFB39D72, 0x7B08F6E6EB4AF99E, 0x9785D46965A4C71A, 0xB56AD930515DA3F6,
+    0xD25BCEDB0C560EC2, 0xF0B4C38238AF6A2E, 0xA1EAE6F4D206C41B, 0x8305EBADE6FFA0F7, 0xE434FC46BBF40DC3,
+    0xC6DBF11F8F0D692F, 0x2A56D39001E357AB, 0x08B9DEC9351A3347, 0x6F88C92268119E73, 0x4D67C47B5CE8FA9F,
+    0x244A2316DAC3FDFE, 0x06A52E4FEE3A9912, 0x619439A4B3313426, 0x437B34FD87C850CA, 0xAFF6167209266E4E,
+    0x8D191B2B3DDF0AA2, 0xEA280CC060D4A796, 0xC8C70199542DC37A, 0x3873C21B6C82A954, 0x1A9CCF42587BCDB8,
+    0x7DADD8A90570608C, 0x5F42D5F031890460, 0xB3CFF77FBF673AE4, 0x9120FA268B9E5E08, 0xF611EDCDD695F33C,
+    0xD4FEE094E26C97D0, 0xBDD307F9644790B1, 0x9F3C0AA050BEF45D, 0xF80D1D4B0DB55969, 0xDAE21012394C3D85,
+    0x366F329DB7A20301, 0x14803FC4835B67ED, 0x73B1282FDE50CAD9, 0x515E2576EAA9AE35, 0xD10D62C20B0396B3,
+    0xF3E26F9B3FFAF25F, 0x94D3787062F15F6B, 0xB63C752956083B87, 0x5AB157A6D8E60503, 0x785E5AFFEC1F61EF,
+    0x1F6F4D14B114CCDB, 0x3D80404D85EDA837, 0x54ADA72003C6AF56, 0x7642AA79373FCBBA, 0x1173BD926A34668E,
+    0x339CB0CB5ECD0262, 0xDF119244D0233CE6, 0xFDFE9F1DE4DA580A, 0x9ACF88F6B9D1F53E, 0xB82085AF8D2891D2,
+    0x4894462DB587FBFC, 0x6A7B4B74817E9F10, 0x0D4A5C9FDC753224, 0x2FA551C6E88C56C8, 0xC32873496662684C,
+    0xE1C77E10529B0CA0, 0x86F669FB0F90A194, 0xA41964A23B69C578, 0xCD3483CFBD42C219, 0xEFDB8E9689BBA6F5,
+    0x88EA997DD4B00BC1, 0xAA059424E0496F2D, 0x4688B6AB6EA751A9, 0x6467BBF25A5E3545, 0x0356AC1907559871,
+    0x21B9A14033ACFC9D, 0x70E78436D90552A8, 0x5208896FEDFC3644, 0x35399E84B0F79B70, 0x17D693DD840EFF9C,
+    0xFB5BB1520AE0C118, 0xD9B4BC0B3E19A5F4, 0xBE85ABE0631208C0, 0x9C6AA6B957EB6C2C, 0xF54741D4D1C06B4D,
+    0xD7A84C8DE5390FA1, 0xB0995B66B832A295, 0x9276563F8CCBC679, 0x7EFB74B00225F8FD, 0x5C1479E936DC9C11,
+    0x3B256E026BD73125, 0x19CA635B5F2E55C9, 0xE97EA0D967813FE7, 0xCB91AD8053785B0B, 0xACA0BA6B0E73F63F,
+    0x8E4FB7323A8A92D3, 0x62C295BDB464AC57, 0x402D98E4809DC8BB, 0x271C8F0FDD96658F, 0x05F38256E96F0163,
+    0x6CDE653B6F440602, 0x4E3168625BBD62EE, 0x29007F8906B6CFDA, 0x0BEF72D0324FAB36, 0xE762505FBCA195B2,
+    0xC58D5D068858F15E, 0xA2BC4AEDD5535C6A, 0x805347B4E1AA3886, 0x30C26AAFB90933E3, 0x122D67F68DF0570F,
+    0x751C701DD0FBFA3B, 0x57F37D44E4029ED7, 0xBB7E5FCB6AECA053, 0x999152925E15C4BF, 0xFEA04579031E698B,
+    0xDC4F482037E70D67, 0xB562AF4DB1CC0A06, 0x978DA21485356EEA, 0xF0BCB5FFD83EC3DE, 0xD253B8A6ECC7A732,
+    0x3EDE9A29622999B6, 0x1C31977056D0FD5A, 0x7B00809B0BDB506E, 0x59EF8DC23F223482, 0xA95B4E40078D5EAC,
+    0x8BB4431933743A40, 0xEC8554F26E7F9774, 0xCE6A59AB5A86F398, 0x22E77B24D468CD1C, 0x0008767DE091A9F0,
+    0x67396196BD9A04C4, 0x45D66CCF89636028, 0x2CFB8BA20F486749, 0x0E1486FB3BB103A5, 0x6925911066BAAE91,
+    0x4BCA9C495243CA7D, 0xA747BEC6DCADF4F9, 0x85A8B39FE8549015, 0xE299A474B55F3D21, 0xC076A92D81A659CD,
+    0x91288C5B6B0FF7F8, 0xB3C781025FF69314, 0xD4F696E902FD3E20, 0xF6199BB036045ACC, 0x1A94B93FB8EA6448,
+    0x387BB4668C1300A4, 0x5F4AA38DD118AD90, 0x7DA5AED4E5E1C97C, 0x148849B963CACE1D, 0x366744E05733AAF1,
+    0x5156530B0A3807C5, 0x73B95E523EC16329, 0x9F347CDDB02F5DAD, 0xBDDB718484D63941, 0xDAEA666FD9DD9475,
+    0xF8056B36ED24F099, 0x08B1A8B4D58B9AB7, 0x2A5EA5EDE172FE5B, 0x4D6FB206BC79536F, 0x6F80BF5F88803783,
+    0x830D9DD0066E0907, 0xA1E2908932976DEB, 0xC6D387626F9CC0DF, 0xE43C8A3B5B65A433, 0x8D116D56DD4EA352,
+    0xAFFE600FE9B7C7BE, 0xC8CF77E4B4BC6A8A, 0xEA207ABD80450E66, 0x06AD58320EAB30E2, 0x2442556B3A52540E,
+    0x437342806759F93A, 0x619C4FD953A09DD6, 0xE1CF086DB20AA550, 0xC320053486F3C1BC, 0xA41112DFDBF86C88,
+    0x86FE1F86EF010864, 0x6A733D0961EF36E0, 0x489C30505516520C, 0x2FAD27BB081DFF38, 0x0D422AE23CE49BD4,
+    0x646FCD8FBACF9CB5, 0x4680C0D68E36F859, 0x21B1D73DD33D556D, 0x035EDA64E7C43181, 0xEFD3F8EB692A0F05,
+    0xCD3CF5B25DD36BE9, 0xAA0DE25900D8C6DD, 0x88E2EF003421A231, 0x78562C820C8EC81F, 0x5AB921DB3877ACF3,
+    0x3D883630657C01C7, 0x1F673B695185652B, 0xF3EA19E6DF6B5BAF, 0xD10514BFEB923F43, 0xB6340354B6999277,
+    0x94DB0E0D8260F69B, 0xFDF6E960044BF1FA, 0xDF19E43930B29516, 0xB828F3D26DB93822, 0x9AC7FE8B59405CCE,
+    0x764ADC04D7AE624A, 0x54A5D15DE35706A6, 0x3394C6B6BE5CAB92, 0x117BCBEF8AA5CF7E, 0x4025EE99600C614B,
+    0x62CAE3C054F505A7, 0x05FBF42B09FEA893, 0x2714F9723D07CC7F, 0xCB99DBFDB3E9F2FB, 0xE976D6A487109617,
+    0x8E47C14FDA1B3B23, 0xACA8CC16EEE25FCF, 0xC5852B7B68C958AE, 0xE76A26225C303C42, 0x805B31C9013B9176,
+    0xA2B43C9035C2F59A, 0x4E391E1FBB2CCB1E, 0x6CD613468FD5AFF2, 0x0BE704ADD2DE02C6, 0x290809F4E627662A,
+    0xD9BCCA76DE880C04, 0xFB53C72FEA7168E8, 0x9C62D0C4B77AC5DC, 0xBE8DDD9D8383A130, 0x5200FF120D6D9FB4,
+    0x70EFF24B3994FB58, 0x17DEE5A0649F566C, 0x3531E8F950663280, 0x5C1C0F94D64D35E1, 0x7EF302CDE2B4510D,
+    0x19C21526BFBFFC39, 0x3B2D187F8B4698D5, 0xD7A03AF005A8A651, 0xF54F37A93151C2BD, 0x927E20426C5A6F89,
+    0xB0912D1B58A30B65, 0x0000000000000000, 0xDABE95AFC7875F40, 0x27A584742000A005, 0xFD1B11DBE787FF45,
+    0x4F4B08E84001400A, 0x95F59D4787861F4A, 0x68EE8C9C6001E00F, 0xB2501933A786BF4F, 0x9E9611D080028014,
+    0x4428847F4785DF54, 0xB93395A4A0022011, 0x638D000B67857F51, 0xD1DD1938C003C01E, 0x0B638C9707849F5E,
+    0xF6789D4CE003601B, 0x2CC608E327843F5B, 0xAFF48C8AAF0B1EAD, 0x754A1925688C41ED, 0x885108FE8F0BBEA8,
+    0x52EF9D51488CE1E8, 0xE0BF8462EF0A5EA7, 0x3A0111CD288D01E7, 0xC71A0016CF0AFEA2, 0x1DA495B9088DA1E2,
+    0x31629D5A2F099EB9, 0xEBDC08F5E88EC1F9, 0x16C7192E0F093EBC, 0xCC798C81C88E61FC, 0x7E2995B26F08DEB3,
+    0xA497001DA88F81F3, 0x598C11C64F087EB6, 0x83328469888F21F6, 0xCD31B63EF11823DF, 0x178F2391369F7C9F,
+    0xEA94324AD11883DA, 0x302AA7E5169FDC9A, 0x827ABED6B11963D5, 0x58C42B79769E3C95, 0xA5DF3AA29119C3D0,
+    0x7F61AF0D569E9C90, 0x53A7A7EE711AA3CB, 0x89193241B69DFC8B, 0x7402239A511A03CE, 0xAEBCB635969D5C8E,
+    0x1CECAF06311BE3C1, 0xC6523AA9F69CBC81, 0x3B492B72111B43C4, 0xE1F7BEDDD69C1C84, 0x62C53AB45E133D72,
+    0xB87BAF1B99946232, 0x4560BEC07E139D77, 0x9FDE2B6FB994C237, 0x2D8E325C1E127D78, 0xF730A7F3D9952238,
+    0x0A2BB6283E12DD7D, 0xD0952387F995823D, 0xFC532B64DE11BD66, 0x26EDBECB1996E226, 0xDBF6AF10FE111D63,
+    0x01483ABF39964223, 0xB318238C9E10FD6C, 0x69A6B6235997A22C, 0x94BDA7F8BE105D69, 0x4E03325779970229,
+    0x08BBC3564D3E593B, 0xD20556F98AB9067B, 0x2F1E47226D3EF93E, 0xF5A0D28DAAB9A67E, 0x47F0CBBE0D3F1931,
+    0x9D4E5E11CAB84671, 0x60554FCA2D3FB934, 0xBAEBDA65EAB8E674, 0x962DD286CD3CD92F, 0x4C9347290ABB866F,
+    0xB18856F2ED3C792A, 0x6B36C35D2ABB266A, 0xD966DA6E8D3D9925, 0x03D84FC14ABAC665, 0xFEC35E1AAD3D3920,
+    0x247DCBB56ABA6660, 0xA74F4FDCE2354796, 0x7DF1DA7325B218D6, 0x80EACBA8C235E793, 0x5A545E0705B2B8D3,
+    0xE8044734A234079C, 0x32BAD29B65B358DC, 0xCFA1C3408234A799, 0x151F56EF45B3F8D9, 0x39D95E0C6237C782,
+    0xE367CBA3A5B098C2, 0x1E7CDA7842376787, 0xC4C24FD785B038C7, 0x769256E422368788, 0xAC2CC34BE5B1D8C8,
+    0x5137D2900236278D, 0x8B89473FC5B178CD, 0xC58A7568BC267AE4, 0x1F34E0C77BA125A4, 0xE22FF11C9C26DAE1,
+    0x389164B35BA185A1, 0x8AC17D80FC273AEE, 0x507FE82F3BA065AE, 0xAD64F9F4DC279AEB, 0x77DA6C5B1BA0C5AB,
+    0x5B1C64B83C24FAF0, 0x81A2F117FBA3A5B0, 0x7CB9E0CC1C245AF5, 0xA6077563DBA305B5, 0x14576C507C25BAFA,
+    0xCEE9F9FFBBA2E5BA, 0x33F2E8245C251AFF, 0xE94C7D8B9BA245BF, 0x6A7EF9E2132D6449, 0xB0C06C4DD4AA3B09,
+    0x4DDB7D96332DC44C, 0x9765E839F4AA9B0C, 0x2535F10A532C2443, 0xFF8B64A594AB7B03, 0x0290757E732C8446,
+    0xD82EE0D1B4ABDB06, 0xF4E8E832932FE45D, 0x2E567D9D54A8BB1D, 0xD34D6C46B32F4458, 0x09F3F9E974A81B18,
+    0xBBA3E0DAD32EA457, 0x611D757514A9FB17, 0x9C0664AEF32E0452, 0x46B8F10134A95B12, 0x117786AC9A7CB276,
+    0xCBC913035DFBED36, 0x36D202D8BA7C1273, 0xEC6C97777DFB4D33, 0x5E3C8E44DA7DF27C, 0x84821BEB1DFAAD3C,
+    0x79990A30FA7D5279, 0xA3279F9F3DFA0D39, 0x8FE1977C1A7E3262, 0x555F02D3DDF96D22, 0xA84413083A7E9267,
+    0x72FA86A7FDF9CD27, 0xC0AA9F945A7F7268, 0x1A140A3B9DF82D28, 0xE70F1BE07A7FD26D, 0x3DB18E4FBDF88D2D,
+    0xBE830A263577ACDB, 0x643D9F89F2F0F39B, 0x99268E5215770CDE, 0x43981BFDD2F0539E, 0xF1C802CE7576ECD1,
+    0x2B769761B2F1B391, 0xD66D86BA55764CD4, 0x0CD3131592F11394, 0x20151BF6B5752CCF, 0xFAAB8E5972F2738F,
+    0x07B09F8295758CCA, 0xDD0E0A2D52F2D38A, 0x6F5E131EF5746CC5, 0xB5E086B132F33385, 0x48FB976AD574CCC0,
+    0x924502C512F39380, 0xDC4630926B6491A9, 0x06F8A53DACE3CEE9, 0xFBE3B4E64B6431AC, 0x215D21498CE36EEC,
+    0x930D387A2B65D1A3, 0x49B3ADD5ECE28EE3, 0xB4A8BC0E0B6571A6, 0x6E1629A1CCE22EE6, 0x42D02142EB6611BD,
+    0x986EB4ED2CE14EFD, 0x6575A536CB66B1B8, 0xBFCB30990CE1EEF8, 0x0D9B29AAAB6751B7, 0xD725BC056CE00EF7,
+    0x2A3EADDE8B67F1B2, 0xF08038714CE0AEF2, 0x73B2BC18C46F8F04, 0xA90C29B703E8D044, 0x5417386CE46F2F01,
+    0x8EA9ADC323E87041, 0x3CF9B4F0846ECF0E, 0xE647215F43E9904E, 0x1B5C3084A46E6F0B, 0xC1E2A52B63E9304B,
+    0xED24ADC8446D0F10, 0x379A386783EA5050, 0xCA8129BC646DAF15, 0x103FBC13A3EAF055, 0xA26FA520046C4F1A,
+    0x78D1308FC3EB105A, 0x85CA2154246CEF1F, 0x5F74B4FBE3EBB05F, 0x19CC45FAD742EB4D, 0xC372D05510C5B40D,
+    0x3E69C18EF7424B48, 0xE4D7542130C51408, 0x56874D129743AB47, 0x8C39D8BD50C4F407, 0x7122C966B7430B42,
+    0xAB9C5CC970C45402, 0x875A542A57406B59, 0x5DE4C18590C73419, 0xA0FFD05E7740CB5C, 0x7A4145F1B0C7941C,
+    0xC8115CC217412B53, 0x12AFC96DD0C67413, 0xEFB4D8B637418B56, 0x350A4D19F0C6D416, 0xB638C9707849F5E0,
+    0x6C865CDFBFCEAAA0, 0x919D4D04584955E5, 0x4B23D8AB9FCE0AA5, 0xF973C1983848B5EA, 0x23CD5437FFCFEAAA,
+    0xDED645EC184815EF, 0x0468D043DFCF4AAF, 0x28AED8A0F84B75F4, 0xF2104D0F3FCC2AB4, 0x0F0B5CD4D84BD5F1,
+    0xD5B5C97B1FCC8AB1, 0x67E5D048B84A35FE, 0xBD5B45E77FCD6ABE, 0x4040543C984A95FB, 0x9AFEC1935FCDCABB,
+    0xD4FDF3C4265AC892, 0x0E43666BE1DD97D2, 0xF35877B0065A6897, 0x29E6E21FC1DD37D7, 0x9BB6FB2C665B8898,
+    0x41086E83A1DCD7D8, 0xBC137F58465B289D, 0x66ADEAF781DC77DD, 0x4A6BE214A6584886, 0x90D577BB61DF17C6,
+    0x6DCE66608658E883, 0xB770F3CF41DFB7C3, 0x0520EAFCE659088C, 0xDF9E7F5321DE57CC, 0x22856E88C659A889,
+    0xF83BFB2701DEF7C9, 0x7B097F4E8951D63F, 0xA1B7EAE14ED6897F, 0x5CACFB3AA951763A, 0x86126E956ED6297A,
+    0x344277A6C9509635, 0xEEFCE2090ED7C975, 0x13E7F3D2E9503630, 0xC959667D2ED76970, 0xE59F6E9E0953562B,
+    0x3F21FB31CED4096B, 0xC23AEAEA2953F62E, 0x18847F45EED4A96E, 0xAAD4667649521621, 0x706AF3D98ED54961,
+    0x8D71E2026952B624, 0x57CF77ADAED5E964,
+};
+
+/**
+ * @brief   CRC-64 tables (polynomial 0x42F0E1EBA9EA3693, LSB-first), e.g. CRC-64/XZ.
+ */
+const calc_crc_64bit_tables_t calc_crc_tables_crc64_xz = {
+    .polynomial = 0x42F0E1EBA9EA3693,
+    .reflected = true,
+    .slices = 8,
+    .table = _table_crc64_xz,
+    .slice_table = _slice_table_crc64_xz,
+    .fold_constants = {0x6AE3EFBB9DD441F3u, 0x081F6054A7842DF4u, 0xB5EA1AF9C013ACA4u, 0x69A35D91C3730254u,
+                       0x60095B008A9EFA44u, 0x3BE653A30FE1AF51u, 0xE05DD497CA393AE4u, 0xDABE95AFC7875F40u},
+};
+
+// --- calc_crc_tables_crc64_ecma --------------------------------------------------------------------------------------
+
+static const uint64_t _table_crc64_ecma[256] = {
+    0x0000000000000000, 0x42F0E1EBA9EA3693, 0x85E1C3D753D46D26, 0xC711223CFA3E5BB5, 0x493366450E42ECDF,
+    0x0BC387AEA7A8DA4C, 0xCCD2A5925D9681F9, 0x8E224479F47CB76A, 0x9266CC8A1C85D9BE, 0xD0962D61B56FEF2D,
+    0x17870F5D4F51B498, 0x5577EEB6E6BB820B, 0xDB55AACF12C73561, 0x99A54B24BB2D03F2, 0x5EB4691841135847,
+    0x1C4488F3E8F96ED4, 0x663D78FF90E185EF, 0x24CD9914390BB37C, 0xE3DCBB28C335E8C9, 0xA12C5AC36ADFDE5A,
+    0x2F0E1EBA9EA36930, 0x6DFEFF5137495FA3, 0xAAEFDD6DCD770416, 0xE81F3C86649D3285, 0xF45BB4758C645C51,
+    0xB6AB559E258E6AC2, 0x71BA77A2DFB03177, 0x334A9649765A07E4, 0xBD68D2308226B08E, 0xFF9833DB2BCC861D,
+    0x388911E7D1F2DDA8, 0x7A79F00C7818EB3B, 0xCC7AF1FF21C30BDE, 0x8E8A101488293D4D, 0x499B3228721766F8,
+    0x0B6BD3C3DBFD506B, 0x854997BA2F81E701, 0xC7B97651866BD192, 0x00A8546D7C558A27, 0x4258B586D5BFBCB4,
+    0x5E1C3D753D46D260, 0x1CECDC9E94ACE4F3, 0xDBFDFEA26E92BF46, 0x990D1F49C77889D5, 0x172F5B3033043EBF,
+    0x55DFBADB9AEE082C, 0x92CE98E760D05399, 0xD03E790CC93A650A, 0xAA478900B1228E31, 0xE8B768EB18C8B8A2,
+    0x2FA64AD7E2F6E317, 0x6D56AB3C4B1CD584, 0xE374EF45BF6062EE, 0xA1840EAE168A547D, 0x66952C92ECB40FC8,
+    0x2465CD79455E395B, 0x3821458AADA7578F, 0x7AD1A461044D611C, 0xBDC0865DFE733AA9, 0xFF3067B657990C3A,
+    0x711223CFA3E5BB50, 0x33E2C2240A0F8DC3, 0xF4F3E018F031D676, 0xB60301F359DBE0E5, 0xDA050215EA6C212F,
+    0x98F5E3FE438617BC, 0x5FE4C1C2B9B84C09, 0x1D14202910527A9A, 0x93366450E42ECDF0, 0xD1C685BB4DC4FB63,
+    0x16D7A787B7FAA0D6, 0x5427466C1E109645, 0x4863CE9FF6E9F891, 0x0A932F745F03CE02, 0xCD820D48A53D95B7,
+    0x8F72ECA30CD7A324, 0x0150A8DAF8AB144E, 0x43A04931514122DD, 0x84B16B0DAB7F7968, 0xC6418AE602954FFB,
+    0xBC387AEA7A8DA4C0, 0xFEC89B01D3679253, 0x39D9B93D2959C9E6, 0x7B2958D680B3FF75, 0xF50B1CAF74CF481F,
+    0xB7FBFD44DD257E8C, 0x70EADF78271B2539, 0x321A3E938EF113AA, 0x2E5EB66066087D7E, 0x6CAE578BCFE24BED,
+    0xABBF75B735DC1058, 0xE94F945C9C3626CB, 0x676DD025684A91A1, 0x259D31CEC1A0A732, 0xE28C13F23B9EFC87,
+    0xA07CF2199274CA14, 0x167FF3EACBAF2AF1, 0x548F120162451C62, 0x939E303D987B47D7, 0xD16ED1D631917144,
+    0x5F4C95AFC5EDC62E, 0x1DBC74446C07F0BD, 0xDAAD56789639AB08, 0x985DB7933FD39D9B, 0x84193F60D72AF34F,
+    0xC6E9DE8B7EC0C5DC, 0x01F8FCB784FE9E69, 0x43081D5C2D14A8FA, 0xCD2A5925D9681F90, 0x8FDAB8CE70822903,
+    0x48CB9AF28ABC72B6, 0x0A3B7B1923564425, 0x70428B155B4EAF1E, 0x32B26AFEF2A4998D, 0xF5A348C2089AC238,
+    0xB753A929A170F4AB, 0x3971ED50550C43C1, 0x7B810CBBFCE67552, 0xBC902E8706D82EE7, 0xFE60CF6CAF321874,
+    0xE224479F47CB76A0, 0xA0D4A674EE214033, 0x67C58448141F1B86, 0x253565A3BDF52D15, 0xAB1721DA49899A7F,
+    0xE9E7C031E063ACEC, 0x2EF6E20D1A5DF759, 0x6C0603E6B3B7C1CA, 0xF6FAE5C07D3274CD, 0xB40A042BD4D8425E,
+    0x731B26172EE619EB, 0x31EBC7FC870C2F78, 0xBFC9838573709812, 0xFD39626EDA9AAE81, 0x3A28405220A4F534,
+    0x78D8A1B9894EC3A7, 0x649C294A61B7AD73, 0x266CC8A1C85D9BE0, 0xE17DEA9D3263C055, 0xA38D0B769B89F6C6,
+    0x2DAF4F0F6FF541AC, 0x6F5FAEE4C61F773F, 0xA84E8CD83C212C8A, 0xEABE6D3395CB1A19, 0x90C79D3FEDD3F122,
+    0xD2377CD44439C7B1, 0x15265EE8BE079C04, 0x57D6BF0317EDAA97, 0xD9F4FB7AE3911DFD, 0x9B041A914A7B2B6E,
+    0x5C1538ADB04570DB, 0x1EE5D94619AF4648, 0x02A151B5F156289C, 0x4051B05E58BC1E0F, 0x87409262A28245BA,
+    0xC5B073890B687329, 0x4B9237F0FF14C443, 0x0962D61B56FEF2D0, 0xCE73F427ACC0A965, 0x8C8315CC052A9FF6,
+    0x3A80143F5CF17F13, 0x7870F5D4F51B4980, 0xBF61D7E80F251235, 0xFD913603A6CF24A6, 0x73B3727A52B393CC,
+    0x31439391FB59A55F, 0xF652B1AD0167FEEA, 0xB4A25046A88DC879, 0xA8E6D8B54074A6AD, 0xEA16395EE99E903E,
+    0x2D071B6213A0CB8B, 0x6FF7FA89BA4AFD18, 0xE1D5BEF04E364A72, 0xA3255F1BE7DC7CE1, 0x64347D271DE22754,
+    0x26C49CCCB40811C7, 0x5CBD6CC0CC10FAFC, 0x1E4D8D2B65FACC6F, 0xD95CAF179FC497DA, 0x9BAC4EFC362EA149,
+    0x158E0A85C2521623, 0x577EEB6E6BB820B0, 0x906FC95291867B05, 0xD29F28B9386C4D96, 0xCEDBA04AD0952342,
+    0x8C2B41A1797F15D1, 0x4B3A639D83414E64, 0x09CA82762AAB78F7, 0x87E8C60FDED7CF9D, 0xC51827E4773DF90E,
+    0x020905D88D03A2BB, 0x40F9E43324E99428, 0x2CFFE7D5975E55E2, 0x6E0F063E3EB46371, 0xA91E2402C48A38C4,
+    0xEBEEC5E96D600E57, 0x65CC8190991CB93D, 0x273C607B30F68FAE, 0xE02D4247CAC8D41B, 0xA2DDA3AC6322E288,
+    0xBE992B5F8BDB8C5C, 0xFC69CAB42231BACF, 0x3B78E888D80FE17A, 0x7988096371E5D7E9, 0xF7AA4D1A85996083,
+    0xB55AACF12C735610, 0x724B8ECDD64D0DA5, 0x30BB6F267FA73B36, 0x4AC29F2A07BFD00D, 0x08327EC1AE55E69E,
+    0xCF235CFD546BBD2B, 0x8DD3BD16FD818BB8, 0x03F1F96F09FD3CD2, 0x41011884A0170A41, 0x86103AB85A2951F4,
+    0xC4E0DB53F3C36767, 0xD8A453A01B3A09B3, 0x9A54B24BB2D03F20, 0x5D45907748EE6495, 0x1FB5719CE1045206,
+    0x919735E51578E56C, 0xD367D40EBC92D3FF, 0x1476F63246AC884A, 0x568617D9EF46BED9, 0xE085162AB69D5E3C,
+    0xA275F7C11F7768AF, 0x6564D5FDE549331A, 0x279434164CA30589, 0xA9B6706FB8DFB2E3, 0xEB46918411358470,
+    0x2C57B3B8EB0BDFC5, 0x6EA7525342E1E956, 0x72E3DAA0AA188782, 0x30133B4B03F2B111, 0xF7021977F9CCEAA4,
+    0xB5F2F89C5026DC37, 0x3BD0BCE5A45A6B5D, 0x79205D0E0DB05DCE, 0xBE317F32F78E067B, 0xFCC19ED95E6430E8,
+    0x86B86ED5267CDBD3, 0xC4488F3E8F96ED40, 0x0359AD0275A8B6F5, 0x41A94CE9DC428066, 0xCF8B0890283E370C,
+    0x8D7BE97B81D4019F, 0x4A6ACB477BEA5A2A, 0x089A2AACD2006CB9, 0x14DEA25F3AF9026D, 0x562E43B4931334FE,
+    0x913F6188692D6F4B, 0xD3CF8063C0C759D8, 0x5DEDC41A34BBEEB2, 0x1F1D25F19D51D821, 0xD80C07CD676F8394,
+    0x9AFCE626CE85B507,
+};
+
+static const uint64_t _slice_table_crc64_ecma[1792] = {
+    0x0000000000000000, 0xAF052A6B538EDF09, 0x1CFAB53D0EF78881, 0xB3FF9F565D795788, 0x39F56A7A1DEF1102,
+    0x96F040114E61CE0B, 0x250FDF4713189983, 0x8A0AF52C4096468A, 0x73EAD4F43BDE2204, 0xDCEFFE9F6850FD0D,
+    0x6F1061C93529AA85, 0xC0154BA266A7758C, 0x4A1FBE8E26313306, 0xE51A94E575BFEC0F, 0x56E50BB328C6BB87,
+    0xF9E021D87B48648E, 0xE7D5A9E877BC4408, 0x48D0838324329B01, 0xFB2F1CD5794BCC89, 0x542A36BE2AC51380,
+    0xDE20C3926A53550A, 0x7125E9F939DD8A03, 0xC2DA76AF64A4DD8B, 0x6DDF5CC4372A0282, 0x943F7D1C4C62660C,
+    0x3B3A57771FECB905, 0x88C5C8214295EE8D, 0x27C0E24A111B3184, 0xADCA1766518D770E, 0x02CF3D0D0203A807,
+    0xB130A25B5F7AFF8F, 0x1E3588300CF42086, 0x8D5BB23B4692BE83, 0x225E9850151C618A, 0x91A1070648653602,
+    0x3EA42D6D1BEBE90B, 0xB4AED8415B7DAF81, 0x1BABF22A08F37088, 0xA8546D7C558A2700, 0x075147170604F809,
+    0xFEB166CF7D4C9C87, 0x51B44CA42EC2438E, 0xE24BD3F273BB1406, 0x4D4EF9992035CB0F, 0xC7440CB560A38D85,
+    0x684126DE332D528C, 0xDBBEB9886E540504, 0x74BB93E33DDADA0D, 0x6A8E1BD3312EFA8B, 0xC58B31B862A02582,
+    0x7674AEEE3FD9720A, 0xD97184856C57AD03, 0x537B71A92CC1EB89, 0xFC7E5BC27F4F3480, 0x4F81C49422366308,
+    0xE084EEFF71B8BC01, 0x1964CF270AF0D88F, 0xB661E54C597E0786, 0x059E7A1A0407500E, 0xAA9B507157898F07,
+    0x2091A55D171FC98D, 0x8F948F3644911684, 0x3C6B106019E8410C, 0x936E3A0B4A669E05, 0x5847859D24CF4B95,
+    0xF742AFF67741949C, 0x44BD30A02A38C314, 0xEBB81ACB79B61C1D, 0x61B2EFE739205A97, 0xCEB7C58C6AAE859E,
+    0x7D485ADA37D7D216, 0xD24D70B164590D1F, 0x2BAD51691F116991, 0x84A87B024C9FB698, 0x3757E45411E6E110,
+    0x9852CE3F42683E19, 0x12583B1302FE7893, 0xBD5D11785170A79A, 0x0EA28E2E0C09F012, 0xA1A7A4455F872F1B,
+    0xBF922C7553730F9D, 0x1097061E00FDD094, 0xA36899485D84871C, 0x0C6DB3230E0A5815, 0x8667460F4E9C1E9F,
+    0x29626C641D12C196, 0x9A9DF332406B961E, 0x3598D95913E54917, 0xCC78F88168AD2D99, 0x637DD2EA3B23F290,
+    0xD0824DBC665AA518, 0x7F8767D735D47A11, 0xF58D92FB75423C9B, 0x5A88B89026CCE392, 0xE97727C67BB5B41A,
+    0x46720DAD283B6B13, 0xD51C37A6625DF516, 0x7A191DCD31D32A1F, 0xC9E6829B6CAA7D97, 0x66E3A8F03F24A29E,
+    0xECE95DDC7FB2E414, 0x43EC77B72C3C3B1D, 0xF013E8E171456C95, 0x5F16C28A22CBB39C, 0xA6F6E3525983D712,
+    0x09F3C9390A0D081B, 0xBA0C566F57745F93, 0x15097C0404FA809A, 0x9F038928446CC610, 0x3006A34317E21919,
+    0x83F93C154A9B4E91, 0x2CFC167E19159198, 0x32C99E4E15E1B11E, 0x9DCCB425466F6E17, 0x2E332B731B16399F,
+    0x813601184898E696, 0x0B3CF434080EA01C, 0xA439DE5F5B807F15, 0x17C6410906F9289D, 0xB8C36B625577F794,
+    0x41234ABA2E3F931A, 0xEE2660D17DB14C13, 0x5DD9FF8720C81B9B, 0xF2DCD5EC7346C492, 0x78D620C033D08218,
+    0xD7D30AAB605E5D11, 0x642C95FD3D270A99, 0xCB29BF966EA9D590, 0xB08F0B3A499E972A, 0x1F8A21511A104823,
+    0xAC75BE0747691FAB, 0x0370946C14E7C0A2, 0x897A614054718628, 0x267F4B2B07FF5921, 0x9580D47D5A860EA9,
+    0x3A85FE160908D1A0, 0xC365DFCE7240B52E, 0x6C60F5A521CE6A27, 0xDF9F6AF37CB73DAF, 0x709A40982F39E2A6,
+    0xFA90B5B46FAFA42C, 0x55959FDF3C217B25, 0xE66A008961582CAD, 0x496F2AE232D6F3A4, 0x575AA2D23E22D322,
+    0xF85F88B96DAC0C2B, 0x4BA017EF30D55BA3, 0xE4A53D84635B84AA, 0x6EAFC8A823CDC220, 0xC1AAE2C370431D29,
+    0x72557D952D3A4AA1, 0xDD5057FE7EB495A8, 0x24B0762605FCF126, 0x8BB55C4D56722E2F, 0x384AC31B0B0B79A7,
+    0x974FE9705885A6AE, 0x1D451C5C1813E024, 0xB24036374B9D3F2D, 0x01BFA96116E468A5, 0xAEBA830A456AB7AC,
+    0x3DD4B9010F0C29A9, 0x92D1936A5C82F6A0, 0x212E0C3C01FBA128, 0x8E2B265752757E21, 0x0421D37B12E338AB,
+    0xAB24F910416DE7A2, 0x18DB66461C14B02A, 0xB7DE4C2D4F9A6F23, 0x4E3E6DF534D20BAD, 0xE13B479E675CD4A4,
+    0x52C4D8C83A25832C, 0xFDC1F2A369AB5C25, 0x77CB078F293D1AAF, 0xD8CE2DE47AB3C5A6, 0x6B31B2B227CA922E,
+    0xC43498D974444D27, 0xDA0110E978B06DA1, 0x75043A822B3EB2A8, 0xC6FBA5D47647E520, 0x69FE8FBF25C93A29,
+    0xE3F47A93655F7CA3, 0x4CF150F836D1A3AA, 0xFF0ECFAE6BA8F422, 0x500BE5C538262B2B, 0xA9EBC41D436E4FA5,
+    0x06EEEE7610E090AC, 0xB51171204D99C724, 0x1A145B4B1E17182D, 0x901EAE675E815EA7, 0x3F1B840C0D0F81AE,
+    0x8CE41B5A5076D626, 0x23E1313103F8092F, 0xE8C88EA76D51DCBF, 0x47CDA4CC3EDF03B6, 0xF4323B9A63A6543E,
+    0x5B3711F130288B37, 0xD13DE4DD70BECDBD, 0x7E38CEB6233012B4, 0xCDC751E07E49453C, 0x62C27B8B2DC79A35,
+    0x9B225A53568FFEBB, 0x34277038050121B2, 0x87D8EF6E5878763A, 0x28DDC5050BF6A933, 0xA2D730294B60EFB9,
+    0x0DD21A4218EE30B0, 0xBE2D851445976738, 0x1128AF7F1619B831, 0x0F1D274F1AED98B7, 0xA0180D24496347BE,
+    0x13E79272141A1036, 0xBCE2B8194794CF3F, 0x36E84D35070289B5, 0x99ED675E548C56BC, 0x2A12F80809F50134,
+    0x8517D2635A7BDE3D, 0x7CF7F3BB2133BAB3, 0xD3F2D9D072BD65BA, 0x600D46862FC43232, 0xCF086CED7C4AED3B,
+    0x450299C13CDCABB1, 0xEA07B3AA6F5274B8, 0x59F82CFC322B2330, 0xF6FD069761A5FC39, 0x65933C9C2BC3623C,
+    0xCA9616F7784DBD35, 0x796989A12534EABD, 0xD66CA3CA76BA35B4, 0x5C6656E6362C733E, 0xF3637C8D65A2AC37,
+    0x409CE3DB38DBFBBF, 0xEF99C9B06B5524B6, 0x1679E868101D4038, 0xB97CC20343939F31, 0x0A835D551EEAC8B9,
+    0xA586773E4D6417B0, 0x2F8C82120DF2513A, 0x8089A8795E7C8E33, 0x3376372F0305D9BB, 0x9C731D44508B06B2,
+    0x824695745C7F2634, 0x2D43BF1F0FF1F93D, 0x9EBC20495288AEB5, 0x31B90A22010671BC, 0xBBB3FF0E41903736,
+    0x14B6D565121EE83F, 0xA7494A334F67BFB7, 0x084C60581CE960BE, 0xF1AC418067A10430, 0x5EA96BEB342FDB39,
+    0xED56F4BD69568CB1, 0x4253DED63AD853B8, 0xC8592BFA7A4E1532, 0x675C019129C0CA3B, 0xD4A39EC774B99DB3,
+    0x7BA6B4AC273742BA, 0x0000000000000000, 0x23EEF79F3AD718C7, 0x47DDEF3E75AE318E, 0x643318A14F792949,
+    0x8FBBDE7CEB5C631C, 0xAC5529E3D18B7BDB, 0xC86631429EF25292, 0xEB88C6DDA4254A55, 0x5D875D127F52F0AB,
+    0x7E69AA8D4585E86C, 0x1A5AB22C0AFCC125, 0x39B445B3302BD9E2, 0xD23C836E940E93B7, 0xF1D274F1AED98B70,
+    0x95E16C50E1A0A239, 0xB60F9BCFDB77BAFE, 0xBB0EBA24FEA5E156, 0x98E04DBBC472F991, 0xFCD3551A8B0BD0D8,
+    0xDF3DA285B1DCC81F, 0x34B5645815F9824A, 0x175B93C72F2E9A8D, 0x73688B666057B3C4, 0x50867CF95A80AB03,
+    0xE689E73681F711FD, 0xC56710A9BB20093A, 0xA1540808F4592073, 0x82BAFF97CE8E38B4, 0x6932394A6AAB72E1,
+    0x4ADCCED5507C6A26, 0x2EEFD6741F05436F, 0x0D0121EB25D25BA8, 0x34ED95A254A1F43F, 0x1703623D6E76ECF8,
+    0x73307A9C210FC5B1, 0x50DE8D031BD8DD76, 0xBB564BDEBFFD9723, 0x98B8BC41852A8FE4, 0xFC8BA4E0CA53A6AD,
+    0xDF65537FF084BE6A, 0x696AC8B02BF30494, 0x4A843F2F11241C53, 0x2EB7278E5E5D351A, 0x0D59D011648A2DDD,
+    0xE6D116CCC0AF6788, 0xC53FE153FA787F4F, 0xA10CF9F2B5015606, 0x82E20E6D8FD64EC1, 0x8FE32F86AA041569,
+    0xAC0DD81990D30DAE, 0xC83EC0B8DFAA24E7, 0xEBD03727E57D3C20, 0x0058F1FA41587675, 0x23B606657B8F6EB2,
+    0x47851EC434F647FB, 0x646BE95B0E215F3C, 0xD2647294D556E5C2, 0xF18A850BEF81FD05, 0x95B99DAAA0F8D44C,
+    0xB6576A359A2FCC8B, 0x5DDFACE83E0A86DE, 0x7E315B7704DD9E19, 0x1A0243D64BA4B750, 0x39ECB4497173AF97,
+    0x69DB2B44A943E87E, 0x4A35DCDB9394F0B9, 0x2E06C47ADCEDD9F0, 0x0DE833E5E63AC137, 0xE660F538421F8B62,
+    0xC58E02A778C893A5, 0xA1BD1A0637B1BAEC, 0x8253ED990D66A22B, 0x345C7656D61118D5, 0x17B281C9ECC60012,
+    0x73819968A3BF295B, 0x506F6EF79968319C, 0xBBE7A82A3D4D7BC9, 0x98095FB5079A630E, 0xFC3A471448E34A47,
+    0xDFD4B08B72345280, 0xD2D5916057E60928, 0xF13B66FF6D3111EF, 0x95087E5E224838A6, 0xB6E689C1189F2061,
+    0x5D6E4F1CBCBA6A34, 0x7E80B883866D72F3, 0x1AB3A022C9145BBA, 0x395D57BDF3C3437D, 0x8F52CC7228B4F983,
+    0xACBC3BED1263E144, 0xC88F234C5D1AC80D, 0xEB61D4D367CDD0CA, 0x00E9120EC3E89A9F, 0x2307E591F93F8258,
+    0x4734FD30B646AB11, 0x64DA0AAF8C91B3D6, 0x5D36BEE6FDE21C41, 0x7ED84979C7350486, 0x1AEB51D8884C2DCF,
+    0x3905A647B29B3508, 0xD28D609A16BE7F5D, 0xF16397052C69679A, 0x95508FA463104ED3, 0xB6BE783B59C75614,
+    0x00B1E3F482B0ECEA, 0x235F146BB867F42D, 0x476C0CCAF71EDD64, 0x6482FB55CDC9C5A3, 0x8F0A3D8869EC8FF6,
+    0xACE4CA17533B9731, 0xC8D7D2B61C42BE78, 0xEB3925292695A6BF, 0xE63804C20347FD17, 0xC5D6F35D3990E5D0,
+    0xA1E5EBFC76E9CC99, 0x820B1C634C3ED45E, 0x6983DABEE81B9E0B, 0x4A6D2D21D2CC86CC, 0x2E5E35809DB5AF85,
+    0x0DB0C21FA762B742, 0xBBBF59D07C150DBC, 0x9851AE4F46C2157B, 0xFC62B6EE09BB3C32, 0xDF8C4171336C24F5,
+    0x340487AC97496EA0, 0x17EA7033AD9E7667, 0x73D96892E2E75F2E, 0x50379F0DD83047E9, 0xD3B656895287D0FC,
+    0xF058A1166850C83B, 0x946BB9B72729E172, 0xB7854E281DFEF9B5, 0x5C0D88F5B9DBB3E0, 0x7FE37F6A830CAB27,
+    0x1BD067CBCC75826E, 0x383E9054F6A29AA9, 0x8E310B9B2DD52057, 0xADDFFC0417023890, 0xC9ECE4A5587B11D9,
+    0xEA02133A62AC091E, 0x018AD5E7C689434B, 0x22642278FC5E5B8C, 0x46573AD9B32772C5, 0x65B9CD4689F06A02,
+    0x68B8ECADAC2231AA, 0x4B561B3296F5296D, 0x2F650393D98C0024, 0x0C8BF40CE35B18E3, 0xE70332D1477E52B6,
+    0xC4EDC54E7DA94A71, 0xA0DEDDEF32D06338, 0x83302A7008077BFF, 0x353FB1BFD370C101, 0x16D14620E9A7D9C6,
+    0x72E25E81A6DEF08F, 0x510CA91E9C09E848, 0xBA846FC3382CA21D, 0x996A985C02FBBADA, 0xFD5980FD4D829393,
+    0xDEB7776277558B54, 0xE75BC32B062624C3, 0xC4B534B43CF13C04, 0xA0862C157388154D, 0x8368DB8A495F0D8A,
+    0x68E01D57ED7A47DF, 0x4B0EEAC8D7AD5F18, 0x2F3DF26998D47651, 0x0CD305F6A2036E96, 0xBADC9E397974D468,
+    0x993269A643A3CCAF, 0xFD0171070CDAE5E6, 0xDEEF8698360DFD21, 0x356740459228B774, 0x1689B7DAA8FFAFB3,
+    0x72BAAF7BE78686FA, 0x515458E4DD519E3D, 0x5C55790FF883C595, 0x7FBB8E90C254DD52, 0x1B8896318D2DF41B,
+    0x386661AEB7FAECDC, 0xD3EEA77313DFA689, 0xF00050EC2908BE4E, 0x9433484D66719707, 0xB7DDBFD25CA68FC0,
+    0x01D2241D87D1353E, 0x223CD382BD062DF9, 0x460FCB23F27F04B0, 0x65E13CBCC8A81C77, 0x8E69FA616C8D5622,
+    0xAD870DFE565A4EE5, 0xC9B4155F192367AC, 0xEA5AE2C023F47F6B, 0xBA6D7DCDFBC43882, 0x99838A52C1132045,
+    0xFDB092F38E6A090C, 0xDE5E656CB4BD11CB, 0x35D6A3B110985B9E, 0x1638542E2A4F4359, 0x720B4C8F65366A10,
+    0x51E5BB105FE172D7, 0xE7EA20DF8496C829, 0xC404D740BE41D0EE, 0xA037CFE1F138F9A7, 0x83D9387ECBEFE160,
+    0x6851FEA36FCAAB35, 0x4BBF093C551DB3F2, 0x2F8C119D1A649ABB, 0x0C62E60220B3827C, 0x0163C7E90561D9D4,
+    0x228D30763FB6C113, 0x46BE28D770CFE85A, 0x6550DF484A18F09D, 0x8ED81995EE3DBAC8, 0xAD36EE0AD4EAA20F,
+    0xC905F6AB9B938B46, 0xEAEB0134A1449381, 0x5CE49AFB7A33297F, 0x7F0A6D6440E431B8, 0x1B3975C50F9D18F1,
+    0x38D7825A354A0036, 0xD35F4487916F4A63, 0xF0B1B318ABB852A4, 0x9482ABB9E4C17BED, 0xB76C5C26DE16632A,
+    0x8E80E86FAF65CCBD, 0xAD6E1FF095B2D47A, 0xC95D0751DACBFD33, 0xEAB3F0CEE01CE5F4, 0x013B36134439AFA1,
+    0x22D5C18C7EEEB766, 0x46E6D92D31979E2F, 0x65082EB20B4086E8, 0xD307B57DD0373C16, 0xF0E942E2EAE024D1,
+    0x94DA5A43A5990D98, 0xB734ADDC9F4E155F, 0x5CBC6B013B6B5F0A, 0x7F529C9E01BC47CD, 0x1B61843F4EC56E84,
+    0x388F73A074127643, 0x358E524B51C02DEB, 0x1660A5D46B17352C, 0x7253BD75246E1C65, 0x51BD4AEA1EB904A2,
+    0xBA358C37BA9C4EF7, 0x99DB7BA8804B5630, 0xFDE86309CF327F79, 0xDE069496F5E567BE, 0x68090F592E92DD40,
+    0x4BE7F8C61445C587, 0x2FD4E0675B3CECCE, 0x0C3A17F861EBF409, 0xE7B2D125C5CEBE5C, 0xC45C26BAFF19A69B,
+    0xA06F3E1BB0608FD2, 0x8381C9848AB79715, 0x0000000000000000, 0xE59C4CF90CE5976B, 0x89C87819B0211845,
+    0x6C5434E0BCC48F2E, 0x516011D8C9A80619, 0xB4FC5D21C54D9172, 0xD8A869C179891E5C, 0x3D342538756C8937,
+    0xA2C023B193500C32, 0x475C6F489FB59B59, 0x2B085BA823711477, 0xCE9417512F94831C, 0xF3A032695AF80A2B,
+    0x163C7E90561D9D40, 0x7A684A70EAD9126E, 0x9FF40689E63C8505, 0x0770A6888F4A2EF7, 0xE2ECEA7183AFB99C,
+    0x8EB8DE913F6B36B2, 0x6B249268338EA1D9, 0x5610B75046E228EE, 0xB38CFBA94A07BF85, 0xDFD8CF49F6C330AB,
+    0x3A4483B0FA26A7C0, 0xA5B085391C1A22C5, 0x402CC9C010FFB5AE, 0x2C78FD20AC3B3A80, 0xC9E4B1D9A0DEADEB,
+    0xF4D094E1D5B224DC, 0x114CD818D957B3B7, 0x7D18ECF865933C99, 0x9884A0016976ABF2, 0x0EE14D111E945DEE,
+    0xEB7D01E81271CA85, 0x87293508AEB545AB, 0x62B579F1A250D2C0, 0x5F815CC9D73C5BF7, 0xBA1D1030DBD9CC9C,
+    0xD64924D0671D43B2, 0x33D568296BF8D4D9, 0xAC216EA08DC451DC, 0x49BD22598121C6B7, 0x25E916B93DE54999,
+    0xC0755A403100DEF2, 0xFD417F78446C57C5, 0x18DD33814889C0AE, 0x74890761F44D4F80, 0x91154B98F8A8D8EB,
+    0x0991EB9991DE7319, 0xEC0DA7609D3BE472, 0x8059938021FF6B5C, 0x65C5DF792D1AFC37, 0x58F1FA4158767500,
+    0xBD6DB6B85493E26B, 0xD1398258E8576D45, 0x34A5CEA1E4B2FA2E, 0xAB51C828028E7F2B, 0x4ECD84D10E6BE840,
+    0x2299B031B2AF676E, 0xC705FCC8BE4AF005, 0xFA31D9F0CB267932, 0x1FAD9509C7C3EE59, 0x73F9A1E97B076177,
+    0x9665ED1077E2F61C, 0x1DC29A223D28BBDC, 0xF85ED6DB31CD2CB7, 0x940AE23B8D09A399, 0x7196AEC281EC34F2,
+    0x4CA28BFAF480BDC5, 0xA93EC703F8652AAE, 0xC56AF3E344A1A580, 0x20F6BF1A484432EB, 0xBF02B993AE78B7EE,
+    0x5A9EF56AA29D2085, 0x36CAC18A1E59AFAB, 0xD3568D7312BC38C0, 0xEE62A84B67D0B1F7, 0x0BFEE4B26B35269C,
+    0x67AAD052D7F1A9B2, 0x82369CABDB143ED9, 0x1AB23CAAB262952B, 0xFF2E7053BE870240, 0x937A44B302438D6E,
+    0x76E6084A0EA61A05, 0x4BD22D727BCA9332, 0xAE4E618B772F0459, 0xC21A556BCBEB8B77, 0x27861992C70E1C1C,
+    0xB8721F1B21329919, 0x5DEE53E22DD70E72, 0x31BA67029113815C, 0xD4262BFB9DF61637, 0xE9120EC3E89A9F00,
+    0x0C8E423AE47F086B, 0x60DA76DA58BB8745, 0x85463A23545E102E, 0x1323D73323BCE632, 0xF6BF9BCA2F597159,
+    0x9AEBAF2A939DFE77, 0x7F77E3D39F78691C, 0x4243C6EBEA14E02B, 0xA7DF8A12E6F17740, 0xCB8BBEF25A35F86E,
+    0x2E17F20B56D06F05, 0xB1E3F482B0ECEA00, 0x547FB87BBC097D6B, 0x382B8C9B00CDF245, 0xDDB7C0620C28652E,
+    0xE083E55A7944EC19, 0x051FA9A375A17B72, 0x694B9D43C965F45C, 0x8CD7D1BAC5806337, 0x145371BBACF6C8C5,
+    0xF1CF3D42A0135FAE, 0x9D9B09A21CD7D080, 0x7807455B103247EB, 0x45336063655ECEDC, 0xA0AF2C9A69BB59B7,
+    0xCCFB187AD57FD699, 0x29675483D99A41F2, 0xB693520A3FA6C4F7, 0x530F1EF33343539C, 0x3F5B2A138F87DCB2,
+    0xDAC766EA83624BD9, 0xE7F343D2F60EC2EE, 0x026F0F2BFAEB5585, 0x6E3B3BCB462FDAAB, 0x8BA777324ACA4DC0,
+    0x3B8534447A5177B8, 0xDE1978BD76B4E0D3, 0xB24D4C5DCA706FFD, 0x57D100A4C695F896, 0x6AE5259CB3F971A1,
+    0x8F796965BF1CE6CA, 0xE32D5D8503D869E4, 0x06B1117C0F3DFE8F, 0x994517F5E9017B8A, 0x7CD95B0CE5E4ECE1,
+    0x108D6FEC592063CF, 0xF511231555C5F4A4, 0xC825062D20A97D93, 0x2DB94AD42C4CEAF8, 0x41ED7E34908865D6,
+    0xA47132CD9C6DF2BD, 0x3CF592CCF51B594F, 0xD969DE35F9FECE24, 0xB53DEAD5453A410A, 0x50A1A62C49DFD661,
+    0x6D9583143CB35F56, 0x8809CFED3056C83D, 0xE45DFB0D8C924713, 0x01C1B7F48077D078, 0x9E35B17D664B557D,
+    0x7BA9FD846AAEC216, 0x17FDC964D66A4D38, 0xF261859DDA8FDA53, 0xCF55A0A5AFE35364, 0x2AC9EC5CA306C40F,
+    0x469DD8BC1FC24B21, 0xA30194451327DC4A, 0x3564795564C52A56, 0xD0F835AC6820BD3D, 0xBCAC014CD4E43213,
+    0x59304DB5D801A578, 0x6404688DAD6D2C4F, 0x81982474A188BB24, 0xEDCC10941D4C340A, 0x08505C6D11A9A361,
+    0x97A45AE4F7952664, 0x7238161DFB70B10F, 0x1E6C22FD47B43E21, 0xFBF06E044B51A94A, 0xC6C44B3C3E3D207D,
+    0x235807C532D8B716, 0x4F0C33258E1C3838, 0xAA907FDC82F9AF53, 0x3214DFDDEB8F04A1, 0xD7889324E76A93CA,
+    0xBBDCA7C45BAE1CE4, 0x5E40EB3D574B8B8F, 0x6374CE05222702B8, 0x86E882FC2EC295D3, 0xEABCB61C92061AFD,
+    0x0F20FAE59EE38D96, 0x90D4FC6C78DF0893, 0x7548B095743A9FF8, 0x191C8475C8FE10D6, 0xFC80C88CC41B87BD,
+    0xC1B4EDB4B1770E8A, 0x2428A14DBD9299E1, 0x487C95AD015616CF, 0xADE0D9540DB381A4, 0x2647AE664779CC64,
+    0xC3DBE29F4B9C5B0F, 0xAF8FD67FF758D421, 0x4A139A86FBBD434A, 0x7727BFBE8ED1CA7D, 0x92BBF34782345D16,
+    0xFEEFC7A73EF0D238, 0x1B738B5E32154553, 0x84878DD7D429C056, 0x611BC12ED8CC573D, 0x0D4FF5CE6408D813,
+    0xE8D3B93768ED4F78, 0xD5E79C0F1D81C64F, 0x307BD0F611645124, 0x5C2FE416ADA0DE0A, 0xB9B3A8EFA1454961,
+    0x213708EEC833E293, 0xC4AB4417C4D675F8, 0xA8FF70F77812FAD6, 0x4D633C0E74F76DBD, 0x70571936019BE48A,
+    0x95CB55CF0D7E73E1, 0xF99F612FB1BAFCCF, 0x1C032DD6BD5F6BA4, 0x83F72B5F5B63EEA1, 0x666B67A6578679CA,
+    0x0A3F5346EB42F6E4, 0xEFA31FBFE7A7618F, 0xD2973A8792CBE8B8, 0x370B767E9E2E7FD3, 0x5B5F429E22EAF0FD,
+    0xBEC30E672E0F6796, 0x28A6E37759ED918A, 0xCD3AAF8E550806E1, 0xA16E9B6EE9CC89CF, 0x44F2D797E5291EA4,
+    0x79C6F2AF90459793, 0x9C5ABE569CA000F8, 0xF00E8AB620648FD6, 0x1592C64F2C8118BD, 0x8A66C0C6CABD9DB8,
+    0x6FFA8C3FC6580AD3, 0x03AEB8DF7A9C85FD, 0xE632F42676791296, 0xDB06D11E03159BA1, 0x3E9A9DE70FF00CCA,
+    0x52CEA907B33483E4, 0xB752E5FEBFD1148F, 0x2FD645FFD6A7BF7D, 0xCA4A0906DA422816, 0xA61E3DE66686A738,
+    0x4382711F6A633053, 0x7EB654271F0FB964, 0x9B2A18DE13EA2E0F, 0xF77E2C3EAF2EA121, 0x12E260C7A3CB364A,
+    0x8D16664E45F7B34F, 0x688A2AB749122424, 0x04DE1E57F5D6AB0A, 0xE14252AEF9333C61, 0xDC7677968C5FB556,
+    0x39EA3B6F80BA223D, 0x55BE0F8F3C7EAD13, 0xB0224376309B3A78, 0x0000000000000000, 0x770A6888F4A2EF70,
+    0xEE14D111E945DEE0, 0x991EB9991DE73190, 0x9ED943C87B618B53, 0xE9D32B408FC36423, 0x70CD92D9922455B3,
+    0x07C7FA516686BAC3, 0x7F42667B5F292035, 0x08480EF3AB8BCF45, 0x9156B76AB66CFED5, 0xE65CDFE242CE11A5,
+    0xE19B25B32448AB66, 0x96914D3BD0EA4416, 0x0F8FF4A2CD0D7586, 0x78859C2A39AF9AF6, 0xFE84CCF6BE52406A,
+    0x898EA47E4AF0AF1A, 0x10901DE757179E8A, 0x679A756FA3B571FA, 0x605D8F3EC533CB39, 0x1757E7B631912449,
+    0x8E495E2F2C7615D9, 0xF94336A7D8D4FAA9, 0x81C6AA8DE17B605F, 0xF6CCC20515D98F2F, 0x6FD27B9C083EBEBF,
+    0x18D81314FC9C51CF, 0x1F1FE9459A1AEB0C, 0x681581CD6EB8047C, 0xF10B3854735F35EC, 0x860150DC87FDDA9C,
+    0xBFF97806D54EB647, 0xC8F3108E21EC5937, 0x51EDA9173C0B68A7, 0x26E7C19FC8A987D7, 0x21203BCEAE2F3D14,
+    0x562A53465A8DD264, 0xCF34EADF476AE3F4, 0xB83E8257B3C80C84, 0xC0BB1E7D8A679672, 0xB7B176F57EC57902,
+    0x2EAFCF6C63224892, 0x59A5A7E49780A7E2, 0x5E625DB5F1061D21, 0x2968353D05A4F251, 0xB0768CA41843C3C1,
+    0xC77CE42CECE12CB1, 0x417DB4F06B1CF62D, 0x3677DC789FBE195D, 0xAF6965E1825928CD, 0xD8630D6976FBC7BD,
+    0xDFA4F738107D7D7E, 0xA8AE9FB0E4DF920E, 0x31B02629F938A39E, 0x46BA4EA10D9A4CEE, 0x3E3FD28B3435D618,
+    0x4935BA03C0973968, 0xD02B039ADD7008F8, 0xA7216B1229D2E788, 0xA0E691434F545D4B, 0xD7ECF9CBBBF6B23B,
+    0x4EF24052A61183AB, 0x39F828DA52B36CDB, 0x3D0211E603775A1D, 0x4A08796EF7D5B56D, 0xD316C0F7EA3284FD,
+    0xA41CA87F1E906B8D, 0xA3DB522E7816D14E, 0xD4D13AA68CB43E3E, 0x4DCF833F91530FAE, 0x3AC5EBB765F1E0DE,
+    0x4240779D5C5E7A28, 0x354A1F15A8FC9558, 0xAC54A68CB51BA4C8, 0xDB5ECE0441B94BB8, 0xDC993455273FF17B,
+    0xAB935CDDD39D1E0B, 0x328DE544CE7A2F9B, 0x45878DCC3AD8C0EB, 0xC386DD10BD251A77, 0xB48CB5984987F507,
+    0x2D920C015460C497, 0x5A986489A0C22BE7, 0x5D5F9ED8C6449124, 0x2A55F65032E67E54, 0xB34B4FC92F014FC4,
+    0xC4412741DBA3A0B4, 0xBCC4BB6BE20C3A42, 0xCBCED3E316AED532, 0x52D06A7A0B49E4A2, 0x25DA02F2FFEB0BD2,
+    0x221DF8A3996DB111, 0x5517902B6DCF5E61, 0xCC0929B270286FF1, 0xBB03413A848A8081, 0x82FB69E0D639EC5A,
+    0xF5F10168229B032A, 0x6CEFB8F13F7C32BA, 0x1BE5D079CBDEDDCA, 0x1C222A28AD586709, 0x6B2842A059FA8879,
+    0xF236FB39441DB9E9, 0x853C93B1B0BF5699, 0xFDB90F9B8910CC6F, 0x8AB367137DB2231F, 0x13ADDE8A6055128F,
+    0x64A7B60294F7FDFF, 0x63604C53F271473C, 0x146A24DB06D3A84C, 0x8D749D421B3499DC, 0xFA7EF5CAEF9676AC,
+    0x7C7FA516686BAC30, 0x0B75CD9E9CC94340, 0x926B7407812E72D0, 0xE5611C8F758C9DA0, 0xE2A6E6DE130A2763,
+    0x95AC8E56E7A8C813, 0x0CB237CFFA4FF983, 0x7BB85F470EED16F3, 0x033DC36D37428C05, 0x7437ABE5C3E06375,
+    0xED29127CDE0752E5, 0x9A237AF42AA5BD95, 0x9DE480A54C230756, 0xEAEEE82DB881E826, 0x73F051B4A566D9B6,
+    0x04FA393C51C436C6, 0x7A0423CC06EEB43A, 0x0D0E4B44F24C5B4A, 0x9410F2DDEFAB6ADA, 0xE31A9A551B0985AA,
+    0xE4DD60047D8F3F69, 0x93D7088C892DD019, 0x0AC9B11594CAE189, 0x7DC3D99D60680EF9, 0x054645B759C7940F,
+    0x724C2D3FAD657B7F, 0xEB5294A6B0824AEF, 0x9C58FC2E4420A59F, 0x9B9F067F22A61F5C, 0xEC956EF7D604F02C,
+    0x758BD76ECBE3C1BC, 0x0281BFE63F412ECC, 0x8480EF3AB8BCF450, 0xF38A87B24C1E1B20, 0x6A943E2B51F92AB0,
+    0x1D9E56A3A55BC5C0, 0x1A59ACF2C3DD7F03, 0x6D53C47A377F9073, 0xF44D7DE32A98A1E3, 0x8347156BDE3A4E93,
+    0xFBC28941E795D465, 0x8CC8E1C913373B15, 0x15D658500ED00A85, 0x62DC30D8FA72E5F5, 0x651BCA899CF45F36,
+    0x1211A2016856B046, 0x8B0F1B9875B181D6, 0xFC05731081136EA6, 0xC5FD5BCAD3A0027D, 0xB2F733422702ED0D,
+    0x2BE98ADB3AE5DC9D, 0x5CE3E253CE4733ED, 0x5B241802A8C1892E, 0x2C2E708A5C63665E, 0xB530C913418457CE,
+    0xC23AA19BB526B8BE, 0xBABF3DB18C892248, 0xCDB55539782BCD38, 0x54ABECA065CCFCA8, 0x23A18428916E13D8,
+    0x24667E79F7E8A91B, 0x536C16F1034A466B, 0xCA72AF681EAD77FB, 0xBD78C7E0EA0F988B, 0x3B79973C6DF24217,
+    0x4C73FFB49950AD67, 0xD56D462D84B79CF7, 0xA2672EA570157387, 0xA5A0D4F41693C944, 0xD2AABC7CE2312634,
+    0x4BB405E5FFD617A4, 0x3CBE6D6D0B74F8D4, 0x443BF14732DB6222, 0x333199CFC6798D52, 0xAA2F2056DB9EBCC2,
+    0xDD2548DE2F3C53B2, 0xDAE2B28F49BAE971, 0xADE8DA07BD180601, 0x34F6639EA0FF3791, 0x43FC0B16545DD8E1,
+    0x4706322A0599EE27, 0x300C5AA2F13B0157, 0xA912E33BECDC30C7, 0xDE188BB3187EDFB7, 0xD9DF71E27EF86574,
+    0xAED5196A8A5A8A04, 0x37CBA0F397BDBB94, 0x40C1C87B631F54E4, 0x384454515AB0CE12, 0x4F4E3CD9AE122162,
+    0xD6508540B3F510F2, 0xA15AEDC84757FF82, 0xA69D179921D14541, 0xD1977F11D573AA31, 0x4889C688C8949BA1,
+    0x3F83AE003C3674D1, 0xB982FEDCBBCBAE4D, 0xCE8896544F69413D, 0x57962FCD528E70AD, 0x209C4745A62C9FDD,
+    0x275BBD14C0AA251E, 0x5051D59C3408CA6E, 0xC94F6C0529EFFBFE, 0xBE45048DDD4D148E, 0xC6C098A7E4E28E78,
+    0xB1CAF02F10406108, 0x28D449B60DA75098, 0x5FDE213EF905BFE8, 0x5819DB6F9F83052B, 0x2F13B3E76B21EA5B,
+    0xB60D0A7E76C6DBCB, 0xC10762F6826434BB, 0xF8FF4A2CD0D75860, 0x8FF522A42475B710, 0x16EB9B3D39928680,
+    0x61E1F3B5CD3069F0, 0x662609E4ABB6D333, 0x112C616C5F143C43, 0x8832D8F542F30DD3, 0xFF38B07DB651E2A3,
+    0x87BD2C578FFE7855, 0xF0B744DF7B5C9725, 0x69A9FD4666BBA6B5, 0x1EA395CE921949C5, 0x19646F9FF49FF306,
+    0x6E6E0717003D1C76, 0xF770BE8E1DDA2DE6, 0x807AD606E978C296, 0x067B86DA6E85180A, 0x7171EE529A27F77A,
+    0xE86F57CB87C0C6EA, 0x9F653F437362299A, 0x98A2C51215E49359, 0xEFA8AD9AE1467C29, 0x76B61403FCA14DB9,
+    0x01BC7C8B0803A2C9, 0x7939E0A131AC383F, 0x0E338829C50ED74F, 0x972D31B0D8E9E6DF, 0xE02759382C4B09AF,
+    0xE7E0A3694ACDB36C, 0x90EACBE1BE6F5C1C, 0x09F47278A3886D8C, 0x7EFE1AF0572A82FC, 0x0000000000000000,
+    0xF40847980DDD6874, 0xAAE06EDBB250E67B, 0x5EE82943BF8D8E0F, 0x17303C5CCD4BFA65, 0xE3387BC4C0969211,
+    0xBDD052877F1B1C1E, 0x49D8151F72C6746A, 0x2E6078B99A97F4CA, 0xDA683F21974A9CBE, 0x8480166228C712B1,
+    0x708851FA251A7AC5, 0x395044E557DC0EAF, 0xCD58037D5A0166DB, 0x93B02A3EE58CE8D4, 0x67B86DA6E85180A0,
+    0x5CC0F173352FE994, 0xA8C8B6EB38F281E0, 0xF6209FA8877F0FEF, 0x0228D8308AA2679B, 0x4BF0CD2FF86413F1,
+    0xBFF88AB7F5B97B85, 0xE110A3F44A34F58A, 0x1518E46C47E99DFE, 0x72A089CAAFB81D5E, 0x86A8CE52A265752A,
+    0xD840E7111DE8FB25, 0x2C48A08910359351, 0x6590B59662F3E73B, 0x9198F20E6F2E8F4F, 0xCF70DB4DD0A30140,
+    0x3B789CD5DD7E6934, 0xB981E2E66A5FD328, 0x4D89A57E6782BB5C, 0x13618C3DD80F3553, 0xE769CBA5D5D25D27,
+    0xAEB1DEBAA714294D, 0x5AB99922AAC94139, 0x0451B0611544CF36, 0xF059F7F91899A742, 0x97E19A5FF0C827E2,
+    0x63E9DDC7FD154F96, 0x3D01F4844298C199, 0xC909B31C4F45A9ED, 0x80D1A6033D83DD87, 0x74D9E19B305EB5F3,
+    0x2A31C8D88FD33BFC, 0xDE398F40820E5388, 0xE54113955F703ABC, 0x1149540D52AD52C8, 0x4FA17D4EED20DCC7,
+    0xBBA93AD6E0FDB4B3, 0xF2712FC9923BC0D9, 0x067968519FE6A8AD, 0x58914112206B26A2, 0xAC99068A2DB64ED6,
+    0xCB216B2CC5E7CE76, 0x3F292CB4C83AA602, 0x61C105F777B7280D, 0x95C9426F7A6A4079, 0xDC11577008AC3413,
+    0x281910E805715C67, 0x76F139ABBAFCD268, 0x82F97E33B721BA1C, 0x31F324277D5590C3, 0xC5FB63BF7088F8B7,
+    0x9B134AFCCF0576B8, 0x6F1B0D64C2D81ECC, 0x26C3187BB01E6AA6, 0xD2CB5FE3BDC302D2, 0x8C2376A0024E8CDD,
+    0x782B31380F93E4A9, 0x1F935C9EE7C26409, 0xEB9B1B06EA1F0C7D, 0xB573324555928272, 0x417B75DD584FEA06,
+    0x08A360C22A899E6C, 0xFCAB275A2754F618, 0xA2430E1998D97817, 0x564B498195041063, 0x6D33D554487A7957,
+    0x993B92CC45A71123, 0xC7D3BB8FFA2A9F2C, 0x33DBFC17F7F7F758, 0x7A03E90885318332, 0x8E0BAE9088ECEB46,
+    0xD0E387D337616549, 0x24EBC04B3ABC0D3D, 0x4353ADEDD2ED8D9D, 0xB75BEA75DF30E5E9, 0xE9B3C33660BD6BE6,
+    0x1DBB84AE6D600392, 0x546391B11FA677F8, 0xA06BD629127B1F8C, 0xFE83FF6AADF69183, 0x0A8BB8F2A02BF9F7,
+    0x8872C6C1170A43EB, 0x7C7A81591AD72B9F, 0x2292A81AA55AA590, 0xD69AEF82A887CDE4, 0x9F42FA9DDA41B98E,
+    0x6B4ABD05D79CD1FA, 0x35A2944668115FF5, 0xC1AAD3DE65CC3781, 0xA612BE788D9DB721, 0x521AF9E08040DF55,
+    0x0CF2D0A33FCD515A, 0xF8FA973B3210392E, 0xB122822440D64D44, 0x452AC5BC4D0B2530, 0x1BC2ECFFF286AB3F,
+    0xEFCAAB67FF5BC34B, 0xD4B237B22225AA7F, 0x20BA702A2FF8C20B, 0x7E52596990754C04, 0x8A5A1EF19DA82470,
+    0xC3820BEEEF6E501A, 0x378A4C76E2B3386E, 0x696265355D3EB661, 0x9D6A22AD50E3DE15, 0xFAD24F0BB8B25EB5,
+    0x0EDA0893B56F36C1, 0x503221D00AE2B8CE, 0xA43A6648073FD0BA, 0xEDE2735775F9A4D0, 0x19EA34CF7824CCA4,
+    0x47021D8CC7A942AB, 0xB30A5A14CA742ADF, 0x63E6484EFAAB2186, 0x97EE0FD6F77649F2, 0xC906269548FBC7FD,
+    0x3D0E610D4526AF89, 0x74D6741237E0DBE3, 0x80DE338A3A3DB397, 0xDE361AC985B03D98, 0x2A3E5D51886D55EC,
+    0x4D8630F7603CD54C, 0xB98E776F6DE1BD38, 0xE7665E2CD26C3337, 0x136E19B4DFB15B43, 0x5AB60CABAD772F29,
+    0xAEBE4B33A0AA475D, 0xF05662701F27C952, 0x045E25E812FAA126, 0x3F26B93DCF84C812, 0xCB2EFEA5C259A066,
+    0x95C6D7E67DD42E69, 0x61CE907E7009461D, 0x2816856102CF3277, 0xDC1EC2F90F125A03, 0x82F6EBBAB09FD40C,
+    0x76FEAC22BD42BC78, 0x1146C18455133CD8, 0xE54E861C58CE54AC, 0xBBA6AF5FE743DAA3, 0x4FAEE8C7EA9EB2D7,
+    0x0676FDD89858C6BD, 0xF27EBA409585AEC9, 0xAC9693032A0820C6, 0x589ED49B27D548B2, 0xDA67AAA890F4F2AE,
+    0x2E6FED309D299ADA, 0x7087C47322A414D5, 0x848F83EB2F797CA1, 0xCD5796F45DBF08CB, 0x395FD16C506260BF,
+    0x67B7F82FEFEFEEB0, 0x93BFBFB7E23286C4, 0xF407D2110A630664, 0x000F958907BE6E10, 0x5EE7BCCAB833E01F,
+    0xAAEFFB52B5EE886B, 0xE337EE4DC728FC01, 0x173FA9D5CAF59475, 0x49D7809675781A7A, 0xBDDFC70E78A5720E,
+    0x86A75BDBA5DB1B3A, 0x72AF1C43A806734E, 0x2C473500178BFD41, 0xD84F72981A569535, 0x919767876890E15F,
+    0x659F201F654D892B, 0x3B77095CDAC00724, 0xCF7F4EC4D71D6F50, 0xA8C723623F4CEFF0, 0x5CCF64FA32918784,
+    0x02274DB98D1C098B, 0xF62F0A2180C161FF, 0xBFF71F3EF2071595, 0x4BFF58A6FFDA7DE1, 0x151771E54057F3EE,
+    0xE11F367D4D8A9B9A, 0x52156C6987FEB145, 0xA61D2BF18A23D931, 0xF8F502B235AE573E, 0x0CFD452A38733F4A,
+    0x452550354AB54B20, 0xB12D17AD47682354, 0xEFC53EEEF8E5AD5B, 0x1BCD7976F538C52F, 0x7C7514D01D69458F,
+    0x887D534810B42DFB, 0xD6957A0BAF39A3F4, 0x229D3D93A2E4CB80, 0x6B45288CD022BFEA, 0x9F4D6F14DDFFD79E,
+    0xC1A5465762725991, 0x35AD01CF6FAF31E5, 0x0ED59D1AB2D158D1, 0xFADDDA82BF0C30A5, 0xA435F3C10081BEAA,
+    0x503DB4590D5CD6DE, 0x19E5A1467F9AA2B4, 0xEDEDE6DE7247CAC0, 0xB305CF9DCDCA44CF, 0x470D8805C0172CBB,
+    0x20B5E5A32846AC1B, 0xD4BDA23B259BC46F, 0x8A558B789A164A60, 0x7E5DCCE097CB2214, 0x3785D9FFE50D567E,
+    0xC38D9E67E8D03E0A, 0x9D65B724575DB005, 0x696DF0BC5A80D871, 0xEB948E8FEDA1626D, 0x1F9CC917E07C0A19,
+    0x4174E0545FF18416, 0xB57CA7CC522CEC62, 0xFCA4B2D320EA9808, 0x08ACF54B2D37F07C, 0x5644DC0892BA7E73,
+    0xA24C9B909F671607, 0xC5F4F636773696A7, 0x31FCB1AE7AEBFED3, 0x6F1498EDC56670DC, 0x9B1CDF75C8BB18A8,
+    0xD2C4CA6ABA7D6CC2, 0x26CC8DF2B7A004B6, 0x7824A4B1082D8AB9, 0x8C2CE32905F0E2CD, 0xB7547FFCD88E8BF9,
+    0x435C3864D553E38D, 0x1DB411276ADE6D82, 0xE9BC56BF670305F6, 0xA06443A015C5719C, 0x546C0438181819E8,
+    0x0A842D7BA79597E7, 0xFE8C6AE3AA48FF93, 0x9934074542197F33, 0x6D3C40DD4FC41747, 0x33D4699EF0499948,
+    0xC7DC2E06FD94F13C, 0x8E043B198F528556, 0x7A0C7C81828FED22, 0x24E455C23D02632D, 0xD0EC125A30DF0B59,
+    0x0000000000000000, 0xC7CC909DF556430C, 0xCD69C0D04346B08B, 0x0AA5504DB610F387, 0xD823604B2F675785,
+    0x1FEFF0D6DA311489, 0x154AA09B6C21E70E, 0xD28630069977A402, 0xF2B6217DF7249999, 0x357AB1E00272DA95,
+    0x3FDFE1ADB4622912, 0xF813713041346A1E, 0x2A954136D843CE1C, 0xED59D1AB2D158D10, 0xE7FC81E69B057E97,
+    0x2030117B6E533D9B, 0xA79CA31047A305A1, 0x6050338DB2F546AD, 0x6AF563C004E5B52A, 0xAD39F35DF1B3F626,
+    0x7FBFC35B68C45224, 0xB87353C69D921128, 0xB2D6038B2B82E2AF, 0x751A9316DED4A1A3, 0x552A826DB0879C38,
+    0x92E612F045D1DF34, 0x984342BDF3C12CB3, 0x5F8FD22006976FBF, 0x8D09E2269FE0CBBD, 0x4AC572BB6AB688B1,
+    0x406022F6DCA67B36, 0x87ACB26B29F0383A, 0x0DC9A7CB26AC3DD1, 0xCA053756D3FA7EDD, 0xC0A0671B65EA8D5A,
+    0x076CF78690BCCE56, 0xD5EAC78009CB6A54, 0x1226571DFC9D2958, 0x188307504A8DDADF, 0xDF4F97CDBFDB99D3,
+    0xFF7F86B6D188A448, 0x38B3162B24DEE744, 0x3216466692CE14C3, 0xF5DAD6FB679857CF, 0x275CE6FDFEEFF3CD,
+    0xE09076600BB9B0C1, 0xEA35262DBDA94346, 0x2DF9B6B048FF004A, 0xAA5504DB610F3870, 0x6D99944694597B7C,
+    0x673CC40B224988FB, 0xA0F05496D71FCBF7, 0x727664904E686FF5, 0xB5BAF40DBB3E2CF9, 0xBF1FA4400D2EDF7E,
+    0x78D334DDF8789C72, 0x58E325A6962BA1E9, 0x9F2FB53B637DE2E5, 0x958AE576D56D1162, 0x524675EB203B526E,
+    0x80C045EDB94CF66C, 0x470CD5704C1AB560, 0x4DA9853DFA0A46E7, 0x8A6515A00F5C05EB, 0x1B934F964D587BA2,
+    0xDC5FDF0BB80E38AE, 0xD6FA8F460E1ECB29, 0x11361FDBFB488825, 0xC3B02FDD623F2C27, 0x047CBF4097696F2B,
+    0x0ED9EF0D21799CAC, 0xC9157F90D42FDFA0, 0xE9256EEBBA7CE23B, 0x2EE9FE764F2AA137, 0x244CAE3BF93A52B0,
+    0xE3803EA60C6C11BC, 0x31060EA0951BB5BE, 0xF6CA9E3D604DF6B2, 0xFC6FCE70D65D0535, 0x3BA35EED230B4639,
+    0xBC0FEC860AFB7E03, 0x7BC37C1BFFAD3D0F, 0x71662C5649BDCE88, 0xB6AABCCBBCEB8D84, 0x642C8CCD259C2986,
+    0xA3E01C50D0CA6A8A, 0xA9454C1D66DA990D, 0x6E89DC80938CDA01, 0x4EB9CDFBFDDFE79A, 0x89755D660889A496,
+    0x83D00D2BBE995711, 0x441C9DB64BCF141D, 0x969AADB0D2B8B01F, 0x51563D2D27EEF313, 0x5BF36D6091FE0094,
+    0x9C3FFDFD64A84398, 0x165AE85D6BF44673, 0xD19678C09EA2057F, 0xDB33288D28B2F6F8, 0x1CFFB810DDE4B5F4,
+    0xCE798816449311F6, 0x09B5188BB1C552FA, 0x031048C607D5A17D, 0xC4DCD85BF283E271, 0xE4ECC9209CD0DFEA,
+    0x232059BD69869CE6, 0x298509F0DF966F61, 0xEE49996D2AC02C6D, 0x3CCFA96BB3B7886F, 0xFB0339F646E1CB63,
+    0xF1A669BBF0F138E4, 0x366AF92605A77BE8, 0xB1C64B4D2C5743D2, 0x760ADBD0D90100DE, 0x7CAF8B9D6F11F359,
+    0xBB631B009A47B055, 0x69E52B0603301457, 0xAE29BB9BF666575B, 0xA48CEBD64076A4DC, 0x63407B4BB520E7D0,
+    0x43706A30DB73DA4B, 0x84BCFAAD2E259947, 0x8E19AAE098356AC0, 0x49D53A7D6D6329CC, 0x9B530A7BF4148DCE,
+    0x5C9F9AE60142CEC2, 0x563ACAABB7523D45, 0x91F65A3642047E49, 0x37269F2C9AB0F744, 0xF0EA0FB16FE6B448,
+    0xFA4F5FFCD9F647CF, 0x3D83CF612CA004C3, 0xEF05FF67B5D7A0C1, 0x28C96FFA4081E3CD, 0x226C3FB7F691104A,
+    0xE5A0AF2A03C75346, 0xC590BE516D946EDD, 0x025C2ECC98C22DD1, 0x08F97E812ED2DE56, 0xCF35EE1CDB849D5A,
+    0x1DB3DE1A42F33958, 0xDA7F4E87B7A57A54, 0xD0DA1ECA01B589D3, 0x17168E57F4E3CADF, 0x90BA3C3CDD13F2E5,
+    0x5776ACA12845B1E9, 0x5DD3FCEC9E55426E, 0x9A1F6C716B030162, 0x48995C77F274A560, 0x8F55CCEA0722E66C,
+    0x85F09CA7B13215EB, 0x423C0C3A446456E7, 0x620C1D412A376B7C, 0xA5C08DDCDF612870, 0xAF65DD916971DBF7,
+    0x68A94D0C9C2798FB, 0xBA2F7D0A05503CF9, 0x7DE3ED97F0067FF5, 0x7746BDDA46168C72, 0xB08A2D47B340CF7E,
+    0x3AEF38E7BC1CCA95, 0xFD23A87A494A8999, 0xF786F837FF5A7A1E, 0x304A68AA0A0C3912, 0xE2CC58AC937B9D10,
+    0x2500C831662DDE1C, 0x2FA5987CD03D2D9B, 0xE86908E1256B6E97, 0xC859199A4B38530C, 0x0F958907BE6E1000,
+    0x0530D94A087EE387, 0xC2FC49D7FD28A08B, 0x107A79D1645F0489, 0xD7B6E94C91094785, 0xDD13B9012719B402,
+    0x1ADF299CD24FF70E, 0x9D739BF7FBBFCF34, 0x5ABF0B6A0EE98C38, 0x501A5B27B8F97FBF, 0x97D6CBBA4DAF3CB3,
+    0x4550FBBCD4D898B1, 0x829C6B21218EDBBD, 0x88393B6C979E283A, 0x4FF5ABF162C86B36, 0x6FC5BA8A0C9B56AD,
+    0xA8092A17F9CD15A1, 0xA2AC7A5A4FDDE626, 0x6560EAC7BA8BA52A, 0xB7E6DAC123FC0128, 0x702A4A5CD6AA4224,
+    0x7A8F1A1160BAB1A3, 0xBD438A8C95ECF2AF, 0x2CB5D0BAD7E88CE6, 0xEB79402722BECFEA, 0xE1DC106A94AE3C6D,
+    0x261080F761F87F61, 0xF496B0F1F88FDB63, 0x335A206C0DD9986F, 0x39FF7021BBC96BE8, 0xFE33E0BC4E9F28E4,
+    0xDE03F1C720CC157F, 0x19CF615AD59A5673, 0x136A3117638AA5F4, 0xD4A6A18A96DCE6F8, 0x0620918C0FAB42FA,
+    0xC1EC0111FAFD01F6, 0xCB49515C4CEDF271, 0x0C85C1C1B9BBB17D, 0x8B2973AA904B8947, 0x4CE5E337651DCA4B,
+    0x4640B37AD30D39CC, 0x818C23E7265B7AC0, 0x530A13E1BF2CDEC2, 0x94C6837C4A7A9DCE, 0x9E63D331FC6A6E49,
+    0x59AF43AC093C2D45, 0x799F52D7676F10DE, 0xBE53C24A923953D2, 0xB4F692072429A055, 0x733A029AD17FE359,
+    0xA1BC329C4808475B, 0x6670A201BD5E0457, 0x6CD5F24C0B4EF7D0, 0xAB1962D1FE18B4DC, 0x217C7771F144B137,
+    0xE6B0E7EC0412F23B, 0xEC15B7A1B20201BC, 0x2BD9273C475442B0, 0xF95F173ADE23E6B2, 0x3E9387A72B75A5BE,
+    0x3436D7EA9D655639, 0xF3FA477768331535, 0xD3CA560C066028AE, 0x1406C691F3366BA2, 0x1EA396DC45269825,
+    0xD96F0641B070DB29, 0x0BE9364729077F2B, 0xCC25A6DADC513C27, 0xC680F6976A41CFA0, 0x014C660A9F178CAC,
+    0x86E0D461B6E7B496, 0x412C44FC43B1F79A, 0x4B8914B1F5A1041D, 0x8C45842C00F74711, 0x5EC3B42A9980E313,
+    0x990F24B76CD6A01F, 0x93AA74FADAC65398, 0x5466E4672F901094, 0x7456F51C41C32D0F, 0xB39A6581B4956E03,
+    0xB93F35CC02859D84, 0x7EF3A551F7D3DE88, 0xAC7595576EA47A8A, 0x6BB905CA9BF23986, 0x611C55872DE2CA01,
+    0xA6D0C51AD8B4890D, 0x0000000000000000, 0x6E4D3E593561EE88, 0xDC9A7CB26AC3DD10, 0xB2D742EB5FA23398,
+    0xFBC4188F7C6D8CB3, 0x958926D6490C623B, 0x275E643D16AE51A3, 0x49135A6423CFBF2B, 0xB578D0F551312FF5,
+    0xDB35EEAC6450C17D, 0x69E2AC473BF2F2E5, 0x07AF921E0E931C6D, 0x4EBCC87A2D5CA346, 0x20F1F623183D4DCE,
+    0x9226B4C8479F7E56, 0xFC6B8A9172FE90DE, 0x280140010B886979, 0x464C7E583EE987F1, 0xF49B3CB3614BB469,
+    0x9AD602EA542A5AE1, 0xD3C5588E77E5E5CA, 0xBD8866D742840B42, 0x0F5F243C1D2638DA, 0x61121A652847D652,
+    0x9D7990F45AB9468C, 0xF334AEAD6FD8A804, 0x41E3EC46307A9B9C, 0x2FAED21F051B7514, 0x66BD887B26D4CA3F,
+    0x08F0B62213B524B7, 0xBA27F4C94C17172F, 0xD46ACA907976F9A7, 0x500280021710D2F2, 0x3E4FBE5B22713C7A,
+    0x8C98FCB07DD30FE2, 0xE2D5C2E948B2E16A, 0xABC6988D6B7D5E41, 0xC58BA6D45E1CB0C9, 0x775CE43F01BE8351,
+    0x1911DA6634DF6DD9, 0xE57A50F74621FD07, 0x8B376EAE7340138F, 0x39E02C452CE22017, 0x57AD121C1983CE9F,
+    0x1EBE48783A4C71B4, 0x70F376210F2D9F3C, 0xC22434CA508FACA4, 0xAC690A9365EE422C, 0x7803C0031C98BB8B,
+    0x164EFE5A29F95503, 0xA499BCB1765B669B, 0xCAD482E8433A8813, 0x83C7D88C60F53738, 0xED8AE6D55594D9B0,
+    0x5F5DA43E0A36EA28, 0x31109A673F5704A0, 0xCD7B10F64DA9947E, 0xA3362EAF78C87AF6, 0x11E16C44276A496E,
+    0x7FAC521D120BA7E6, 0x36BF087931C418CD, 0x58F2362004A5F645, 0xEA2574CB5B07C5DD, 0x84684A926E662B55,
+    0xA00500042E21A5E4, 0xCE483E5D1B404B6C, 0x7C9F7CB644E278F4, 0x12D242EF7183967C, 0x5BC1188B524C2957,
+    0x358C26D2672DC7DF, 0x875B6439388FF447, 0xE9165A600DEE1ACF, 0x157DD0F17F108A11, 0x7B30EEA84A716499,
+    0xC9E7AC4315D35701, 0xA7AA921A20B2B989, 0xEEB9C87E037D06A2, 0x80F4F627361CE82A, 0x3223B4CC69BEDBB2,
+    0x5C6E8A955CDF353A, 0x8804400525A9CC9D, 0xE6497E5C10C82215, 0x549E3CB74F6A118D, 0x3AD302EE7A0BFF05,
+    0x73C0588A59C4402E, 0x1D8D66D36CA5AEA6, 0xAF5A243833079D3E, 0xC1171A61066673B6, 0x3D7C90F07498E368,
+    0x5331AEA941F90DE0, 0xE1E6EC421E5B3E78, 0x8FABD21B2B3AD0F0, 0xC6B8887F08F56FDB, 0xA8F5B6263D948153,
+    0x1A22F4CD6236B2CB, 0x746FCA9457575C43, 0xF007800639317716, 0x9E4ABE5F0C50999E, 0x2C9DFCB453F2AA06,
+    0x42D0C2ED6693448E, 0x0BC39889455CFBA5, 0x658EA6D0703D152D, 0xD759E43B2F9F26B5, 0xB914DA621AFEC83D,
+    0x457F50F3680058E3, 0x2B326EAA5D61B66B, 0x99E52C4102C385F3, 0xF7A8121837A26B7B, 0xBEBB487C146DD450,
+    0xD0F67625210C3AD8, 0x622134CE7EAE0940, 0x0C6C0A974BCFE7C8, 0xD806C00732B91E6F, 0xB64BFE5E07D8F0E7,
+    0x049CBCB5587AC37F, 0x6AD182EC6D1B2DF7, 0x23C2D8884ED492DC, 0x4D8FE6D17BB57C54, 0xFF58A43A24174FCC,
+    0x91159A631176A144, 0x6D7E10F26388319A, 0x03332EAB56E9DF12, 0xB1E46C40094BEC8A, 0xDFA952193C2A0202,
+    0x96BA087D1FE5BD29, 0xF8F736242A8453A1, 0x4A2074CF75266039, 0x246D4A9640478EB1, 0x02FAE1E3F5A97D5B,
+    0x6CB7DFBAC0C893D3, 0xDE609D519F6AA04B, 0xB02DA308AA0B4EC3, 0xF93EF96C89C4F1E8, 0x9773C735BCA51F60,
+    0x25A485DEE3072CF8, 0x4BE9BB87D666C270, 0xB7823116A49852AE, 0xD9CF0F4F91F9BC26, 0x6B184DA4CE5B8FBE,
+    0x055573FDFB3A6136, 0x4C462999D8F5DE1D, 0x220B17C0ED943095, 0x90DC552BB236030D, 0xFE916B728757ED85,
+    0x2AFBA1E2FE211422, 0x44B69FBBCB40FAAA, 0xF661DD5094E2C932, 0x982CE309A18327BA, 0xD13FB96D824C9891,
+    0xBF728734B72D7619, 0x0DA5C5DFE88F4581, 0x63E8FB86DDEEAB09, 0x9F837117AF103BD7, 0xF1CE4F4E9A71D55F,
+    0x43190DA5C5D3E6C7, 0x2D5433FCF0B2084F, 0x64476998D37DB764, 0x0A0A57C1E61C59EC, 0xB8DD152AB9BE6A74,
+    0xD6902B738CDF84FC, 0x52F861E1E2B9AFA9, 0x3CB55FB8D7D84121, 0x8E621D53887A72B9, 0xE02F230ABD1B9C31,
+    0xA93C796E9ED4231A, 0xC7714737ABB5CD92, 0x75A605DCF417FE0A, 0x1BEB3B85C1761082, 0xE780B114B388805C,
+    0x89CD8F4D86E96ED4, 0x3B1ACDA6D94B5D4C, 0x5557F3FFEC2AB3C4, 0x1C44A99BCFE50CEF, 0x720997C2FA84E267,
+    0xC0DED529A526D1FF, 0xAE93EB7090473F77, 0x7AF921E0E931C6D0, 0x14B41FB9DC502858, 0xA6635D5283F21BC0,
+    0xC82E630BB693F548, 0x813D396F955C4A63, 0xEF700736A03DA4EB, 0x5DA745DDFF9F9773, 0x33EA7B84CAFE79FB,
+    0xCF81F115B800E925, 0xA1CCCF4C8D6107AD, 0x131B8DA7D2C33435, 0x7D56B3FEE7A2DABD, 0x3445E99AC46D6596,
+    0x5A08D7C3F10C8B1E, 0xE8DF9528AEAEB886, 0x8692AB719BCF560E, 0xA2FFE1E7DB88D8BF, 0xCCB2DFBEEEE93637,
+    0x7E659D55B14B05AF, 0x1028A30C842AEB27, 0x593BF968A7E5540C, 0x3776C7319284BA84, 0x85A185DACD26891C,
+    0xEBECBB83F8476794, 0x178731128AB9F74A, 0x79CA0F4BBFD819C2, 0xCB1D4DA0E07A2A5A, 0xA55073F9D51BC4D2,
+    0xEC43299DF6D47BF9, 0x820E17C4C3B59571, 0x30D9552F9C17A6E9, 0x5E946B76A9764861, 0x8AFEA1E6D000B1C6,
+    0xE4B39FBFE5615F4E, 0x5664DD54BAC36CD6, 0x3829E30D8FA2825E, 0x713AB969AC6D3D75, 0x1F778730990CD3FD,
+    0xADA0C5DBC6AEE065, 0xC3EDFB82F3CF0EED, 0x3F86711381319E33, 0x51CB4F4AB45070BB, 0xE31C0DA1EBF24323,
+    0x8D5133F8DE93ADAB, 0xC442699CFD5C1280, 0xAA0F57C5C83DFC08, 0x18D8152E979FCF90, 0x76952B77A2FE2118,
+    0xF2FD61E5CC980A4D, 0x9CB05FBCF9F9E4C5, 0x2E671D57A65BD75D, 0x402A230E933A39D5, 0x0939796AB0F586FE,
+    0x6774473385946876, 0xD5A305D8DA365BEE, 0xBBEE3B81EF57B566, 0x4785B1109DA925B8, 0x29C88F49A8C8CB30,
+    0x9B1FCDA2F76AF8A8, 0xF552F3FBC20B1620, 0xBC41A99FE1C4A90B, 0xD20C97C6D4A54783, 0x60DBD52D8B07741B,
+    0x0E96EB74BE669A93, 0xDAFC21E4C7106334, 0xB4B11FBDF2718DBC, 0x06665D56ADD3BE24, 0x682B630F98B250AC,
+    0x2138396BBB7DEF87, 0x4F7507328E1C010F, 0xFDA245D9D1BE3297, 0x93EF7B80E4DFDC1F, 0x6F84F11196214CC1,
+    0x01C9CF48A340A249, 0xB31E8DA3FCE291D1, 0xDD53B3FAC9837F59, 0x9440E99EEA4CC072, 0xFA0DD7C7DF2D2EFA,
+    0x48DA952C808F1D62, 0x2697AB75B5EEF3EA,
+};
+
+/**
+ * @brief   CRC-64 tables (polynomial 0x42F0E1EBA9EA3693, MSB-first), e.g. CRC-64/ECMA-182, CRC-64/WE.
+ */
+const calc_crc_64bit_tables_t calc_crc_tables_crc64_ecma = {
+    .polynomial = 0x42F0E1EBA9EA3693,
+    .reflected = false,
+    .slices = 8,
+    .table = _table_crc64_ecma,
+    .slice_table = _slice_table_crc64_ecma,
+    .fold_constants = {0x5F6843CA540DF020u, 0xDDF4B6981205B83Fu, 0x54819D8713758B2Cu, 0x4A6B90073EB0AF5Au,
+                       0x571BEE0A227EF92Bu, 0x44BEF2A201B5200Cu, 0x05F5C3C7EB52FAB6u, 0x4EB938A7D257740Eu},
+};
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
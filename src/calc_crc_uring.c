@@ -0,0 +1,699 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc_uring.c
+ * @brief       Asynchronous read and CRC pipeline for files. Several aligned buffers per file are kept in flight with
+ *              io_uring reads (raw system calls, no liburing) while completed buffers are calculated in file order, so
+ *              I/O overlaps with calculation. Several files can run through one ring concurrently.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-06
+ * @version     1.0.0
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+// O_DIRECT is a GNU extension, files larger than 4 GB on 32-bit targets need 64-bit file offsets.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif /* _FILE_OFFSET_BITS */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if __has_include("calc_crc_conf.h")
+#include "calc_crc_conf.h"
+#endif /* __has_include("calc_crc_conf.h") */
+
+#include "calc_crc/calc_crc_ptypes.h"
+#include "calc_crc/calc_crc_gtypes.h"
+#include "calc_crc/calc_crc.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Use io_uring (Linux 5.6 or newer), files are calculated one by one with CALC_CRC_CalculateFile otherwise.
+ *          Kernels or sandboxes without io_uring fall back at runtime.
+ */
+#ifndef CALC_CRC_CONF_URING_USE
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define CALC_CRC_CONF_URING_USE (true)
+#else
+#define CALC_CRC_CONF_URING_USE (false)
+#endif
+#endif /* CALC_CRC_CONF_URING_USE */
+
+/**
+ * @brief   Number of read buffers in flight per file.
+ */
+#ifndef CALC_CRC_CONF_URING_DEPTH
+#define CALC_CRC_CONF_URING_DEPTH (8u)
+#endif /* CALC_CRC_CONF_URING_DEPTH */
+
+/**
+ * @brief   Length (bytes) of one read buffer, multiple of CALC_CRC_URING_ALIGN.
+ */
+#ifndef CALC_CRC_CONF_URING_BUFFER
+#define CALC_CRC_CONF_URING_BUFFER (256u * 1024u)
+#endif /* CALC_CRC_CONF_URING_BUFFER */
+
+/**
+ * @brief   Number of files calculated concurrently.
+ */
+#ifndef CALC_CRC_CONF_URING_FILES
+#define CALC_CRC_CONF_URING_FILES (4u)
+#endif /* CALC_CRC_CONF_URING_FILES */
+
+/**
+ * @brief   Open files with O_DIRECT to bypass the page cache (files on filesystems without direct I/O are opened
+ *          without it).
+ */
+#ifndef CALC_CRC_CONF_URING_DIRECT
+#define CALC_CRC_CONF_URING_DIRECT (false)
+#endif /* CALC_CRC_CONF_URING_DIRECT */
+
+/**
+ * @brief   Alignment of read buffers (direct I/O block alignment).
+ */
+#define CALC_CRC_URING_ALIGN (4096u)
+
+/**
+ * @brief   Round a read length up to CALC_CRC_URING_ALIGN.
+ */
+#define CALC_CRC_URING_ROUND(length) (((length) + CALC_CRC_URING_ALIGN - 1u) & ~(size_t)(CALC_CRC_URING_ALIGN - 1u))
+
+/**
+ * @brief   Number of submission queue entries of the ring.
+ */
+#define CALC_CRC_URING_ENTRIES (CALC_CRC_CONF_URING_DEPTH * CALC_CRC_CONF_URING_FILES)
+
+#if (true == CALC_CRC_CONF_URING_USE)
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* (true == CALC_CRC_CONF_URING_USE) */
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+#if (true == CALC_CRC_CONF_URING_USE)
+
+/**
+ * @brief   Read buffer of a file, reads are consumed in file order.
+ */
+typedef struct
+{
+    uint8_t *buffer; // Aligned read buffer.
+    uint64_t offset; // File offset of the buffer.
+    size_t length;   // Length of file data in the buffer.
+    size_t done;     // Length read so far (short reads are resubmitted).
+    bool busy;       // Read is queued, in flight or waiting to be calculated.
+} calc_crc_uring_slot_t;
+
+/**
+ * @brief   File in the pipeline.
+ */
+typedef struct
+{
+    calc_crc_t crc;                                         // Copy of the instance holding the stream register.
+    calc_crc_uring_slot_t slots[CALC_CRC_CONF_URING_DEPTH]; // Read buffers (read n uses slot n % depth).
+    int fd;                                                 // File descriptor.
+    size_t index;                                           // Index of the file in the caller arrays.
+    uint64_t size;                                          // Size of the file in bytes.
+    uint64_t reads;                                         // Number of reads of the whole file.
+    uint64_t submitted;                                     // Number of reads queued.
+    uint64_t consumed;                                      // Number of reads calculated.
+    size_t inflight;                                        // Reads in the kernel, buffers can not be reused.
+    calc_crc_status_e status;                               // Status of the file.
+    bool active;                                            // File is open in the pipeline.
+} calc_crc_uring_file_t;
+
+/**
+ * @brief   Mapped submission and completion queues of the ring.
+ */
+typedef struct
+{
+    int fd;                      // Ring file descriptor.
+    unsigned *sq_head;           // Submission queue head (kernel).
+    unsigned *sq_tail;           // Submission queue tail (application).
+    unsigned sq_mask;            // Submission queue index mask.
+    unsigned *sq_array;          // Submission queue index array.
+    struct io_uring_sqe *sqes;   // Submission queue entries.
+    unsigned *cq_head;           // Completion queue head (application).
+    unsigned *cq_tail;           // Completion queue tail (kernel).
+    unsigned cq_mask;            // Completion queue index mask.
+    struct io_uring_cqe *cqes;   // Completion queue entries.
+    void *sq_map;                // Submission queue ring mapping.
+    void *cq_map;                // Completion queue ring mapping (same as sq_map with single mmap).
+    size_t sq_size;              // Length of submission queue ring mapping.
+    size_t cq_size;              // Length of completion queue ring mapping.
+    size_t sqes_size;            // Length of submission queue entries mapping.
+    unsigned queued;             // Entries queued and not submitted yet.
+} calc_crc_uring_t;
+
+#endif /* (true == CALC_CRC_CONF_URING_USE) */
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+/**
+ * @brief   Calculate files one by one with CALC_CRC_CalculateFile.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   paths       Array of file paths.
+ * @param   count       Number of files.
+ * @param   results     Array to store calculated CRC values.
+ * @param   status      Array to store status of every file or NULL.
+ * @return  Status code indicating success or failure.
+ */
+static calc_crc_status_e _files_sequential(const calc_crc_t *crc, const char *const *paths, size_t count,
+                                           void *results, calc_crc_status_e *status);
+
+/**
+ * @brief   Get size of the CRC value of the instance type.
+ * @param   type        Type of CRC calculation.
+ * @return  Size in bytes.
+ */
+static size_t _result_size(calc_crc_type_e type);
+
+#if (true == CALC_CRC_CONF_URING_USE)
+
+/**
+ * @brief   Set up the ring and map its queues.
+ * @param   ring        Pointer to the ring.
+ * @param   entries     Number of submission queue entries.
+ * @return  True if the ring is ready, false if io_uring is not available.
+ */
+static bool _ring_setup(calc_crc_uring_t *ring, unsigned entries);
+
+/**
+ * @brief   Unmap the queues and close the ring.
+ * @param   ring        Pointer to the ring.
+ */
+static void _ring_close(calc_crc_uring_t *ring);
+
+/**
+ * @brief   Queue a read into the submission queue.
+ * @param   ring        Pointer to the ring.
+ * @param   fd          File descriptor.
+ * @param   buffer      Destination buffer.
+ * @param   length      Length to read.
+ * @param   offset      File offset.
+ * @param   user_data   Value returned with the completion.
+ */
+static void _ring_read(calc_crc_uring_t *ring, int fd, void *buffer, size_t length, uint64_t offset,
+                       uint64_t user_data);
+
+/**
+ * @brief   Submit queued reads and wait for completions.
+ * @param   ring        Pointer to the ring.
+ * @param   wait        Number of completions to wait for.
+ * @return  True on success, false if the ring failed.
+ */
+static bool _ring_enter(calc_crc_uring_t *ring, unsigned wait);
+
+/**
+ * @brief   Run files through the ring.
+ * @param   ring        Pointer to the ring.
+ * @param   files       Array of CALC_CRC_CONF_URING_FILES pipeline files (buffers assigned).
+ * @param   crc         Pointer to the CRC instance.
+ * @param   paths       Array of file paths.
+ * @param   count       Number of files.
+ * @param   results     Array to store calculated CRC values.
+ * @param   status      Array to store status of every file.
+ * @return  False if the ring failed (files not finished have to be calculated otherwise).
+ */
+static bool _pipeline(calc_crc_uring_t *ring, calc_crc_uring_file_t *files, const calc_crc_t *crc,
+                      const char *const *paths, size_t count, uint8_t *results, calc_crc_status_e *status);
+
+/**
+ * @brief   Open a file and start its stream (status CALC_CRC_STATUS_MAX leaves a non-regular file to the caller).
+ * @param   file        Pointer to the pipeline file.
+ * @param   crc         Pointer to the CRC instance.
+ * @param   path        Path of the file.
+ * @param   index       Index of the file in the caller arrays.
+ */
+static void _file_open(calc_crc_uring_file_t *file, const calc_crc_t *crc, const char *path, size_t index);
+
+/**
+ * @brief   Queue reads into free buffers of a file.
+ * @param   ring        Pointer to the ring.
+ * @param   file        Pointer to the pipeline file.
+ * @param   id          Index of the file in the pipeline.
+ */
+static void _file_submit(calc_crc_uring_t *ring, calc_crc_uring_file_t *file, size_t id);
+
+/**
+ * @brief   Calculate completed buffers of a file in file order.
+ * @param   file        Pointer to the pipeline file.
+ */
+static void _file_consume(calc_crc_uring_file_t *file);
+
+#endif /* (true == CALC_CRC_CONF_URING_USE) */
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+calc_crc_status_e CALC_CRC_CalculateFiles(const calc_crc_t *crc, const char *const *paths, size_t count,
+                                          void *results, calc_crc_status_e *status)
+{
+    CHECK_ARGS_NULL_PTR(crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(paths, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(results, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(count, 0, CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+
+    if (CALC_CRC_TYPE_MAX <= crc->type)
+    {
+        return CALC_CRC_STATUS_ERROR_INVALID_TYPE;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        CHECK_ARGS_NULL_PTR(paths[i], CALC_CRC_STATUS_ERROR_INPUT_ARGS);
+    }
+
+#if (true == CALC_CRC_CONF_URING_USE)
+    calc_crc_uring_t ring;
+    calc_crc_uring_file_t *files = (calc_crc_uring_file_t *)calloc(CALC_CRC_CONF_URING_FILES, sizeof(*files));
+    calc_crc_status_e *states = (calc_crc_status_e *)malloc(count * sizeof(calc_crc_status_e));
+    void *buffers = NULL;
+
+    size_t length = (size_t)CALC_CRC_URING_ENTRIES * CALC_CRC_CONF_URING_BUFFER;
+
+    if ((NULL == files) || (NULL == states) || (0 != posix_memalign(&buffers, CALC_CRC_URING_ALIGN, length)))
+    {
+        free(files);
+        free(states);
+        return CALC_CRC_STATUS_ERROR;
+    }
+
+    if (false == _ring_setup(&ring, CALC_CRC_URING_ENTRIES))
+    {
+        free(buffers);
+        free(files);
+        free(states);
+        return _files_sequential(crc, paths, count, results, status);
+    }
+
+    for (size_t f = 0; f < CALC_CRC_CONF_URING_FILES; f++)
+    {
+        for (size_t k = 0; k < CALC_CRC_CONF_URING_DEPTH; k++)
+        {
+            files[f].slots[k].buffer =
+                (uint8_t *)buffers + (((f * CALC_CRC_CONF_URING_DEPTH) + k) * CALC_CRC_CONF_URING_BUFFER);
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        states[i] = CALC_CRC_STATUS_MAX; // Not calculated yet.
+    }
+
+    (void)_pipeline(&ring, files, crc, paths, count, (uint8_t *)results, states);
+    calc_crc_status_e total = CALC_CRC_STATUS_OK;
+    size_t size = _result_size(crc->type);
+
+    _ring_close(&ring);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // Files not finished by a failed ring and files other than regular ones are calculated one by one.
+        if (CALC_CRC_STATUS_MAX == states[i])
+        {
+            calc_crc_t copy = *crc;
+            states[i] = CALC_CRC_CalculateFile(&copy, paths[i], (uint8_t *)results + (i * size));
+        }
+        total = (CALC_CRC_STATUS_OK != states[i]) ? CALC_CRC_STATUS_ERROR : total;
+        if (NULL != status)
+        {
+            status[i] = states[i];
+        }
+    }
+
+    free(buffers);
+    free(files);
+    free(states);
+
+    return total;
+#else
+    return _files_sequential(crc, paths, count, results, status);
+#endif /* (true == CALC_CRC_CONF_URING_USE) */
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+static calc_crc_status_e _files_sequential(const calc_crc_t *crc, const char *const *paths, size_t count,
+                                           void *results, calc_crc_status_e *status)
+{
+    calc_crc_status_e total = CALC_CRC_STATUS_OK;
+    size_t size = _result_size(crc->type);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        calc_crc_t copy = *crc;
+        calc_crc_status_e state = CALC_CRC_CalculateFile(&copy, paths[i], (uint8_t *)results + (i * size));
+
+        total = (CALC_CRC_STATUS_OK != state) ? CALC_CRC_STATUS_ERROR : total;
+        if (NULL != status)
+        {
+            status[i] = state;
+        }
+    }
+
+    return total;
+}
+
+static size_t _result_size(calc_crc_type_e type)
+{
+    static const size_t sizes[CALC_CRC_TYPE_MAX] = {sizeof(uint8_t),  sizeof(uint16_t), sizeof(uint32_t),
+                                                    sizeof(uint64_t), sizeof(uint8_t),  sizeof(uint8_t),
+                                                    sizeof(uint16_t), sizeof(uint32_t), sizeof(uint64_t),
+                                                    sizeof(uint32_t), sizeof(uint16_t)};
+
+    return sizes[type];
+}
+
+#if (true == CALC_CRC_CONF_URING_USE)
+
+static bool _ring_setup(calc_crc_uring_t *ring, unsigned entries)
+{
+    struct io_uring_params params;
+
+    memset(ring, 0, sizeof(calc_crc_uring_t));
+    memset(&params, 0, sizeof(params));
+
+    long fd = syscall(__NR_io_uring_setup, entries, &params);
+
+    if (0 > fd)
+    {
+        return false;
+    }
+
+    ring->fd = (int)fd;
+    ring->sq_size = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+    ring->cq_size = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    // Both rings share one mapping on kernels with single mmap support.
+    if (0u != (params.features & IORING_FEAT_SINGLE_MMAP))
+    {
+        ring->sq_size = (ring->cq_size > ring->sq_size) ? ring->cq_size : ring->sq_size;
+        ring->cq_size = ring->sq_size;
+    }
+
+    ring->sq_map = mmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                        IORING_OFF_SQ_RING);
+    ring->cq_map = (0u != (params.features & IORING_FEAT_SINGLE_MMAP))
+                       ? ring->sq_map
+                       : mmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                              IORING_OFF_CQ_RING);
+    ring->sqes = (struct io_uring_sqe *)mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                                             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+
+    if ((MAP_FAILED == ring->sq_map) || (MAP_FAILED == ring->cq_map) || (MAP_FAILED == (void *)ring->sqes))
+    {
+        ring->sq_map = (MAP_FAILED == ring->sq_map) ? NULL : ring->sq_map;
+        ring->cq_map = (MAP_FAILED == ring->cq_map) ? NULL : ring->cq_map;
+        ring->sqes = (MAP_FAILED == (void *)ring->sqes) ? NULL : ring->sqes;
+        _ring_close(ring);
+        return false;
+    }
+
+    uint8_t *sq = (uint8_t *)ring->sq_map;
+    uint8_t *cq = (uint8_t *)ring->cq_map;
+
+    ring->sq_head = (unsigned *)(sq + params.sq_off.head);
+    ring->sq_tail = (unsigned *)(sq + params.sq_off.tail);
+    ring->sq_mask = *(unsigned *)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)(sq + params.sq_off.array);
+    ring->cq_head = (unsigned *)(cq + params.cq_off.head);
+    ring->cq_tail = (unsigned *)(cq + params.cq_off.tail);
+    ring->cq_mask = *(unsigned *)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+
+    return true;
+}
+
+static void _ring_close(calc_crc_uring_t *ring)
+{
+    if (NULL != ring->sqes)
+    {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if ((NULL != ring->cq_map) && (ring->cq_map != ring->sq_map))
+    {
+        munmap(ring->cq_map, ring->cq_size);
+    }
+    if (NULL != ring->sq_map)
+    {
+        munmap(ring->sq_map, ring->sq_size);
+    }
+    close(ring->fd);
+}
+
+static void _ring_read(calc_crc_uring_t *ring, int fd, void *buffer, size_t length, uint64_t offset,
+                       uint64_t user_data)
+{
+    unsigned tail = *ring->sq_tail;
+    unsigned index = tail & ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)buffer;
+    sqe->len = (uint32_t)length;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+    ring->sq_array[index] = index;
+
+    // Entry has to be visible to the kernel before the new tail.
+    __atomic_store_n(ring->sq_tail, tail + 1u, __ATOMIC_RELEASE);
+    ring->queued++;
+}
+
+static bool _ring_enter(calc_crc_uring_t *ring, unsigned wait)
+{
+    unsigned flags = (0u != wait) ? IORING_ENTER_GETEVENTS : 0u;
+
+    while (true)
+    {
+        long submitted = syscall(__NR_io_uring_enter, ring->fd, ring->queued, wait, flags, NULL, 0);
+
+        if (0 <= submitted)
+        {
+            ring->queued -= (unsigned)submitted;
+            return true;
+        }
+        if ((EINTR != errno) && (EAGAIN != errno) && (EBUSY != errno))
+        {
+            return false;
+        }
+    }
+}
+
+static bool _pipeline(calc_crc_uring_t *ring, calc_crc_uring_file_t *files, const calc_crc_t *crc,
+                      const char *const *paths, size_t count, uint8_t *results, calc_crc_status_e *status)
+{
+    size_t size = _result_size(crc->type);
+    size_t next = 0;
+    size_t active = 0;
+
+    while ((next < count) || (0u != active))
+    {
+        // Open next files into free pipeline places and queue their reads.
+        for (size_t f = 0; f < CALC_CRC_CONF_URING_FILES; f++)
+        {
+            if ((false == files[f].active) && (next < count))
+            {
+                _file_open(&files[f], crc, paths[next], next);
+                next++;
+                active++;
+            }
+            if (true == files[f].active)
+            {
+                _file_submit(ring, &files[f], f);
+            }
+        }
+
+        // Finished files leave the pipeline once none of their reads is in the kernel.
+        bool waiting = false;
+        for (size_t f = 0; f < CALC_CRC_CONF_URING_FILES; f++)
+        {
+            calc_crc_uring_file_t *file = &files[f];
+
+            if ((false == file->active) || (0u != file->inflight) ||
+                ((CALC_CRC_STATUS_OK == file->status) && (file->consumed < file->reads)))
+            {
+                waiting = waiting || (true == file->active);
+                continue;
+            }
+            if (CALC_CRC_STATUS_OK == file->status)
+            {
+                file->status = CALC_CRC_Finalize(&file->crc, results + (file->index * size));
+            }
+            status[file->index] = file->status;
+            if (0 <= file->fd)
+            {
+                close(file->fd);
+            }
+            file->active = false;
+            active--;
+        }
+
+        if (false == waiting)
+        {
+            continue;
+        }
+
+        if (false == _ring_enter(ring, 1u))
+        {
+            // Reads still in flight may write into the buffers, ring is closed before buffers are released.
+            for (size_t f = 0; f < CALC_CRC_CONF_URING_FILES; f++)
+            {
+                if ((true == files[f].active) && (0 <= files[f].fd))
+                {
+                    close(files[f].fd);
+                }
+            }
+            return false;
+        }
+
+        unsigned head = *ring->cq_head;
+        unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+        for (; head != tail; head++)
+        {
+            const struct io_uring_cqe *cqe = &ring->cqes[head & ring->cq_mask];
+            calc_crc_uring_file_t *file = &files[cqe->user_data / CALC_CRC_CONF_URING_DEPTH];
+            calc_crc_uring_slot_t *slot = &file->slots[cqe->user_data % CALC_CRC_CONF_URING_DEPTH];
+
+            file->inflight--;
+            if ((-EINTR == cqe->res) || (-EAGAIN == cqe->res))
+            {
+                _ring_read(ring, file->fd, slot->buffer + slot->done, slot->length - slot->done,
+                           slot->offset + slot->done, cqe->user_data);
+                file->inflight++;
+            }
+            else if (0 >= cqe->res)
+            {
+                // Read error or file truncated while it was calculated.
+                file->status = CALC_CRC_STATUS_ERROR;
+            }
+            else
+            {
+                slot->done += (size_t)cqe->res;
+                if (slot->done < slot->length)
+                {
+                    // Short read, the remainder is requested again.
+                    _ring_read(ring, file->fd, slot->buffer + slot->done, slot->length - slot->done,
+                               slot->offset + slot->done, cqe->user_data);
+                    file->inflight++;
+                }
+            }
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+
+        // Completed buffers are calculated while the following reads are in flight.
+        for (size_t f = 0; f < CALC_CRC_CONF_URING_FILES; f++)
+        {
+            if ((true == files[f].active) && (CALC_CRC_STATUS_OK == files[f].status))
+            {
+                _file_consume(&files[f]);
+            }
+        }
+    }
+
+    return true;
+}
+
+static void _file_open(calc_crc_uring_file_t *file, const calc_crc_t *crc, const char *path, size_t index)
+{
+    struct stat info;
+
+    file->crc = *crc;
+    file->index = index;
+    file->submitted = 0u;
+    file->consumed = 0u;
+    file->inflight = 0u;
+    file->active = true;
+    file->status = CALC_CRC_STATUS_OK;
+    file->fd = -1;
+
+    for (size_t k = 0; k < CALC_CRC_CONF_URING_DEPTH; k++)
+    {
+        file->slots[k].busy = false;
+    }
+
+    // Devices and FIFOs have no size to split into reads, they are left to CALC_CRC_CalculateFile (not opened twice).
+    if ((0 == stat(path, &info)) && (0 == S_ISREG(info.st_mode)))
+    {
+        file->status = CALC_CRC_STATUS_MAX;
+        file->reads = 0u;
+        return;
+    }
+
+#if (true == CALC_CRC_CONF_URING_DIRECT)
+    file->fd = open(path, O_RDONLY | O_CLOEXEC | O_DIRECT);
+#endif /* (true == CALC_CRC_CONF_URING_DIRECT) */
+    file->fd = (0 > file->fd) ? open(path, O_RDONLY | O_CLOEXEC) : file->fd;
+
+    if ((0 > file->fd) || (0 != fstat(file->fd, &info)) || (0 == S_ISREG(info.st_mode)))
+    {
+        file->status = CALC_CRC_STATUS_ERROR;
+        file->reads = 0u;
+        return;
+    }
+
+    // Empty files give the CRC value of empty data.
+    file->size = (uint64_t)info.st_size;
+    file->reads = (file->size + CALC_CRC_CONF_URING_BUFFER - 1u) / CALC_CRC_CONF_URING_BUFFER;
+    CALC_CRC_Start(&file->crc);
+}
+
+static void _file_submit(calc_crc_uring_t *ring, calc_crc_uring_file_t *file, size_t id)
+{
+    while ((CALC_CRC_STATUS_OK == file->status) && (file->submitted < file->reads) &&
+           ((file->submitted - file->consumed) < CALC_CRC_CONF_URING_DEPTH))
+    {
+        size_t k = (size_t)(file->submitted % CALC_CRC_CONF_URING_DEPTH);
+        calc_crc_uring_slot_t *slot = &file->slots[k];
+        uint64_t remaining = file->size - (file->submitted * CALC_CRC_CONF_URING_BUFFER);
+
+        slot->offset = file->submitted * CALC_CRC_CONF_URING_BUFFER;
+        slot->length = (CALC_CRC_CONF_URING_BUFFER < remaining) ? CALC_CRC_CONF_URING_BUFFER : (size_t)remaining;
+        slot->done = 0u;
+        slot->busy = true;
+        // Direct I/O needs block aligned lengths, the read of the file tail returns only the remaining bytes.
+        _ring_read(ring, file->fd, slot->buffer, CALC_CRC_URING_ROUND(slot->length), slot->offset,
+                   (id * CALC_CRC_CONF_URING_DEPTH) + k);
+        file->inflight++;
+        file->submitted++;
+    }
+}
+
+static void _file_consume(calc_crc_uring_file_t *file)
+{
+    while ((CALC_CRC_STATUS_OK == file->status) && (file->consumed < file->submitted))
+    {
+        calc_crc_uring_slot_t *slot = &file->slots[file->consumed % CALC_CRC_CONF_URING_DEPTH];
+
+        if ((false == slot->busy) || (slot->done < slot->length))
+        {
+            break;
+        }
+        file->status = CALC_CRC_Update(&file->crc, slot->buffer, slot->length);
+        slot->busy = false;
+        file->consumed++;
+    }
+}
+
+#endif /* (true == CALC_CRC_CONF_URING_USE) */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
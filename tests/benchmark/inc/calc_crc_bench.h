@@ -0,0 +1,158 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc_bench.h
+ * @brief       Helpers shared by CALC-CRC benchmarks (own models of every register width and benchmark data).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-11
+ *
+ **********************************************************************************************************************/
+
+#ifndef CALC_CRC_BENCH_H
+#define CALC_CRC_BENCH_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <cstdlib>
+#include <vector>
+
+#include "calc_crc/calc_crc.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// --- Benchmark Defines -----------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Largest buffer of the throughput sweep (bytes) and the largest misalignment of its start.
+ */
+#define CALC_CRC_BENCH_SIZE_MAX  (256u * 1024u * 1024u)
+#define CALC_CRC_BENCH_ALIGN_MAX (64u)
+
+/**
+ * @brief   Slicing step of generated slicing tables.
+ */
+#define CALC_CRC_BENCH_SLICES (8u)
+
+// --- Benchmark Helpers -----------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Fill a configuration of one register width with an own model (all-ones initial and final value).
+ * @tparam  Conf        Configuration type of the width.
+ * @tparam  Value       Register type of the width.
+ * @param   conf        Pointer to the configuration.
+ * @param   polynomial  Polynomial of the model.
+ * @param   reflected   Reflect input and output.
+ * @param   slices      Slicing step (0 = byte-wise table only).
+ * @param   slice_table Storage for the slicing table rows.
+ */
+template <typename Conf, typename Value>
+static inline void calc_crc_bench_conf(Conf *conf, Value polynomial, bool reflected, uint8_t slices, void *slice_table)
+{
+    memset(conf, 0, sizeof(Conf));
+    conf->polynomial = polynomial;
+    conf->initial_value = (Value)~(Value)0;
+    conf->final_value = (Value)~(Value)0;
+    conf->input_reflected = reflected;
+    conf->output_reflected = reflected;
+    conf->slices = slices;
+    conf->slice_table = (0u != slices) ? static_cast<Value *>(slice_table) : nullptr;
+}
+
+/**
+ * @brief   Own model of one register width, tables are generated at init (CRC-8, CRC-16/CCITT, CRC-32 and CRC-64/ECMA
+ *          polynomials, reflected 32-bit model uses the CRC-32C polynomial so the SSE4.2 tier can be measured).
+ */
+class calc_crc_bench_model
+{
+  public:
+    /**
+     * @brief   Initialize a CRC instance with the model.
+     * @param   crc         Pointer to the CRC instance.
+     * @param   type        Register width.
+     * @param   reflected   Reflect input and output.
+     * @param   slices      Slicing step (0 = byte-wise table only).
+     * @return  Status code indicating success or failure.
+     */
+    calc_crc_status_e init(calc_crc_t *crc, calc_crc_type_e type, bool reflected, uint8_t slices)
+    {
+        // Largest rows (64-bit) fit every width.
+        slice_table.resize(CALC_CRC_SLICE_TABLE_SIZE(CALC_CRC_BENCH_SLICES));
+
+        switch (type)
+        {
+        case CALC_CRC_TYPE_8BIT:
+            calc_crc_bench_conf<calc_crc_8bit_t, uint8_t>(&conf.conf_8bit, 0x07u, reflected, slices,
+                                                          slice_table.data());
+            break;
+        case CALC_CRC_TYPE_16BIT:
+            calc_crc_bench_conf<calc_crc_16bit_t, uint16_t>(&conf.conf_16bit, 0x1021u, reflected, slices,
+                                                            slice_table.data());
+            break;
+        case CALC_CRC_TYPE_32BIT:
+        {
+            uint32_t polynomial = (true == reflected) ? 0x1EDC6F41u : 0x04C11DB7u;
+            calc_crc_bench_conf<calc_crc_32bit_t, uint32_t>(&conf.conf_32bit, polynomial, reflected, slices,
+                                                            slice_table.data());
+            break;
+        }
+        default:
+            calc_crc_bench_conf<calc_crc_64bit_t, uint64_t>(&conf.conf_64bit, 0x42F0E1EBA9EA3693u, reflected, slices,
+                                                            slice_table.data());
+            break;
+        }
+
+        return CALC_CRC_Init(crc, &conf, type);
+    }
+
+  private:
+    calc_crc_conf_t conf;
+    std::vector<uint64_t> slice_table;
+};
+
+/**
+ * @brief   Get benchmark data, one pseudo-random buffer shared by all benchmarks (allocated and filled on first use).
+ * @param   offset      Misalignment of the returned pointer (bytes from a 64-byte boundary).
+ * @return  Pointer to CALC_CRC_BENCH_SIZE_MAX bytes.
+ */
+inline const uint8_t *calc_crc_bench_data(size_t offset)
+{
+    static uint8_t *data = nullptr;
+
+    if (nullptr == data)
+    {
+        data = static_cast<uint8_t *>(std::aligned_alloc(64u, CALC_CRC_BENCH_SIZE_MAX + CALC_CRC_BENCH_ALIGN_MAX));
+        uint64_t state = 0x9E3779B97F4A7C15u;
+
+        for (size_t i = 0; i < (CALC_CRC_BENCH_SIZE_MAX + CALC_CRC_BENCH_ALIGN_MAX); i += sizeof(state))
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            memcpy(&data[i], &state, sizeof(state));
+        }
+    }
+
+    return data + offset;
+}
+
+/**
+ * @brief   Read the cycle counter (time stamp counter on x86, reference cycles at the nominal frequency).
+ * @return  Cycle count or 0 if the target has no readable counter.
+ */
+static inline uint64_t calc_crc_bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0u;
+#endif
+}
+
+#endif /* CALC_CRC_BENCH_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,30 @@
+/***********************************************************************************************************************
+ *
+ * @file        calc_crc_conf.h
+ * @brief       Component CALC-CRC configurations.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-01
+ *
+ **********************************************************************************************************************/
+
+#ifndef CALC_CRC_CONF_H
+#define CALC_CRC_CONF_H
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- CALC-CRC Configurations -----------------------------------------------------------------------------------------
+
+// Currently, there are no configurations available for this component.
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CALC_CRC_CONF_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
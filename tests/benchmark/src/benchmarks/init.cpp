@@ -0,0 +1,74 @@
+/***********************************************************************************************************************
+ *
+ * @file        init.cpp
+ * @brief       Benchmarks of CALC-CRC instance initialization cost with Google Benchmark.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-11
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <benchmark/benchmark.h>
+
+#include "calc_crc/calc_crc.h"
+#include "calc_crc_bench.h"
+
+// --- Init Benchmarks -------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   CALC_CRC_Init cost of an own model (lookup table and folding constants generated at init).
+ *          Arguments: register width (8/16/32/64), slicing step (0 = byte-wise table only).
+ */
+static void BM_Init(benchmark::State &state)
+{
+    calc_crc_type_e type = (calc_crc_type_e)state.range(0);
+    uint8_t slices = (uint8_t)state.range(1);
+    calc_crc_bench_model model;
+    calc_crc_t crc;
+
+    for (auto _ : state)
+    {
+        model.init(&crc, type, true, slices);
+        benchmark::DoNotOptimize(crc);
+    }
+}
+
+/**
+ * @brief   CALC_CRC_InitModel cost of catalogue models with precomputed read-only tables (nothing generated at init).
+ *          Arguments: catalogue model.
+ */
+static void BM_InitModel(benchmark::State &state)
+{
+    calc_crc_model_e model = (calc_crc_model_e)state.range(0);
+    calc_crc_conf_t conf;
+    calc_crc_t crc;
+
+    for (auto _ : state)
+    {
+        CALC_CRC_InitModel(&crc, &conf, model);
+        benchmark::DoNotOptimize(crc);
+    }
+}
+
+// --- Benchmark Registration ------------------------------------------------------------------------------------------
+
+BENCHMARK(BM_Init)
+    ->ArgNames({"type", "slices"})
+    ->ArgsProduct({
+        {CALC_CRC_TYPE_8BIT, CALC_CRC_TYPE_16BIT, CALC_CRC_TYPE_32BIT, CALC_CRC_TYPE_64BIT},
+        {0, CALC_CRC_BENCH_SLICES},
+    });
+
+BENCHMARK(BM_InitModel)
+    ->ArgName("model")
+    ->Arg(CALC_CRC_MODEL_CRC8_SMBUS)
+    ->Arg(CALC_CRC_MODEL_CRC16_IBM_3740)
+    ->Arg(CALC_CRC_MODEL_CRC32_ISO_HDLC)
+    ->Arg(CALC_CRC_MODEL_CRC32_ISCSI)
+    ->Arg(CALC_CRC_MODEL_CRC64_XZ);
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
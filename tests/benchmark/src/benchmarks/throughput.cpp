@@ -0,0 +1,323 @@
+/***********************************************************************************************************************
+ *
+ * @file        throughput.cpp
+ * @brief       Throughput benchmarks of CALC-CRC calculation (bytes/s and cycles/byte) with Google Benchmark.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-11
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <benchmark/benchmark.h>
+
+#include "calc_crc/calc_crc.h"
+#include "calc_crc_bench.h"
+
+// --- Helper Functions ------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Report cycles/byte of a finished benchmark loop.
+ * @param   state       Benchmark state.
+ * @param   cycles      Cycles spent in the loop.
+ * @param   length      Bytes processed per iteration.
+ */
+static void _cycles_per_byte(benchmark::State &state, uint64_t cycles, size_t length)
+{
+    if ((0u != cycles) && (0 < state.iterations()))
+    {
+        state.counters["cycles/byte"] =
+            benchmark::Counter((double)cycles / ((double)state.iterations() * (double)length));
+    }
+}
+
+// --- Throughput Benchmarks -------------------------------------------------------------------------------------------
+
+/**
+ * @brief   CALC_CRC_Calculate throughput.
+ *          Arguments: register width (8/16/32/64), reflected (0/1), buffer length, misalignment, kernel tier.
+ */
+static void BM_Calculate(benchmark::State &state)
+{
+    calc_crc_type_e type = (calc_crc_type_e)state.range(0);
+    bool reflected = (0 != state.range(1));
+    size_t length = (size_t)state.range(2);
+    size_t offset = (size_t)state.range(3);
+    calc_crc_kernel_e kernel = (calc_crc_kernel_e)state.range(4);
+    calc_crc_kernel_e bound = CALC_CRC_KERNEL_AUTO;
+    calc_crc_bench_model model;
+    calc_crc_t crc;
+    uint64_t result = 0;
+
+    // Tier is an upper bound, combinations falling back to a lower tier are covered by that tier.
+    CALC_CRC_SetKernel(kernel);
+    model.init(&crc, type, reflected, CALC_CRC_BENCH_SLICES);
+    CALC_CRC_SetKernel(CALC_CRC_KERNEL_AUTO);
+    CALC_CRC_GetKernel(&crc, &bound);
+    if (bound != kernel)
+    {
+        state.SkipWithError("Kernel tier not available for this model or CPU");
+        return;
+    }
+
+    const uint8_t *data = calc_crc_bench_data(offset);
+    uint64_t cycles = calc_crc_bench_cycles();
+
+    for (auto _ : state)
+    {
+        CALC_CRC_Calculate(&crc, data, length, &result);
+        benchmark::DoNotOptimize(result);
+    }
+
+    cycles = calc_crc_bench_cycles() - cycles;
+    state.SetBytesProcessed((int64_t)state.iterations() * (int64_t)length);
+    _cycles_per_byte(state, cycles, length);
+}
+
+/**
+ * @brief   Cost of many short independent frames, CALC_CRC_CalculateBatch compared with CALC_CRC_Calculate per frame
+ *          (1024 frames per iteration, kernel tier selected at init).
+ *          Arguments: register width (32/64), reflected (0/1), slicing step (0/8), frame length, batch (0/1).
+ */
+static void BM_Batch(benchmark::State &state)
+{
+    const size_t count = 1024u;
+    calc_crc_type_e type = (calc_crc_type_e)state.range(0);
+    bool reflected = (0 != state.range(1));
+    uint8_t slices = (uint8_t)state.range(2);
+    size_t length = (size_t)state.range(3);
+    bool batch = (0 != state.range(4));
+    calc_crc_bench_model model;
+    calc_crc_t crc;
+    std::vector<const void *> frames(count);
+    std::vector<size_t> lengths(count, length);
+    std::vector<uint64_t> results(count);
+
+    model.init(&crc, type, reflected, slices);
+
+    const uint8_t *data = calc_crc_bench_data(0);
+    for (size_t i = 0; i < count; i++)
+    {
+        frames[i] = &data[i * length];
+    }
+
+    uint64_t cycles = calc_crc_bench_cycles();
+
+    for (auto _ : state)
+    {
+        if (true == batch)
+        {
+            // Results are packed with the width of the type, the 64-bit array is large enough for every width.
+            CALC_CRC_CalculateBatch(&crc, frames.data(), lengths.data(), results.data(), count);
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                CALC_CRC_Calculate(&crc, frames[i], length, &results[i]);
+            }
+        }
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    cycles = calc_crc_bench_cycles() - cycles;
+    state.SetBytesProcessed((int64_t)state.iterations() * (int64_t)(count * length));
+    state.SetItemsProcessed((int64_t)state.iterations() * (int64_t)count);
+    _cycles_per_byte(state, cycles, count * length);
+}
+
+/**
+ * @brief   CALC_CRC_Calculate throughput of checksum types.
+ *          Arguments: checksum type, buffer length, kernel tier.
+ */
+static void BM_Checksum(benchmark::State &state)
+{
+    calc_crc_type_e type = (calc_crc_type_e)state.range(0);
+    size_t length = (size_t)state.range(1);
+    calc_crc_kernel_e kernel = (calc_crc_kernel_e)state.range(2);
+    calc_crc_kernel_e bound = CALC_CRC_KERNEL_AUTO;
+    calc_crc_checksum_t conf = {(CALC_CRC_TYPE_ADLER32 == type) ? 1u : 0u};
+    calc_crc_t crc;
+    uint64_t result = 0;
+
+    CALC_CRC_SetKernel(kernel);
+    CALC_CRC_Init(&crc, &conf, type);
+    CALC_CRC_SetKernel(CALC_CRC_KERNEL_AUTO);
+    CALC_CRC_GetKernel(&crc, &bound);
+    if (bound != kernel)
+    {
+        state.SkipWithError("Kernel tier not available for this CPU");
+        return;
+    }
+
+    const uint8_t *data = calc_crc_bench_data(0);
+    uint64_t cycles = calc_crc_bench_cycles();
+
+    for (auto _ : state)
+    {
+        CALC_CRC_Calculate(&crc, data, length, &result);
+        benchmark::DoNotOptimize(result);
+    }
+
+    cycles = calc_crc_bench_cycles() - cycles;
+    state.SetBytesProcessed((int64_t)state.iterations() * (int64_t)length);
+    _cycles_per_byte(state, cycles, length);
+}
+
+/**
+ * @brief   Sensitivity of streaming to the chunk length (1 MiB of CRC-32/ISO-HDLC passed to CALC_CRC_Update in chunks).
+ *          Arguments: chunk length.
+ */
+static void BM_UpdateChunk(benchmark::State &state)
+{
+    const size_t length = 1024u * 1024u;
+    size_t chunk = (size_t)state.range(0);
+    calc_crc_conf_t conf;
+    calc_crc_t crc;
+    uint32_t result = 0;
+
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC32_ISO_HDLC);
+
+    const uint8_t *data = calc_crc_bench_data(0);
+    uint64_t cycles = calc_crc_bench_cycles();
+
+    for (auto _ : state)
+    {
+        CALC_CRC_Start(&crc);
+        for (size_t i = 0; i < length; i += chunk)
+        {
+            CALC_CRC_Update(&crc, &data[i], chunk);
+        }
+        CALC_CRC_Finalize(&crc, &result);
+        benchmark::DoNotOptimize(result);
+    }
+
+    cycles = calc_crc_bench_cycles() - cycles;
+    state.SetBytesProcessed((int64_t)state.iterations() * (int64_t)length);
+    _cycles_per_byte(state, cycles, length);
+}
+
+/**
+ * @brief   CALC_CRC_Patch cost of a 16-byte patch in the middle of a record (CRC-32/ISO-HDLC), compare with
+ *          BM_Calculate of the record length.
+ *          Arguments: record length.
+ */
+static void BM_Patch(benchmark::State &state)
+{
+    size_t length = (size_t)state.range(0);
+    calc_crc_conf_t conf;
+    calc_crc_t crc;
+    uint32_t value = 0;
+    uint8_t patch[16] = {0};
+
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC32_ISO_HDLC);
+
+    const uint8_t *data = calc_crc_bench_data(0);
+    CALC_CRC_Calculate(&crc, data, length, &value);
+
+    for (auto _ : state)
+    {
+        uint32_t result = 0;
+        CALC_CRC_Patch(&crc, &value, length, length / 2u, &data[length / 2u], patch, sizeof(patch), &result);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+/**
+ * @brief   CALC_CRC_UpdateFill cost of a run of constant bytes (CRC-32/ISO-HDLC), bytes/s counts the bytes of the run.
+ *          Arguments: run length.
+ */
+static void BM_UpdateFill(benchmark::State &state)
+{
+    size_t length = (size_t)state.range(0);
+    calc_crc_conf_t conf;
+    calc_crc_t crc;
+    uint32_t result = 0;
+
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC32_ISO_HDLC);
+
+    for (auto _ : state)
+    {
+        CALC_CRC_Start(&crc);
+        CALC_CRC_UpdateFill(&crc, 0xA5u, length);
+        CALC_CRC_Finalize(&crc, &result);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed((int64_t)state.iterations() * (int64_t)length);
+}
+
+/**
+ * @brief   CALC_CRC_RollingScan throughput of a 48-byte window (CRC-32/ISO-HDLC, 13 compared bits, 8 KiB chunks on
+ *          average), bytes/s counts the scanned bytes (one window per byte).
+ *          Arguments: buffer length.
+ */
+static void BM_RollingScan(benchmark::State &state)
+{
+    size_t length = (size_t)state.range(0);
+    calc_crc_conf_t conf;
+    calc_crc_t crc;
+    calc_crc_rolling_t rolling;
+    std::vector<size_t> positions(length);
+    size_t found = 0;
+
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC32_ISO_HDLC);
+    CALC_CRC_RollingInit(&rolling, &crc, 48u);
+
+    const uint8_t *data = calc_crc_bench_data(0);
+    uint64_t cycles = calc_crc_bench_cycles();
+
+    for (auto _ : state)
+    {
+        CALC_CRC_RollingScan(&rolling, data, length, 0x1FFFu, 0u, positions.data(), positions.size(), &found);
+        benchmark::DoNotOptimize(found);
+    }
+
+    cycles = calc_crc_bench_cycles() - cycles;
+    state.SetBytesProcessed((int64_t)state.iterations() * (int64_t)length);
+    _cycles_per_byte(state, cycles, length);
+}
+
+// --- Benchmark Registration ------------------------------------------------------------------------------------------
+
+BENCHMARK(BM_Calculate)
+    ->ArgNames({"type", "reflected", "length", "offset", "kernel"})
+    ->ArgsProduct({
+        {CALC_CRC_TYPE_8BIT, CALC_CRC_TYPE_16BIT, CALC_CRC_TYPE_32BIT, CALC_CRC_TYPE_64BIT},
+        {0, 1},
+        benchmark::CreateRange(16, CALC_CRC_BENCH_SIZE_MAX, 16),
+        {0, 1},
+        {CALC_CRC_KERNEL_GENERIC, CALC_CRC_KERNEL_SLICING, CALC_CRC_KERNEL_SSE42, CALC_CRC_KERNEL_PCLMUL},
+    });
+
+BENCHMARK(BM_Batch)
+    ->ArgNames({"type", "reflected", "slices", "length", "batch"})
+    ->ArgsProduct({
+        {CALC_CRC_TYPE_32BIT, CALC_CRC_TYPE_64BIT},
+        {0, 1},
+        {0, CALC_CRC_BENCH_SLICES},
+        {64, 256, 1500},
+        {0, 1},
+    });
+
+BENCHMARK(BM_Checksum)
+    ->ArgNames({"type", "length", "kernel"})
+    ->ArgsProduct({
+        {CALC_CRC_TYPE_SUM8, CALC_CRC_TYPE_LRC8, CALC_CRC_TYPE_FLETCHER16, CALC_CRC_TYPE_FLETCHER32,
+         CALC_CRC_TYPE_FLETCHER64, CALC_CRC_TYPE_ADLER32, CALC_CRC_TYPE_INET16},
+        benchmark::CreateRange(64, CALC_CRC_BENCH_SIZE_MAX, 64),
+        {CALC_CRC_KERNEL_GENERIC, CALC_CRC_KERNEL_SSE2, CALC_CRC_KERNEL_AVX2},
+    });
+
+BENCHMARK(BM_Patch)->ArgName("length")->RangeMultiplier(16)->Range(4096, CALC_CRC_BENCH_SIZE_MAX);
+
+BENCHMARK(BM_UpdateFill)->ArgName("length")->RangeMultiplier(256)->Range(16, (int64_t)1 << 40);
+
+BENCHMARK(BM_RollingScan)->ArgName("length")->RangeMultiplier(16)->Range(4096, 16 * 1024 * 1024);
+
+BENCHMARK(BM_UpdateChunk)->ArgName("chunk")->RangeMultiplier(4)->Range(1, 1024 * 1024);
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,44 @@
+/***********************************************************************************************************************
+ *
+ * @file        main.cpp
+ * @brief       Benchmark platform start-up file to measure CALC-CRC component with Google Benchmark.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-11
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <benchmark/benchmark.h>
+
+#include "calc_crc/calc_crc.h"
+
+// --- Application Start-Up function -----------------------------------------------------------------------------------
+
+int32_t main(int argc, char **argv)
+{
+    static const char *const kernels[CALC_CRC_KERNEL_MAX] = {"auto",   "generic", "slicing", "sse42",
+                                                             "pclmul", "sse2",    "avx2"};
+    calc_crc_conf_t conf;
+    calc_crc_kernel_e kernel = CALC_CRC_KERNEL_AUTO;
+    calc_crc_t crc;
+
+    // Best kernel of the machine is stored with the results (JSON context), so runs on other machines are recognized
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC32_ISO_HDLC);
+    CALC_CRC_GetKernel(&crc, &kernel);
+    benchmark::AddCustomContext("calc_crc_kernel", kernels[kernel]);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -42,7 +42,30 @@
     ADD(calc_crc_update_32bit_valid)                                                                                   \
     ADD(calc_crc_update_64bit_valid)                                                                                   \
     ADD(calc_crc_finalize_null_handle)                                                                                 \
-    ADD(calc_crc_finalize_valid)
+    ADD(calc_crc_finalize_valid)                                                                                       \
+    ADD(calc_crc_calculate_reflected_valid)                                                                            \
+    ADD(calc_crc_init_slicing_invalid)                                                                                 \
+    ADD(calc_crc_calculate_slicing_valid)                                                                              \
+    ADD(calc_crc_calculate_folding_valid)                                                                              \
+    ADD(calc_crc_calculate_crc32c_valid)                                                                               \
+    ADD(calc_crc_kernel_force_valid)                                                                                   \
+    ADD(calc_crc_combine_valid)                                                                                        \
+    ADD(calc_crc_calculate_parallel_valid)                                                                             \
+    ADD(calc_crc_calculate_batch_valid)                                                                                \
+    ADD(calc_crc_init_tables_valid)                                                                                    \
+    ADD(calc_crc_init_model_valid)                                                                                     \
+    ADD(calc_crc_shared_stream_valid)                                                                                  \
+    ADD(calc_crc_engine_valid)                                                                                         \
+    ADD(calc_crc_width_valid)                                                                                          \
+    ADD(calc_crc_update_chunks_valid)                                                                                  \
+    ADD(calc_crc_file_valid)                                                                                           \
+    ADD(calc_crc_vec_valid)                                                                                            \
+    ADD(calc_crc_files_valid)                                                                                          \
+    ADD(calc_crc_checksum_valid)                                                                                       \
+    ADD(calc_crc_inet_valid)                                                                                           \
+    ADD(calc_crc_patch_valid)                                                                                          \
+    ADD(calc_crc_fill_valid)                                                                                           \
+    ADD(calc_crc_rolling_valid)
 
 // --- CTest Configurations --------------------------------------------------------------------------------------------
 
@@ -119,7 +142,6 @@ static int32_t test_calc_crc_init_valid(void)
     CTEST_ASSERT_EQ_MSG(false, crc.update_in_progress, "Expected %d, but got %d.", false, crc.update_in_progress);
     CTEST_ASSERT_EQ_MSG(0, crc.update_chunk, "Expected %d, but got %d.", 0, crc.update_chunk);
     CTEST_ASSERT_EQ_MSG(0, crc.update_crc, "Expected %d, but got %d.", 0, crc.update_crc);
-    CTEST_ASSERT_EQ_MSG(0, crc.update_crc_final, "Expected %d, but got %d.", 0, crc.update_crc_final);
     CTEST_ASSERT_EQ_MSG(&conf, crc.conf, "Expected %d, but got %d.", &conf, crc.conf);
 
     return failed_assertions;
@@ -479,7 +501,6 @@ static int32_t test_calc_crc_update_8bit_valid(void)
     CTEST_ASSERT_EQ_MSG(false, crc.update_in_progress, "Expected %d, but got %d.", false, crc.update_in_progress);
     CTEST_ASSERT_EQ_MSG(0, crc.update_chunk, "Expected %d, but got %d.", 0, crc.update_chunk);
     CTEST_ASSERT_EQ_MSG(0, crc.update_crc, "Expected %d, but got %d.", 0, crc.update_crc);
-    CTEST_ASSERT_EQ_MSG(0, crc.update_crc_final, "Expected %d, but got %d.", 0, crc.update_crc_final);
     CTEST_ASSERT_EQ_MSG(&conf, crc.conf, "Expected %d, but got %d.", &conf, crc.conf);
 
     result = CALC_CRC_Calculate(&crc, data, data_length, &output);
@@ -728,4 +749,1781 @@ static int32_t test_calc_crc_finalize_valid(void)
     return failed_assertions;
 }
 
+static int32_t test_calc_crc_calculate_reflected_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    uint8_t data[] = "123456789";
+    uint16_t data_length = sizeof(data) - 1;
+
+    // CRC-16/ARC
+    uint16_t result_16bit;
+    calc_crc_16bit_t conf_16bit = {
+        .polynomial = 0x8005,
+        .initial_value = 0,
+        .final_value = 0,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    result = CALC_CRC_Init(&crc, &conf_16bit, CALC_CRC_TYPE_16BIT);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p) -> Expected %d, but got %d.", &crc, &conf_16bit,
+                        CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(true, crc.reflected_table, "Expected %d, but got %d.", true, crc.reflected_table);
+
+    result = CALC_CRC_Calculate(&crc, data, data_length, &result_16bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Calculate(%p, %p, %d, %p) -> Expected %d, but got %d.", &crc,
+                        data, data_length, &result_16bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(0xBB3D, result_16bit, "Expected %04X, but got %04X.", 0xBB3D, result_16bit);
+
+    // CRC-32/ISO-HDLC
+    uint32_t result_32bit;
+    calc_crc_32bit_t conf_32bit = {
+        .polynomial = CALC_CRC_32BIT_POLYNOMIAL,
+        .initial_value = UINT32_MAX,
+        .final_value = UINT32_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    result = CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p) -> Expected %d, but got %d.", &crc, &conf_32bit,
+                        CALC_CRC_STATUS_OK, result);
+
+    result = CALC_CRC_Calculate(&crc, data, data_length, &result_32bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Calculate(%p, %p, %d, %p) -> Expected %d, but got %d.", &crc,
+                        data, data_length, &result_32bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(0xCBF43926, result_32bit, "Expected %08X, but got %08X.", 0xCBF43926, result_32bit);
+
+    // Reflected table with non-reflected input (CRC-32/BZIP2)
+    conf_32bit.input_reflected = false;
+    conf_32bit.output_reflected = false;
+    result = CALC_CRC_Calculate(&crc, data, data_length, &result_32bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Calculate(%p, %p, %d, %p) -> Expected %d, but got %d.", &crc,
+                        data, data_length, &result_32bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(0xFC891918, result_32bit, "Expected %08X, but got %08X.", 0xFC891918, result_32bit);
+
+    // CRC-64/XZ
+    uint64_t result_64bit;
+    calc_crc_64bit_t conf_64bit = {
+        .polynomial = CALC_CRC_64BIT_POLYNOMIAL,
+        .initial_value = UINT64_MAX,
+        .final_value = UINT64_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    result = CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p) -> Expected %d, but got %d.", &crc, &conf_64bit,
+                        CALC_CRC_STATUS_OK, result);
+
+    result = CALC_CRC_Update(&crc, data, data_length - 4);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Update(%p, %p, %d) -> Expected %d, but got %d.", &crc, data,
+                        data_length - 4, CALC_CRC_STATUS_OK, result);
+
+    result = CALC_CRC_Update(&crc, data + (data_length - 4), 4);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Update(%p, %p, %d) -> Expected %d, but got %d.", &crc, data,
+                        4, CALC_CRC_STATUS_OK, result);
+
+    result = CALC_CRC_Finalize(&crc, &result_64bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Finalize(%p, %p) -> Expected %d, but got %d.", &crc,
+                        &result_64bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(0x995DC9BBDF1939FA, result_64bit, "Expected %016llX, but got %016llX.",
+                        (unsigned long long)0x995DC9BBDF1939FA, (unsigned long long)result_64bit);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_init_slicing_invalid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    uint32_t slice_table[CALC_CRC_SLICE_TABLE_SIZE(8)];
+
+    calc_crc_32bit_t conf = {
+        .polynomial = CALC_CRC_32BIT_POLYNOMIAL,
+        .initial_value = UINT32_MAX,
+        .final_value = UINT32_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+        .slices = 8,
+        .slice_table = NULL,
+    };
+
+    // Test missing slicing table storage
+    result = CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_32BIT);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_Init(%p, %p) -> Expected %d, but got %d.", &crc,
+                        &conf, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Test unsupported slicing step
+    conf.slices = 6;
+    conf.slice_table = slice_table;
+    result = CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_32BIT);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_Init(%p, %p) -> Expected %d, but got %d.", &crc,
+                        &conf, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_calculate_slicing_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    uint8_t data[1021];
+    uint8_t slices[] = {4, 8, 16};
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 31u) ^ (i >> 3));
+    }
+
+    for (size_t s = 0; s < sizeof(slices); s++)
+    {
+        for (uint8_t reflected = 0; reflected < 2; reflected++)
+        {
+            uint16_t expected_16bit;
+            uint16_t result_16bit;
+            uint16_t slice_table_16bit[CALC_CRC_SLICE_TABLE_SIZE(16)];
+            calc_crc_16bit_t conf_16bit = {
+                .polynomial = CALC_CRC_16BIT_POLYNOMIAL,
+                .initial_value = UINT16_MAX,
+                .final_value = 0,
+                .input_reflected = (bool)reflected,
+                .output_reflected = (bool)reflected,
+            };
+
+            CALC_CRC_Init(&crc, &conf_16bit, CALC_CRC_TYPE_16BIT);
+            CALC_CRC_Calculate(&crc, data, sizeof(data), &expected_16bit);
+
+            conf_16bit.slices = slices[s];
+            conf_16bit.slice_table = slice_table_16bit;
+            result = CALC_CRC_Init(&crc, &conf_16bit, CALC_CRC_TYPE_16BIT);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p) -> Expected %d, but got %d.", &crc,
+                                &conf_16bit, CALC_CRC_STATUS_OK, result);
+            CALC_CRC_Calculate(&crc, data, sizeof(data), &result_16bit);
+            CTEST_ASSERT_EQ_MSG(expected_16bit, result_16bit, "Slices %u -> Expected %04X, but got %04X.", slices[s],
+                                expected_16bit, result_16bit);
+
+            uint32_t expected_32bit;
+            uint32_t result_32bit;
+            uint32_t slice_table_32bit[CALC_CRC_SLICE_TABLE_SIZE(16)];
+            calc_crc_32bit_t conf_32bit = {
+                .polynomial = CALC_CRC_32BIT_POLYNOMIAL,
+                .initial_value = UINT32_MAX,
+                .final_value = UINT32_MAX,
+                .input_reflected = (bool)reflected,
+                .output_reflected = (bool)reflected,
+            };
+
+            CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+            CALC_CRC_Calculate(&crc, data, sizeof(data), &expected_32bit);
+
+            conf_32bit.slices = slices[s];
+            conf_32bit.slice_table = slice_table_32bit;
+            result = CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p) -> Expected %d, but got %d.", &crc,
+                                &conf_32bit, CALC_CRC_STATUS_OK, result);
+            CALC_CRC_Calculate(&crc, data, sizeof(data), &result_32bit);
+            CTEST_ASSERT_EQ_MSG(expected_32bit, result_32bit, "Slices %u -> Expected %08X, but got %08X.", slices[s],
+                                expected_32bit, result_32bit);
+
+            uint64_t expected_64bit;
+            uint64_t result_64bit;
+            uint64_t slice_table_64bit[CALC_CRC_SLICE_TABLE_SIZE(16)];
+            calc_crc_64bit_t conf_64bit = {
+                .polynomial = CALC_CRC_64BIT_POLYNOMIAL,
+                .initial_value = UINT64_MAX,
+                .final_value = UINT64_MAX,
+                .input_reflected = (bool)reflected,
+                .output_reflected = (bool)reflected,
+            };
+
+            CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+            CALC_CRC_Calculate(&crc, data, sizeof(data), &expected_64bit);
+
+            conf_64bit.slices = slices[s];
+            conf_64bit.slice_table = slice_table_64bit;
+            result = CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p) -> Expected %d, but got %d.", &crc,
+                                &conf_64bit, CALC_CRC_STATUS_OK, result);
+            CALC_CRC_Calculate(&crc, data, sizeof(data), &result_64bit);
+            CTEST_ASSERT_EQ_MSG(expected_64bit, result_64bit, "Slices %u -> Expected %016llX, but got %016llX.",
+                                slices[s], (unsigned long long)expected_64bit, (unsigned long long)result_64bit);
+        }
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_calculate_folding_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    uint8_t data[4099];
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 131u) ^ (i >> 5));
+    }
+
+    for (uint8_t reflected = 0; reflected < 2; reflected++)
+    {
+        // Large buffer in one call (folding engine when available) against chunks too short to fold (table engine)
+        uint16_t expected_16bit;
+        uint16_t result_16bit;
+        calc_crc_16bit_t conf_16bit = {
+            .polynomial = 0x8005,
+            .initial_value = 0x1234,
+            .final_value = 0,
+            .input_reflected = (bool)reflected,
+            .output_reflected = (bool)reflected,
+        };
+
+        CALC_CRC_Init(&crc, &conf_16bit, CALC_CRC_TYPE_16BIT);
+        for (size_t i = 0; i < sizeof(data); i += 63)
+        {
+            CALC_CRC_Update(&crc, &data[i], ((sizeof(data) - i) < 63) ? (sizeof(data) - i) : 63);
+        }
+        CALC_CRC_Finalize(&crc, &expected_16bit);
+
+        result = CALC_CRC_Calculate(&crc, data, sizeof(data), &result_16bit);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Calculate(%p, %p, %zu, %p) -> Expected %d, but got %d.",
+                            &crc, data, sizeof(data), &result_16bit, CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(expected_16bit, result_16bit, "Expected %04X, but got %04X.", expected_16bit, result_16bit);
+
+        uint32_t expected_32bit;
+        uint32_t result_32bit;
+        calc_crc_32bit_t conf_32bit = {
+            .polynomial = 0x1EDC6F41,
+            .initial_value = UINT32_MAX,
+            .final_value = UINT32_MAX,
+            .input_reflected = (bool)reflected,
+            .output_reflected = (bool)reflected,
+        };
+
+        CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+        for (size_t i = 0; i < sizeof(data); i += 63)
+        {
+            CALC_CRC_Update(&crc, &data[i], ((sizeof(data) - i) < 63) ? (sizeof(data) - i) : 63);
+        }
+        CALC_CRC_Finalize(&crc, &expected_32bit);
+
+        result = CALC_CRC_Calculate(&crc, data, sizeof(data), &result_32bit);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Calculate(%p, %p, %zu, %p) -> Expected %d, but got %d.",
+                            &crc, data, sizeof(data), &result_32bit, CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(expected_32bit, result_32bit, "Expected %08X, but got %08X.", expected_32bit, result_32bit);
+
+        uint64_t expected_64bit;
+        uint64_t result_64bit;
+        calc_crc_64bit_t conf_64bit = {
+            .polynomial = CALC_CRC_64BIT_POLYNOMIAL,
+            .initial_value = UINT64_MAX,
+            .final_value = UINT64_MAX,
+            .input_reflected = (bool)reflected,
+            .output_reflected = (bool)reflected,
+        };
+
+        CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+        for (size_t i = 0; i < sizeof(data); i += 63)
+        {
+            CALC_CRC_Update(&crc, &data[i], ((sizeof(data) - i) < 63) ? (sizeof(data) - i) : 63);
+        }
+        CALC_CRC_Finalize(&crc, &expected_64bit);
+
+        result = CALC_CRC_Calculate(&crc, data, sizeof(data), &result_64bit);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Calculate(%p, %p, %zu, %p) -> Expected %d, but got %d.",
+                            &crc, data, sizeof(data), &result_64bit, CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(expected_64bit, result_64bit, "Expected %016llX, but got %016llX.",
+                            (unsigned long long)expected_64bit, (unsigned long long)result_64bit);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_calculate_crc32c_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    uint32_t expected_32bit;
+    uint32_t result_32bit;
+    static uint8_t data[30011];
+    calc_crc_32bit_t conf_32bit = {
+        .polynomial = 0x1EDC6F41,
+        .initial_value = UINT32_MAX,
+        .final_value = UINT32_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    // CRC-32C check value (hardware instruction when available)
+    CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+    result = CALC_CRC_Calculate(&crc, (const uint8_t *)"123456789", 9, &result_32bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Calculate(%p, %p, %zu, %p) -> Expected %d, but got %d.",
+                        &crc, "123456789", (size_t)9, &result_32bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(0xE3069283, result_32bit, "Expected %08X, but got %08X.", 0xE3069283, result_32bit);
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 167u) ^ (i >> 7));
+    }
+
+    // Buffer long enough for interleaved streams, unaligned start, against table engine with mirrored bytes
+    conf_32bit.input_reflected = false;
+    CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+    conf_32bit.input_reflected = true;
+    CALC_CRC_Calculate(&crc, &data[3], sizeof(data) - 3, &expected_32bit);
+
+    CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+    result = CALC_CRC_Calculate(&crc, &data[3], sizeof(data) - 3, &result_32bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Calculate(%p, %p, %zu, %p) -> Expected %d, but got %d.",
+                        &crc, &data[3], sizeof(data) - 3, &result_32bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(expected_32bit, result_32bit, "Expected %08X, but got %08X.", expected_32bit, result_32bit);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_kernel_force_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_kernel_e kernel;
+    calc_crc_t crc;
+    uint32_t expected_32bit = 0;
+    uint32_t result_32bit;
+    uint32_t slice_table[CALC_CRC_SLICE_TABLE_SIZE(8)];
+    static uint8_t data[1000];
+    calc_crc_32bit_t conf_32bit = {
+        .polynomial = 0x1EDC6F41,
+        .initial_value = UINT32_MAX,
+        .final_value = UINT32_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+        .slices = 8,
+        .slice_table = slice_table,
+    };
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 29u) ^ (i >> 3));
+    }
+
+    result = CALC_CRC_SetKernel(CALC_CRC_KERNEL_MAX);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_SetKernel(%d) -> Expected %d, but got %d.",
+                        CALC_CRC_KERNEL_MAX, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = CALC_CRC_GetKernel(&crc, NULL);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_GetKernel(%p, NULL) -> Expected %d, but got %d.",
+                        &crc, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Every forced tier gives the same result, tier is never higher than the forced one
+    for (uint8_t force = CALC_CRC_KERNEL_GENERIC; force < CALC_CRC_KERNEL_MAX; force++)
+    {
+        result = CALC_CRC_SetKernel((calc_crc_kernel_e)force);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_SetKernel(%d) -> Expected %d, but got %d.", force,
+                            CALC_CRC_STATUS_OK, result);
+
+        CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+        result = CALC_CRC_GetKernel(&crc, &kernel);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_GetKernel(%p, %p) -> Expected %d, but got %d.", &crc,
+                            &kernel, CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(true, kernel <= force, "Expected kernel <= %d, but got %d.", force, kernel);
+        if (CALC_CRC_KERNEL_SSE42 > force)
+        {
+            CTEST_ASSERT_EQ_MSG(force, kernel, "Expected %d, but got %d.", force, kernel);
+        }
+
+        result = CALC_CRC_Calculate(&crc, data, sizeof(data), &result_32bit);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Calculate(%p, %p, %zu, %p) -> Expected %d, but got %d.",
+                            &crc, data, sizeof(data), &result_32bit, CALC_CRC_STATUS_OK, result);
+        if (CALC_CRC_KERNEL_GENERIC == force)
+        {
+            expected_32bit = result_32bit;
+        }
+        CTEST_ASSERT_EQ_MSG(expected_32bit, result_32bit, "Expected %08X, but got %08X.", expected_32bit, result_32bit);
+    }
+
+    CALC_CRC_SetKernel(CALC_CRC_KERNEL_AUTO);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_combine_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    const uint8_t *data = (const uint8_t *)"123456789";
+
+    uint16_t crc_a_16bit, crc_b_16bit, result_16bit;
+    calc_crc_16bit_t conf_16bit = {
+        .polynomial = 0x1021,
+        .initial_value = 0xFFFF,
+        .final_value = 0,
+        .input_reflected = false,
+        .output_reflected = false,
+    };
+
+    // CRC-16/CCITT-FALSE of "1234" and "56789"
+    CALC_CRC_Init(&crc, &conf_16bit, CALC_CRC_TYPE_16BIT);
+    CALC_CRC_Calculate(&crc, data, 4, &crc_a_16bit);
+    CALC_CRC_Calculate(&crc, &data[4], 5, &crc_b_16bit);
+    result = CALC_CRC_Combine(&crc, &crc_a_16bit, &crc_b_16bit, 5, &result_16bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Combine(%p, %p, %p, %zu, %p) -> Expected %d, but got %d.",
+                        &crc, &crc_a_16bit, &crc_b_16bit, (size_t)5, &result_16bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(0x29B1, result_16bit, "Expected %04X, but got %04X.", 0x29B1, result_16bit);
+
+    result = CALC_CRC_Combine(&crc, &crc_a_16bit, NULL, 5, &result_16bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result,
+                        "CALC_CRC_Combine(%p, %p, NULL, %zu, %p) -> Expected %d, but got %d.", &crc, &crc_a_16bit,
+                        (size_t)5, &result_16bit, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    uint32_t crc_a_32bit, crc_b_32bit, result_32bit;
+    calc_crc_32bit_t conf_32bit = {
+        .polynomial = 0x04C11DB7,
+        .initial_value = UINT32_MAX,
+        .final_value = UINT32_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    // CRC-32 of "12345678" and "9"
+    CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+    CALC_CRC_Calculate(&crc, data, 8, &crc_a_32bit);
+    CALC_CRC_Calculate(&crc, &data[8], 1, &crc_b_32bit);
+    result = CALC_CRC_Combine(&crc, &crc_a_32bit, &crc_b_32bit, 1, &result_32bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Combine(%p, %p, %p, %zu, %p) -> Expected %d, but got %d.",
+                        &crc, &crc_a_32bit, &crc_b_32bit, (size_t)1, &result_32bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(0xCBF43926, result_32bit, "Expected %08X, but got %08X.", 0xCBF43926, result_32bit);
+
+    uint64_t crc_a_64bit, crc_b_64bit, result_64bit;
+    calc_crc_64bit_t conf_64bit = {
+        .polynomial = 0x42F0E1EBA9EA3693,
+        .initial_value = UINT64_MAX,
+        .final_value = UINT64_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    // CRC-64/XZ of "1" and "23456789"
+    CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+    CALC_CRC_Calculate(&crc, data, 1, &crc_a_64bit);
+    CALC_CRC_Calculate(&crc, &data[1], 8, &crc_b_64bit);
+    result = CALC_CRC_Combine(&crc, &crc_a_64bit, &crc_b_64bit, 8, &result_64bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Combine(%p, %p, %p, %zu, %p) -> Expected %d, but got %d.",
+                        &crc, &crc_a_64bit, &crc_b_64bit, (size_t)8, &result_64bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(0x995DC9BBDF1939FA, result_64bit, "Expected %016llX, but got %016llX.",
+                        (unsigned long long)0x995DC9BBDF1939FA, (unsigned long long)result_64bit);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_calculate_parallel_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    uint64_t expected_64bit;
+    uint64_t result_64bit;
+    static uint8_t data[100003];
+    calc_crc_64bit_t conf_64bit = {
+        .polynomial = 0x42F0E1EBA9EA3693,
+        .initial_value = UINT64_MAX,
+        .final_value = UINT64_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 73u) ^ (i >> 11));
+    }
+
+    result = CALC_CRC_SetParallel(4, 0);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_SetParallel(4, 0) -> Expected %d, but got %d.",
+                        CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Four threads, spans of at least 4 KiB (last span shorter)
+    result = CALC_CRC_SetParallel(4, 4096);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_SetParallel(4, 4096) -> Expected %d, but got %d.",
+                        CALC_CRC_STATUS_OK, result);
+
+    CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+    CALC_CRC_Calculate(&crc, data, sizeof(data), &expected_64bit);
+
+    result = CALC_CRC_CalculateParallel(&crc, data, sizeof(data), &result_64bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result,
+                        "CALC_CRC_CalculateParallel(%p, %p, %zu, %p) -> Expected %d, but got %d.", &crc, data,
+                        sizeof(data), &result_64bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(expected_64bit, result_64bit, "Expected %016llX, but got %016llX.",
+                        (unsigned long long)expected_64bit, (unsigned long long)result_64bit);
+
+    // Back-to-back calls of several widths and checksums, each job starts while workers may still leave the previous
+    static const calc_crc_model_e models[] = {
+        CALC_CRC_MODEL_CRC8_SMBUS,  CALC_CRC_MODEL_CRC16_ARC, CALC_CRC_MODEL_CRC32_ISO_HDLC, CALC_CRC_MODEL_CRC40_GSM,
+        CALC_CRC_MODEL_FLETCHER32,  CALC_CRC_MODEL_ADLER32,   CALC_CRC_MODEL_INTERNET16,
+    };
+    calc_crc_conf_t conf;
+
+    for (size_t n = 0; n < 64; n++)
+    {
+        size_t m = n % (sizeof(models) / sizeof(models[0]));
+        size_t length = sizeof(data) - (n * 7u);
+
+        expected_64bit = 0;
+        result_64bit = 0;
+        CALC_CRC_InitModel(&crc, &conf, models[m]);
+        CALC_CRC_Calculate(&crc, data, length, &expected_64bit);
+        result = CALC_CRC_CalculateParallel(&crc, data, length, &result_64bit);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateParallel -> Expected %d, but got %d.",
+                            CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(expected_64bit, result_64bit, "Call %zu, model %zu: Expected %016llX, but got %016llX.", n,
+                            m, (unsigned long long)expected_64bit, (unsigned long long)result_64bit);
+    }
+
+    result = CALC_CRC_CalculateParallel(&crc, data, 0, &result_64bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result,
+                        "CALC_CRC_CalculateParallel(%p, %p, 0, %p) -> Expected %d, but got %d.", &crc, data,
+                        &result_64bit, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    CALC_CRC_SetParallel(0, 1024u * 1024u);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_calculate_batch_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    static uint8_t data[4000];
+    const void *buffers[7];
+    size_t lengths[7] = {64, 1500, 100, 9, 577, 64, 1};
+    uint16_t results_16bit[7];
+    uint32_t results_32bit[7];
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 53u) ^ (i >> 6));
+    }
+    for (size_t i = 0; i < 7; i++)
+    {
+        buffers[i] = &data[i * 331u];
+    }
+
+    // Every buffer gives the same result as single buffer calculation (groups of 4 are interleaved)
+    calc_crc_16bit_t conf_16bit = {
+        .polynomial = 0x1021,
+        .initial_value = 0xFFFF,
+        .final_value = 0,
+        .input_reflected = false,
+        .output_reflected = false,
+    };
+
+    CALC_CRC_Init(&crc, &conf_16bit, CALC_CRC_TYPE_16BIT);
+    result = CALC_CRC_CalculateBatch(&crc, buffers, lengths, results_16bit, 7);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateBatch(%p, %p, %p, %p, 7) -> Expected %d, but got %d.",
+                        &crc, buffers, lengths, results_16bit, CALC_CRC_STATUS_OK, result);
+    for (size_t i = 0; i < 7; i++)
+    {
+        uint16_t expected_16bit;
+        CALC_CRC_Calculate(&crc, buffers[i], lengths[i], &expected_16bit);
+        CTEST_ASSERT_EQ_MSG(expected_16bit, results_16bit[i], "Expected %04X, but got %04X.", expected_16bit,
+                            results_16bit[i]);
+    }
+
+    calc_crc_32bit_t conf_32bit = {
+        .polynomial = 0x1EDC6F41,
+        .initial_value = UINT32_MAX,
+        .final_value = UINT32_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+    result = CALC_CRC_CalculateBatch(&crc, buffers, lengths, results_32bit, 7);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateBatch(%p, %p, %p, %p, 7) -> Expected %d, but got %d.",
+                        &crc, buffers, lengths, results_32bit, CALC_CRC_STATUS_OK, result);
+    for (size_t i = 0; i < 7; i++)
+    {
+        uint32_t expected_32bit;
+        CALC_CRC_Calculate(&crc, buffers[i], lengths[i], &expected_32bit);
+        CTEST_ASSERT_EQ_MSG(expected_32bit, results_32bit[i], "Expected %08X, but got %08X.", expected_32bit,
+                            results_32bit[i]);
+    }
+
+    // Invalid buffer is detected before anything is calculated
+    lengths[5] = 0;
+    result = CALC_CRC_CalculateBatch(&crc, buffers, lengths, results_32bit, 7);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result,
+                        "CALC_CRC_CalculateBatch(%p, %p, %p, %p, 7) -> Expected %d, but got %d.", &crc, buffers, lengths,
+                        results_32bit, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_init_tables_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    static uint8_t data[1000];
+    uint32_t expected_32bit, result_32bit;
+    uint64_t expected_64bit, result_64bit;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 29u) ^ (i >> 3));
+    }
+
+    // Precomputed tables give the same result as generated tables (table engine and slicing-by-8 rows)
+    calc_crc_32bit_t conf_32bit = {
+        .polynomial = 0x1EDC6F41,
+        .initial_value = UINT32_MAX,
+        .final_value = UINT32_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+    CALC_CRC_Calculate(&crc, data, sizeof(data), &expected_32bit);
+    for (uint8_t slices = 0; slices <= 8u; slices += 8u)
+    {
+        conf_32bit.slices = slices;
+        conf_32bit.tables = &calc_crc_tables_crc32c;
+        result = CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p, CALC_CRC_TYPE_32BIT) -> Expected %d, "
+                            "but got %d.", &crc, &conf_32bit, CALC_CRC_STATUS_OK, result);
+        CALC_CRC_Calculate(&crc, data, sizeof(data), &result_32bit);
+        CTEST_ASSERT_EQ_MSG(expected_32bit, result_32bit, "Expected %08X, but got %08X.", expected_32bit, result_32bit);
+    }
+
+    calc_crc_64bit_t conf_64bit = {
+        .polynomial = 0x42F0E1EBA9EA3693,
+        .initial_value = UINT64_MAX,
+        .final_value = UINT64_MAX,
+        .input_reflected = false,
+        .output_reflected = false,
+        .slices = 8,
+        .tables = &calc_crc_tables_crc64_ecma,
+    };
+
+    CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+    CALC_CRC_Calculate(&crc, data, sizeof(data), &result_64bit);
+    conf_64bit.slices = 0;
+    conf_64bit.tables = NULL;
+    CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+    CALC_CRC_Calculate(&crc, data, sizeof(data), &expected_64bit);
+    CTEST_ASSERT_EQ_MSG(expected_64bit, result_64bit, "Expected %016llX, but got %016llX.",
+                        (unsigned long long)expected_64bit, (unsigned long long)result_64bit);
+
+    // Tables of another polynomial or reflection are rejected
+    conf_32bit.tables = &calc_crc_tables_crc32;
+    result = CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_Init(%p, %p, CALC_CRC_TYPE_32BIT) -> "
+                        "Expected %d, but got %d.", &crc, &conf_32bit, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+    conf_32bit.tables = &calc_crc_tables_crc32_bzip2;
+    conf_32bit.polynomial = 0x04C11DB7;
+    result = CALC_CRC_Init(&crc, &conf_32bit, CALC_CRC_TYPE_32BIT);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_Init(%p, %p, CALC_CRC_TYPE_32BIT) -> "
+                        "Expected %d, but got %d.", &crc, &conf_32bit, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_init_model_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_conf_t conf;
+    calc_crc_model_e model;
+    const calc_crc_model_t *info;
+    const uint8_t check_data[] = "123456789";
+
+    // Every catalogue model gives its check value
+    for (size_t i = 0; i < (size_t)CALC_CRC_MODEL_MAX; i++)
+    {
+        uint64_t value = 0;
+
+        CALC_CRC_GetModel((calc_crc_model_e)i, &info);
+        result = CALC_CRC_InitModel(&crc, &conf, (calc_crc_model_e)i);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_InitModel(%p, %p, %d) -> Expected %d, but got %d.",
+                            &crc, &conf, (int)i, CALC_CRC_STATUS_OK, result);
+        CALC_CRC_Calculate(&crc, check_data, 9, &value); // Little-endian host, value holds the CRC in its low bytes.
+        CTEST_ASSERT_EQ_MSG(info->check, value, "%s: Expected %016llX, but got %016llX.", info->name,
+                            (unsigned long long)info->check, (unsigned long long)value);
+    }
+
+    // Names and aliases are found ignoring case and separators
+    result = CALC_CRC_FindModel("crc32c", &model);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_FindModel(crc32c) -> Expected %d, but got %d.",
+                        CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_MODEL_CRC32_ISCSI, model, "Expected %d, but got %d.", CALC_CRC_MODEL_CRC32_ISCSI,
+                        model);
+    result = CALC_CRC_FindModel("CRC-16/CCITT-FALSE", &model);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_MODEL_CRC16_IBM_3740, model, "Expected %d, but got %d.",
+                        CALC_CRC_MODEL_CRC16_IBM_3740, model);
+
+    uint16_t value_16bit;
+    result = CALC_CRC_InitName(&crc, &conf, "crc-16/modbus");
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_InitName(%p, %p, crc-16/modbus) -> Expected %d, but "
+                        "got %d.", &crc, &conf, CALC_CRC_STATUS_OK, result);
+    CALC_CRC_Calculate(&crc, check_data, 9, &value_16bit);
+    CTEST_ASSERT_EQ_MSG(0x4B37, value_16bit, "Expected %04X, but got %04X.", 0x4B37, value_16bit);
+
+    // Unknown names and ids are rejected
+    result = CALC_CRC_InitName(&crc, &conf, "CRC-32/UNKNOWN");
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_InitName(%p, %p, CRC-32/UNKNOWN) -> "
+                        "Expected %d, but got %d.", &crc, &conf, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+    result = CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_MAX);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_InitModel(%p, %p, MAX) -> Expected %d, "
+                        "but got %d.", &crc, &conf, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_shared_stream_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_shared_t *model_a;
+    calc_crc_shared_t *model_b;
+    calc_crc_shared_t *model_c;
+    calc_crc_stream_t streams[3];
+    const calc_crc_model_t *info;
+    static uint8_t data[3000];
+    uint32_t expected, value;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 131u) ^ (i >> 4));
+    }
+
+    // Identical parameters are interned into one model (catalogue entry or own parameters with unused high bits)
+    calc_crc_model_t params = {
+        .type = CALC_CRC_TYPE_32BIT,
+        .polynomial = 0xFFFFFFFF04C11DB7,
+        .initial_value = UINT32_MAX,
+        .final_value = UINT32_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    CALC_CRC_GetModel(CALC_CRC_MODEL_CRC32_ISO_HDLC, &info);
+    result = CALC_CRC_SharedAcquire(info, &model_a);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_SharedAcquire(%p, %p) -> Expected %d, but got %d.", info,
+                        &model_a, CALC_CRC_STATUS_OK, result);
+    CALC_CRC_SharedAcquire(&params, &model_b);
+    CTEST_ASSERT_EQ_MSG(model_a, model_b, "Expected %p, but got %p.", model_a, model_b);
+    params.final_value = 0;
+    CALC_CRC_SharedAcquire(&params, &model_c);
+    CTEST_ASSERT_EQ_MSG(true, (model_a != model_c), "Expected other model than %p, but got %p.", model_a, model_c);
+
+    // Interleaved streams on one model give the same results as one-shot calculation
+    CALC_CRC_SharedCalculate(model_a, data, sizeof(data), &expected);
+    for (size_t s = 0; s < 3; s++)
+    {
+        CALC_CRC_StreamInit(&streams[s], model_b);
+    }
+    for (size_t offset = 0; offset < sizeof(data); offset += 500u)
+    {
+        for (size_t s = 0; s < 3; s++)
+        {
+            CALC_CRC_StreamUpdate(&streams[s], &data[offset], 500u);
+        }
+    }
+    for (size_t s = 0; s < 3; s++)
+    {
+        result = CALC_CRC_StreamFinalize(&streams[s], &value);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_StreamFinalize(%p, %p) -> Expected %d, but got %d.",
+                            &streams[s], &value, CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(expected, value, "Expected %08X, but got %08X.", expected, value);
+    }
+    result = CALC_CRC_StreamFinalize(&streams[0], &value);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_UPDATE_NOT_STARTED, result, "CALC_CRC_StreamFinalize(%p, %p) -> "
+                        "Expected %d, but got %d.", &streams[0], &value, CALC_CRC_STATUS_ERROR_UPDATE_NOT_STARTED,
+                        result);
+
+    // Model stays cached until the last reference is released
+    CALC_CRC_SharedRelease(model_a);
+    CALC_CRC_SharedCalculate(model_b, data, sizeof(data), &value);
+    CTEST_ASSERT_EQ_MSG(expected, value, "Expected %08X, but got %08X.", expected, value);
+    CALC_CRC_SharedRelease(model_b);
+    CALC_CRC_SharedRelease(model_c);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_engine_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    static uint8_t data[700];
+    uint16_t expected_16bit, result_16bit;
+    uint64_t expected_64bit, result_64bit;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 71u) ^ (i >> 2));
+    }
+
+    // Nibble and bitwise engines give the same results as the lookup table (also through folding)
+    calc_crc_16bit_t conf_16bit = {
+        .polynomial = 0x1021,
+        .initial_value = 0xFFFF,
+        .final_value = 0x0000,
+        .input_reflected = false,
+        .output_reflected = false,
+    };
+    calc_crc_64bit_t conf_64bit = {
+        .polynomial = 0x42F0E1EBA9EA3693,
+        .initial_value = UINT64_MAX,
+        .final_value = UINT64_MAX,
+        .input_reflected = true,
+        .output_reflected = true,
+    };
+
+    CALC_CRC_Init(&crc, &conf_16bit, CALC_CRC_TYPE_16BIT);
+    CALC_CRC_Calculate(&crc, data, sizeof(data), &expected_16bit);
+    CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+    CALC_CRC_Calculate(&crc, data, sizeof(data), &expected_64bit);
+    for (uint8_t engine = CALC_CRC_ENGINE_NIBBLE; engine < CALC_CRC_ENGINE_MAX; engine++)
+    {
+        conf_16bit.engine = engine;
+        result = CALC_CRC_Init(&crc, &conf_16bit, CALC_CRC_TYPE_16BIT);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p, CALC_CRC_TYPE_16BIT) -> Expected %d, "
+                            "but got %d.", &crc, &conf_16bit, CALC_CRC_STATUS_OK, result);
+        CALC_CRC_Calculate(&crc, data, sizeof(data), &result_16bit);
+        CTEST_ASSERT_EQ_MSG(expected_16bit, result_16bit, "Expected %04X, but got %04X.", expected_16bit,
+                            result_16bit);
+
+        conf_64bit.engine = engine;
+        CALC_CRC_Init(&crc, &conf_64bit, CALC_CRC_TYPE_64BIT);
+        CALC_CRC_Update(&crc, data, 300);
+        CALC_CRC_Update(&crc, &data[300], sizeof(data) - 300);
+        CALC_CRC_Finalize(&crc, &result_64bit);
+        CTEST_ASSERT_EQ_MSG(expected_64bit, result_64bit, "Expected %016llX, but got %016llX.",
+                            (unsigned long long)expected_64bit, (unsigned long long)result_64bit);
+    }
+
+#ifndef CALC_CRC_CONF_ENGINE
+    // Unknown engine is rejected
+    conf_16bit.engine = CALC_CRC_ENGINE_MAX;
+    result = CALC_CRC_Init(&crc, &conf_16bit, CALC_CRC_TYPE_16BIT);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_Init(%p, %p, CALC_CRC_TYPE_16BIT) -> "
+                        "Expected %d, but got %d.", &crc, &conf_16bit, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+#endif /* CALC_CRC_CONF_ENGINE */
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_width_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_conf_t conf;
+    const calc_crc_model_t *info;
+    const uint8_t check_data[] = "123456789";
+    static uint8_t data[3000];
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 151u) ^ (i >> 3));
+    }
+
+    // Narrower models give their check values on every kernel tier and engine, long data matches the bitwise engine
+    for (size_t i = (size_t)CALC_CRC_MODEL_CRC5_USB; i < (size_t)CALC_CRC_MODEL_MAX; i++)
+    {
+        uint64_t expected = 0;
+
+        CALC_CRC_GetModel((calc_crc_model_e)i, &info);
+        CALC_CRC_InitModel(&crc, &conf, (calc_crc_model_e)i);
+        switch (info->type)
+        {
+            case CALC_CRC_TYPE_8BIT:
+                conf.conf_8bit.engine = CALC_CRC_ENGINE_BITWISE;
+                break;
+            case CALC_CRC_TYPE_16BIT:
+                conf.conf_16bit.engine = CALC_CRC_ENGINE_BITWISE;
+                break;
+            case CALC_CRC_TYPE_32BIT:
+                conf.conf_32bit.engine = CALC_CRC_ENGINE_BITWISE;
+                break;
+            default:
+                conf.conf_64bit.engine = CALC_CRC_ENGINE_BITWISE;
+                break;
+        }
+        CALC_CRC_Init(&crc, &conf, info->type);
+        CALC_CRC_Calculate(&crc, data, sizeof(data), &expected);
+
+        for (int32_t kernel = CALC_CRC_KERNEL_GENERIC; kernel < CALC_CRC_KERNEL_MAX; kernel++)
+        {
+            uint64_t value = 0;
+            uint64_t value_long = 0;
+
+            CALC_CRC_SetKernel((calc_crc_kernel_e)kernel);
+            result = CALC_CRC_InitModel(&crc, &conf, (calc_crc_model_e)i);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_InitModel(%p, %p, %d) -> Expected %d, but got "
+                                "%d.", &crc, &conf, (int)i, CALC_CRC_STATUS_OK, result);
+            CALC_CRC_Calculate(&crc, check_data, 9, &value);
+            CTEST_ASSERT_EQ_MSG(info->check, value, "%s (kernel %d): Expected %016llX, but got %016llX.", info->name,
+                                kernel, (unsigned long long)info->check, (unsigned long long)value);
+            CALC_CRC_Calculate(&crc, data, sizeof(data), &value_long);
+            CTEST_ASSERT_EQ_MSG(expected, value_long, "%s (kernel %d): Expected %016llX, but got %016llX.",
+                                info->name, kernel, (unsigned long long)expected, (unsigned long long)value_long);
+        }
+        CALC_CRC_SetKernel(CALC_CRC_KERNEL_AUTO);
+
+        // CRC of joined data is combined from CRCs of both parts
+        uint64_t crc_a = 0;
+        uint64_t crc_b = 0;
+        uint64_t combined = 0;
+
+        CALC_CRC_InitModel(&crc, &conf, (calc_crc_model_e)i);
+        CALC_CRC_Calculate(&crc, data, 1000, &crc_a);
+        CALC_CRC_Calculate(&crc, data + 1000, sizeof(data) - 1000, &crc_b);
+        result = CALC_CRC_Combine(&crc, &crc_a, &crc_b, sizeof(data) - 1000, &combined);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Combine -> Expected %d, but got %d.",
+                            CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(expected, combined, "%s: Expected %016llX, but got %016llX.", info->name,
+                            (unsigned long long)expected, (unsigned long long)combined);
+    }
+
+    // Width wider than the type is rejected
+    calc_crc_8bit_t conf_8bit = {
+        .polynomial = 0x07,
+        .width = 9,
+    };
+
+    result = CALC_CRC_Init(&crc, &conf_8bit, CALC_CRC_TYPE_8BIT);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_Init(%p, %p, %d) -> Expected %d, but got "
+                        "%d.", &crc, &conf_8bit, CALC_CRC_TYPE_8BIT, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_update_chunks_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_conf_t conf;
+    const calc_crc_model_t *info;
+    static uint8_t data[9000];
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 167u) ^ (i >> 5));
+    }
+
+    // Uneven chunks give the same value as one call, calculations between updates do not disturb the stream
+    for (size_t i = 0; i < (size_t)CALC_CRC_MODEL_MAX; i++)
+    {
+        uint64_t expected = 0;
+        uint64_t other = 0;
+        uint64_t value = 0;
+        size_t offset = 0;
+        size_t chunk = 1;
+
+        CALC_CRC_GetModel((calc_crc_model_e)i, &info);
+        CALC_CRC_InitModel(&crc, &conf, (calc_crc_model_e)i);
+        CALC_CRC_Calculate(&crc, data, sizeof(data), &expected);
+
+        while (offset < sizeof(data))
+        {
+            chunk = ((sizeof(data) - offset) < chunk) ? (sizeof(data) - offset) : chunk;
+            result = CALC_CRC_Update(&crc, &data[offset], chunk);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Update(%p, %p, %zu) -> Expected %d, but got %d.",
+                                &crc, &data[offset], chunk, CALC_CRC_STATUS_OK, result);
+            CALC_CRC_Calculate(&crc, data, 7, &other);
+            offset += chunk;
+            chunk = (chunk * 3u) + 1u;
+        }
+        CALC_CRC_Finalize(&crc, &value);
+        CTEST_ASSERT_EQ_MSG(expected, value, "%s: Expected %016llX, but got %016llX.", info->name,
+                            (unsigned long long)expected, (unsigned long long)value);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_file_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_conf_t conf;
+    static uint8_t data[3 * 65536 + 123];
+    const char *path = "calc_crc_test_file.bin";
+    uint32_t expected, value;
+    uint16_t value_16bit;
+    FILE *file;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 173u) ^ (i >> 7));
+    }
+
+    file = fopen(path, "wb");
+    fwrite(data, 1, sizeof(data), file);
+    fclose(file);
+
+    // File gives the same value as its content, also when mapped in windows of one page
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC32_ISO_HDLC);
+    CALC_CRC_Calculate(&crc, data, sizeof(data), &expected);
+    result = CALC_CRC_CalculateFile(&crc, path, &value);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateFile(%p, %s, %p) -> Expected %d, but got %d.",
+                        &crc, path, &value, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(expected, value, "Expected %08X, but got %08X.", expected, value);
+
+    CALC_CRC_SetFileWindow(1);
+    value = 0;
+    result = CALC_CRC_CalculateFile(&crc, path, &value);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateFile(%p, %s, %p) -> Expected %d, but got %d.",
+                        &crc, path, &value, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(expected, value, "Expected %08X, but got %08X.", expected, value);
+    CALC_CRC_SetFileWindow(64u * 1024u * 1024u);
+
+    // Empty file gives the CRC value of empty data (initial value XOR final value)
+    file = fopen(path, "wb");
+    fclose(file);
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC16_IBM_3740);
+    result = CALC_CRC_CalculateFile(&crc, path, &value_16bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateFile(%p, %s, %p) -> Expected %d, but got %d.",
+                        &crc, path, &value_16bit, CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(0xFFFF, value_16bit, "Expected %04X, but got %04X.", 0xFFFF, value_16bit);
+    remove(path);
+
+    // Missing files and invalid arguments are rejected
+    result = CALC_CRC_CalculateFile(&crc, path, &value_16bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR, result, "CALC_CRC_CalculateFile(%p, %s, %p) -> Expected %d, but got "
+                        "%d.", &crc, path, &value_16bit, CALC_CRC_STATUS_ERROR, result);
+    CTEST_ASSERT_EQ_MSG(false, crc.update_in_progress, "Expected %d, but got %d.", false, crc.update_in_progress);
+    result = CALC_CRC_CalculateFd(&crc, -1, &value_16bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_CalculateFd(%p, -1, %p) -> Expected %d, "
+                        "but got %d.", &crc, &value_16bit, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+    result = CALC_CRC_SetFileWindow(0);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_SetFileWindow(0) -> Expected %d, but got "
+                        "%d.", CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_vec_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_conf_t conf;
+    const calc_crc_model_t *info;
+    static uint8_t data[5000];
+    calc_crc_iovec_t iov[64];
+    size_t count = 0;
+    size_t offset = 0;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 181u) ^ (i >> 6));
+    }
+
+    // Segments of 0, 1 and odd lengths at unaligned offsets, short ones between long ones
+    while ((offset < sizeof(data)) && (count < 63u))
+    {
+        size_t length = ((count % 4u) == 3u) ? (700u + count) : (count % 3u);
+        length = ((sizeof(data) - offset) < length) ? (sizeof(data) - offset) : length;
+        iov[count].base = (0u != length) ? &data[offset] : NULL;
+        iov[count].length = length;
+        offset += length;
+        count++;
+    }
+    iov[count].base = &data[offset];
+    iov[count].length = sizeof(data) - offset;
+    count++;
+
+    for (size_t i = 0; i < (size_t)CALC_CRC_MODEL_MAX; i++)
+    {
+        uint64_t expected = 0;
+        uint64_t value = 0;
+        uint64_t value_update = 0;
+
+        CALC_CRC_GetModel((calc_crc_model_e)i, &info);
+        CALC_CRC_InitModel(&crc, &conf, (calc_crc_model_e)i);
+        CALC_CRC_Calculate(&crc, data, sizeof(data), &expected);
+
+        result = CALC_CRC_CalculateVec(&crc, iov, count, &value);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateVec(%p, %p, %zu, %p) -> Expected %d, but "
+                            "got %d.", &crc, iov, count, &value, CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(expected, value, "%s: Expected %016llX, but got %016llX.", info->name,
+                            (unsigned long long)expected, (unsigned long long)value);
+
+        // Vectored updates continue the stream of plain updates
+        CALC_CRC_Update(&crc, iov[0].base, 1);
+        CALC_CRC_UpdateVec(&crc, &iov[1], count / 2u);
+        CALC_CRC_UpdateVec(&crc, &iov[1u + (count / 2u)], count - 1u - (count / 2u));
+        CALC_CRC_Finalize(&crc, &value_update);
+        CTEST_ASSERT_EQ_MSG(expected, value_update, "%s: Expected %016llX, but got %016llX.", info->name,
+                            (unsigned long long)expected, (unsigned long long)value_update);
+    }
+
+    // Segments with data but without buffer are rejected
+    uint32_t value_32bit;
+    calc_crc_iovec_t invalid[2] = {{data, 4}, {NULL, 1}};
+
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC32_ISO_HDLC);
+    result = CALC_CRC_CalculateVec(&crc, invalid, 2, &value_32bit);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_CalculateVec(%p, %p, 2, %p) -> Expected "
+                        "%d, but got %d.", &crc, invalid, &value_32bit, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+    result = CALC_CRC_UpdateVec(&crc, invalid, 0);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_UpdateVec(%p, %p, 0) -> Expected %d, but "
+                        "got %d.", &crc, invalid, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_files_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_conf_t conf;
+    static uint8_t data[5 * 65536 + 77];
+    const size_t lengths[] = {sizeof(data), 0, 1, 4096, 300001};
+    const char *paths[] = {"calc_crc_test_files_0.bin", "calc_crc_test_files_1.bin", "calc_crc_test_files_2.bin",
+                           "calc_crc_test_files_3.bin", "calc_crc_test_files_4.bin", "calc_crc_test_files_5.bin"};
+    uint64_t expected, values[6];
+    calc_crc_status_e states[6];
+    FILE *file;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 131u) ^ (i >> 9));
+    }
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        file = fopen(paths[i], "wb");
+        fwrite(data, 1, lengths[i], file);
+        fclose(file);
+    }
+
+    // Every file gives the same value as its content (empty file gives the CRC value of empty data)
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC64_XZ);
+    result = CALC_CRC_CalculateFiles(&crc, paths, 5, values, states);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateFiles(%p, %p, 5, %p, %p) -> Expected %d, but "
+                        "got %d.", &crc, paths, values, states, CALC_CRC_STATUS_OK, result);
+    for (size_t i = 0; i < 5; i++)
+    {
+        expected = 0; // CRC-64/XZ of empty data
+        CALC_CRC_Calculate(&crc, data, lengths[i], &expected);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, states[i], "File %zu: Expected %d, but got %d.", i,
+                            CALC_CRC_STATUS_OK, states[i]);
+        CTEST_ASSERT_EQ_MSG(expected, values[i], "File %zu: Expected %016llX, but got %016llX.", i,
+                            (unsigned long long)expected, (unsigned long long)values[i]);
+    }
+
+    // Files other than regular ones are read as with CALC_CRC_CalculateFile
+    const char *mixed[] = {paths[3], "/dev/null", paths[2]};
+    uint64_t single = 1;
+
+    result = CALC_CRC_CalculateFiles(&crc, mixed, 3, values, states);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateFiles(%p, %p, 3, %p, %p) -> Expected %d, but "
+                        "got %d.", &crc, mixed, values, states, CALC_CRC_STATUS_OK, result);
+    CALC_CRC_CalculateFile(&crc, "/dev/null", &single);
+    CTEST_ASSERT_EQ_MSG(single, values[1], "Expected %016llX, but got %016llX.", (unsigned long long)single,
+                        (unsigned long long)values[1]);
+    CALC_CRC_Calculate(&crc, data, lengths[2], &expected);
+    CTEST_ASSERT_EQ_MSG(expected, values[2], "Expected %016llX, but got %016llX.", (unsigned long long)expected,
+                        (unsigned long long)values[2]);
+
+    // Missing file fails alone, other files are still calculated
+    result = CALC_CRC_CalculateFiles(&crc, paths, 6, values, states);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR, result, "CALC_CRC_CalculateFiles(%p, %p, 6, %p, %p) -> Expected %d, "
+                        "but got %d.", &crc, paths, values, states, CALC_CRC_STATUS_ERROR, result);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR, states[5], "Expected %d, but got %d.", CALC_CRC_STATUS_ERROR,
+                        states[5]);
+    CALC_CRC_Calculate(&crc, data, lengths[4], &expected);
+    CTEST_ASSERT_EQ_MSG(expected, values[4], "Expected %016llX, but got %016llX.", (unsigned long long)expected,
+                        (unsigned long long)values[4]);
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        remove(paths[i]);
+    }
+
+    // Invalid arguments are rejected
+    result = CALC_CRC_CalculateFiles(&crc, paths, 0, values, NULL);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_CalculateFiles(%p, %p, 0, %p, NULL) -> "
+                        "Expected %d, but got %d.", &crc, paths, values, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+    result = CALC_CRC_CalculateFiles(&crc, NULL, 1, values, NULL);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_CalculateFiles(%p, NULL, 1, %p, NULL) -> "
+                        "Expected %d, but got %d.", &crc, values, CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_checksum_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_checksum_t conf = {
+        .initial_value = 0,
+    };
+    static uint8_t data[70011];
+    static const size_t lengths[] = {1, 2, 3, 15, 33, 4095, 4097, 10007, 70001};
+    static const uint64_t moduli[] = {256u, 256u, 255u, 65535u, 4294967295u, 65521u};
+    static const uint8_t words[] = {1u, 1u, 1u, 2u, 4u, 1u};
+    static const uint8_t halves[] = {0u, 0u, 8u, 16u, 32u, 16u};
+    const uint8_t text[] = "abcde";
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(0xFFu - ((i * 131u) ^ (i >> 9)));
+    }
+
+    // Fletcher values of "abcde" (odd length, last word zero padded)
+    uint16_t value_16bit = 0;
+    uint32_t value_32bit = 0;
+    uint64_t value_64bit = 0;
+
+    CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_FLETCHER16);
+    CALC_CRC_Calculate(&crc, text, 5, &value_16bit);
+    CTEST_ASSERT_EQ_MSG(0xC8F0, value_16bit, "Expected %04X, but got %04X.", 0xC8F0, value_16bit);
+    CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_FLETCHER32);
+    CALC_CRC_Calculate(&crc, text, 5, &value_32bit);
+    CTEST_ASSERT_EQ_MSG(0xF04FC729, value_32bit, "Expected %08X, but got %08X.", 0xF04FC729, value_32bit);
+    CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_FLETCHER64);
+    CALC_CRC_Calculate(&crc, text, 5, &value_64bit);
+    CTEST_ASSERT_EQ_MSG(0xC8C6C527646362C6, value_64bit, "Expected %016llX, but got %016llX.",
+                        (unsigned long long)0xC8C6C527646362C6, (unsigned long long)value_64bit);
+
+    // Every kernel tier matches a reference reducing both sums after every word (unaligned data, own initial sums)
+    for (size_t t = 0; t < sizeof(moduli) / sizeof(moduli[0]); t++)
+    {
+        calc_crc_type_e type = (calc_crc_type_e)(CALC_CRC_TYPE_SUM8 + t);
+        uint64_t mask = (0u == halves[t]) ? UINT64_MAX : ((1ull << halves[t]) - 1u);
+
+        conf.initial_value = (0u == halves[t]) ? 0x5Au : ((0x12ull << halves[t]) | 0x21u);
+
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+        {
+            const uint8_t *buffer = &data[3];
+            size_t length = lengths[l];
+            uint64_t a = (conf.initial_value & mask) % moduli[t];
+            uint64_t b = (0u == halves[t]) ? 0u : ((conf.initial_value >> halves[t]) % moduli[t]);
+            uint64_t expected;
+
+            for (size_t i = 0; i < length; i += words[t])
+            {
+                uint64_t value = 0;
+                for (size_t k = 0; (k < words[t]) && ((i + k) < length); k++)
+                {
+                    value |= (uint64_t)buffer[i + k] << (8u * k);
+                }
+                a = (a + value) % moduli[t];
+                b = (b + a) % moduli[t];
+            }
+            expected = (0u == halves[t]) ? a : ((b << halves[t]) | a);
+            expected = (CALC_CRC_TYPE_LRC8 == type) ? ((256u - a) & 0xFFu) : expected;
+
+            for (int32_t kernel = CALC_CRC_KERNEL_AUTO; kernel < CALC_CRC_KERNEL_MAX; kernel++)
+            {
+                uint64_t value = 0;
+
+                CALC_CRC_SetKernel((calc_crc_kernel_e)kernel);
+                result = CALC_CRC_Init(&crc, &conf, type);
+                CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p, %d) -> Expected %d, but got %d.",
+                                    &crc, &conf, type, CALC_CRC_STATUS_OK, result);
+                CALC_CRC_Calculate(&crc, buffer, length, &value);
+                CTEST_ASSERT_EQ_MSG(expected, value, "Type %d, length %zu (kernel %d): Expected %016llX, but got "
+                                    "%016llX.", type, length, kernel, (unsigned long long)expected,
+                                    (unsigned long long)value);
+            }
+            CALC_CRC_SetKernel(CALC_CRC_KERNEL_AUTO);
+        }
+
+        // Checksums of joined data are combined from checksums of both parts (first part of whole words)
+        uint64_t expected = 0;
+        uint64_t sum_a = 0;
+        uint64_t sum_b = 0;
+        uint64_t combined = 0;
+
+        CALC_CRC_Init(&crc, &conf, type);
+        CALC_CRC_Calculate(&crc, data, 10007, &expected);
+        CALC_CRC_Calculate(&crc, data, 4096, &sum_a);
+        CALC_CRC_Calculate(&crc, &data[4096], 10007 - 4096, &sum_b);
+        result = CALC_CRC_Combine(&crc, &sum_a, &sum_b, 10007 - 4096, &combined);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Combine -> Expected %d, but got %d.",
+                            CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(expected, combined, "Type %d: Expected %016llX, but got %016llX.", type,
+                            (unsigned long long)expected, (unsigned long long)combined);
+
+        // Parallel spans end on whole words
+        uint64_t parallel = 0;
+
+        CALC_CRC_SetParallel(4, 4096);
+        CALC_CRC_Calculate(&crc, &data[1], sizeof(data) - 1u, &expected);
+        result = CALC_CRC_CalculateParallel(&crc, &data[1], sizeof(data) - 1u, &parallel);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateParallel -> Expected %d, but got %d.",
+                            CALC_CRC_STATUS_OK, result);
+        CTEST_ASSERT_EQ_MSG(expected, parallel, "Type %d: Expected %016llX, but got %016llX.", type,
+                            (unsigned long long)expected, (unsigned long long)parallel);
+        CALC_CRC_SetParallel(0, 1024u * 1024u);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_inet_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_checksum_t conf = {
+        .initial_value = 0,
+    };
+    static uint8_t data[70011];
+    static const size_t lengths[] = {1, 2, 3, 15, 33, 63, 64, 65, 4095, 4097, 10007, 70001};
+    const uint8_t rfc1071[] = {0x00, 0x01, 0xF2, 0x03, 0xF4, 0xF5, 0xF6, 0xF7};
+    const uint8_t zeros[7] = {0};
+    uint8_t header[] = {0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+                        0x00, 0x00, 0xC0, 0xA8, 0x00, 0x01, 0xC0, 0xA8, 0x00, 0xC7};
+    uint16_t value = 0;
+    uint16_t expected = 0;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(0xFFu - ((i * 131u) ^ (i >> 9)));
+    }
+
+    // Example of RFC 1071, an IPv4 header (checksum field zero) and zero data (sum +0)
+    CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_INET16);
+    CALC_CRC_Calculate(&crc, rfc1071, sizeof(rfc1071), &value);
+    CTEST_ASSERT_EQ_MSG(0x220D, value, "Expected %04X, but got %04X.", 0x220D, value);
+    CALC_CRC_Calculate(&crc, header, sizeof(header), &value);
+    CTEST_ASSERT_EQ_MSG(0xB861, value, "Expected %04X, but got %04X.", 0xB861, value);
+    CALC_CRC_Calculate(&crc, zeros, sizeof(zeros), &value);
+    CTEST_ASSERT_EQ_MSG(0xFFFF, value, "Expected %04X, but got %04X.", 0xFFFF, value);
+
+    // Every kernel tier matches a reference folding the carry after every word (unaligned data, pseudo-header sum)
+    conf.initial_value = 0x1C0A8u;
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+    {
+        const uint8_t *buffer = &data[3];
+        size_t length = lengths[l];
+        uint32_t sum = 0xC0A9u;
+
+        for (size_t i = 0; i < length; i += 2u)
+        {
+            sum += ((uint32_t)buffer[i] << 8) | (((i + 1u) < length) ? buffer[i + 1u] : 0u);
+            sum = (sum & 0xFFFFu) + (sum >> 16);
+        }
+        expected = (uint16_t)~sum;
+
+        for (int32_t kernel = CALC_CRC_KERNEL_AUTO; kernel < CALC_CRC_KERNEL_MAX; kernel++)
+        {
+            CALC_CRC_SetKernel((calc_crc_kernel_e)kernel);
+            result = CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_INET16);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Init(%p, %p, %d) -> Expected %d, but got %d.",
+                                &crc, &conf, CALC_CRC_TYPE_INET16, CALC_CRC_STATUS_OK, result);
+            CALC_CRC_Calculate(&crc, buffer, length, &value);
+            CTEST_ASSERT_EQ_MSG(expected, value, "Length %zu (kernel %d): Expected %04X, but got %04X.", length, kernel,
+                                expected, value);
+        }
+        CALC_CRC_SetKernel(CALC_CRC_KERNEL_AUTO);
+    }
+
+    // Checksums of joined data are combined (first part of whole words), parallel spans end on whole words
+    uint16_t sum_a = 0;
+    uint16_t sum_b = 0;
+    uint16_t combined = 0;
+
+    CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_INET16);
+    CALC_CRC_Calculate(&crc, data, 10007, &expected);
+    CALC_CRC_Calculate(&crc, data, 4096, &sum_a);
+    CALC_CRC_Calculate(&crc, &data[4096], 10007 - 4096, &sum_b);
+    result = CALC_CRC_Combine(&crc, &sum_a, &sum_b, 10007 - 4096, &combined);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Combine -> Expected %d, but got %d.", CALC_CRC_STATUS_OK,
+                        result);
+    CTEST_ASSERT_EQ_MSG(expected, combined, "Expected %04X, but got %04X.", expected, combined);
+
+    CALC_CRC_SetParallel(4, 4096);
+    CALC_CRC_Calculate(&crc, &data[1], sizeof(data) - 1u, &expected);
+    result = CALC_CRC_CalculateParallel(&crc, &data[1], sizeof(data) - 1u, &value);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_CalculateParallel -> Expected %d, but got %d.",
+                        CALC_CRC_STATUS_OK, result);
+    CTEST_ASSERT_EQ_MSG(expected, value, "Expected %04X, but got %04X.", expected, value);
+    CALC_CRC_SetParallel(0, 1024u * 1024u);
+
+    // Incremental update (RFC 1624) of TTL, NAT address and fields at odd offsets matches a full calculation
+    static const size_t fields[][2] = {{8, 2}, {12, 4}, {9, 1}, {5, 7}, {11, 3}};
+    uint8_t changed[8];
+
+    conf.initial_value = 0;
+    CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_INET16);
+    for (size_t f = 0; f < sizeof(fields) / sizeof(fields[0]); f++)
+    {
+        size_t offset = fields[f][0];
+        size_t length = fields[f][1];
+        uint16_t adjusted = 0;
+
+        for (size_t i = 0; i < length; i++)
+        {
+            changed[i] = (uint8_t)(header[offset + i] ^ (0x5Bu + (i * 17u)));
+        }
+        CALC_CRC_Calculate(&crc, header, sizeof(header), &value);
+        result = CALC_CRC_Adjust(&crc, &value, offset, &header[offset], changed, length, &adjusted);
+        CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Adjust -> Expected %d, but got %d.",
+                            CALC_CRC_STATUS_OK, result);
+        memcpy(&header[offset], changed, length);
+        CALC_CRC_Calculate(&crc, header, sizeof(header), &expected);
+        CTEST_ASSERT_EQ_MSG(expected, adjusted, "Field %zu/%zu: Expected %04X, but got %04X.", offset, length,
+                            expected, adjusted);
+    }
+
+    // Only Internet checksum instances can be adjusted
+    CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_FLETCHER16);
+    result = CALC_CRC_Adjust(&crc, &value, 0, header, changed, 2, &value);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INVALID_TYPE, result, "CALC_CRC_Adjust -> Expected %d, but got %d.",
+                        CALC_CRC_STATUS_ERROR_INVALID_TYPE, result);
+    result = CALC_CRC_Adjust(NULL, &value, 0, header, changed, 2, &value);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_Adjust -> Expected %d, but got %d.",
+                        CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_patch_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_conf_t conf;
+    const calc_crc_model_t *info;
+    static uint8_t data[100003];
+    static uint8_t patch[4099];
+    static const size_t patches[][2] = {{0, 1}, {5, 2}, {7, 3}, {4096, 4099}, {100000, 3}, {50001, 0}, {12345, 777}};
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 7u) ^ (i >> 11));
+    }
+
+    // Every catalogue model and a model with mixed reflection: patched value matches a full calculation
+    for (size_t m = 0; m <= (size_t)CALC_CRC_MODEL_MAX; m++)
+    {
+        if ((size_t)CALC_CRC_MODEL_MAX == m)
+        {
+            conf.conf_32bit = (calc_crc_32bit_t){
+                .polynomial = 0x814141ABu,
+                .initial_value = 0x12345678u,
+                .final_value = 0x0F0F0F0Fu,
+                .input_reflected = true,
+                .output_reflected = false,
+                .width = 30,
+            };
+            CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_32BIT);
+        }
+        else
+        {
+            CALC_CRC_GetModel((calc_crc_model_e)m, &info);
+            CALC_CRC_InitModel(&crc, &conf, (calc_crc_model_e)m);
+        }
+
+        for (size_t p = 0; p < sizeof(patches) / sizeof(patches[0]); p++)
+        {
+            size_t offset = patches[p][0];
+            size_t length = patches[p][1];
+            uint64_t value = 0;
+            uint64_t patched = 0;
+            uint64_t expected = 0;
+
+            for (size_t i = 0; i < length; i++)
+            {
+                patch[i] = (uint8_t)(data[offset + i] + 1u + (i * 13u));
+            }
+            CALC_CRC_Calculate(&crc, data, sizeof(data), &value);
+            result = CALC_CRC_Patch(&crc, &value, sizeof(data), offset, &data[offset], patch, length, &patched);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_Patch -> Expected %d, but got %d.",
+                                CALC_CRC_STATUS_OK, result);
+            memcpy(&data[offset], patch, length);
+            CALC_CRC_Calculate(&crc, data, sizeof(data), &expected);
+            CTEST_ASSERT_EQ_MSG(expected, patched, "Model %zu, patch %zu/%zu: Expected %016llX, but got %016llX.", m,
+                                offset, length, (unsigned long long)expected, (unsigned long long)patched);
+        }
+    }
+
+    // Modified range must lie within the data
+    uint32_t value = 0;
+
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC32_ISO_HDLC);
+    result = CALC_CRC_Patch(&crc, &value, 100, 98, data, patch, 3, &value);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_Patch -> Expected %d, but got %d.",
+                        CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+    result = CALC_CRC_Patch(&crc, &value, 100, SIZE_MAX, data, patch, 3, &value);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "CALC_CRC_Patch -> Expected %d, but got %d.",
+                        CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_fill_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_conf_t conf;
+    static uint8_t buffer[100003 + 16];
+    static const size_t counts[] = {1, 2, 3, 7, 4096, 100003};
+    static const uint8_t bytes[] = {0x00, 0xA5, 0xFF};
+    const uint8_t head[8] = {0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38};
+    const uint8_t tail[3] = {0xDE, 0xAD, 0x01};
+
+    // Every catalogue model and a model with mixed reflection: runs match the bytes processed one by one
+    for (size_t m = 0; m <= (size_t)CALC_CRC_MODEL_MAX; m++)
+    {
+        if ((size_t)CALC_CRC_MODEL_MAX == m)
+        {
+            conf.conf_32bit = (calc_crc_32bit_t){
+                .polynomial = 0x814141ABu,
+                .initial_value = 0x12345678u,
+                .final_value = 0x0F0F0F0Fu,
+                .input_reflected = true,
+                .output_reflected = false,
+                .width = 30,
+            };
+            CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_32BIT);
+        }
+        else
+        {
+            CALC_CRC_InitModel(&crc, &conf, (calc_crc_model_e)m);
+        }
+
+        for (size_t b = 0; b < sizeof(bytes); b++)
+        {
+            for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+            {
+                size_t count = counts[c];
+                uint64_t expected = 0;
+                uint64_t value = 0;
+
+                // Stream: 5 bytes (incomplete word of checksums), run, 3 bytes
+                memcpy(buffer, head, 5);
+                memset(&buffer[5], bytes[b], count);
+                memcpy(&buffer[5 + count], tail, sizeof(tail));
+                CALC_CRC_Calculate(&crc, buffer, 5 + count + sizeof(tail), &expected);
+                CALC_CRC_Start(&crc);
+                CALC_CRC_Update(&crc, head, 5);
+                result = CALC_CRC_UpdateFill(&crc, bytes[b], count);
+                CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_UpdateFill -> Expected %d, but got %d.",
+                                    CALC_CRC_STATUS_OK, result);
+                CALC_CRC_Update(&crc, tail, sizeof(tail));
+                CALC_CRC_Finalize(&crc, &value);
+                CTEST_ASSERT_EQ_MSG(expected, value, "Model %zu, %02X x %zu: Expected %016llX, but got %016llX.", m,
+                                    bytes[b], count, (unsigned long long)expected, (unsigned long long)value);
+
+                // Value of whole words extended with the run
+                memcpy(buffer, head, sizeof(head));
+                memset(&buffer[sizeof(head)], bytes[b], count);
+                CALC_CRC_Calculate(&crc, buffer, sizeof(head) + count, &expected);
+                CALC_CRC_Calculate(&crc, head, sizeof(head), &value);
+                result = CALC_CRC_ExtendFill(&crc, &value, bytes[b], count, &value);
+                CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_ExtendFill -> Expected %d, but got %d.",
+                                    CALC_CRC_STATUS_OK, result);
+                CTEST_ASSERT_EQ_MSG(expected, value, "Model %zu, %02X x %zu: Expected %016llX, but got %016llX.", m,
+                                    bytes[b], count, (unsigned long long)expected, (unsigned long long)value);
+            }
+        }
+    }
+
+    // Runs longer than 4 GB are split without changing the value
+    uint64_t once = 0;
+    uint64_t twice = 0;
+
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC64_XZ);
+    CALC_CRC_Calculate(&crc, head, sizeof(head), &once);
+    twice = once;
+    CALC_CRC_ExtendFill(&crc, &once, 0xA5, (size_t)1u << 34, &once);
+    CALC_CRC_ExtendFill(&crc, &twice, 0xA5, (size_t)1u << 33, &twice);
+    CALC_CRC_ExtendFill(&crc, &twice, 0xA5, (size_t)1u << 33, &twice);
+    CTEST_ASSERT_EQ_MSG(once, twice, "Expected %016llX, but got %016llX.", (unsigned long long)once,
+                        (unsigned long long)twice);
+
+    // Shared model streams
+    calc_crc_shared_t *model = NULL;
+    calc_crc_stream_t stream;
+    const calc_crc_model_t *info;
+    uint32_t expected = 0;
+    uint32_t value = 0;
+
+    CALC_CRC_GetModel(CALC_CRC_MODEL_CRC32_ISCSI, &info);
+    CALC_CRC_SharedAcquire(info, &model);
+    CALC_CRC_StreamInit(&stream, model);
+    result = CALC_CRC_StreamUpdateFill(&stream, 0x00, 4096);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_StreamUpdateFill -> Expected %d, but got %d.",
+                        CALC_CRC_STATUS_OK, result);
+    CALC_CRC_StreamFinalize(&stream, &value);
+    memset(buffer, 0, 4096);
+    CALC_CRC_SharedCalculate(model, buffer, 4096, &expected);
+    CTEST_ASSERT_EQ_MSG(expected, value, "Expected %08X, but got %08X.", expected, value);
+    CALC_CRC_SharedRelease(model);
+
+    return failed_assertions;
+}
+
+static int32_t test_calc_crc_rolling_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    calc_crc_status_e result;
+    calc_crc_t crc;
+    calc_crc_conf_t conf;
+    calc_crc_rolling_t rolling;
+    uint8_t buffer[300];
+    size_t positions[sizeof(buffer) + 1];
+    size_t expected_positions[sizeof(buffer) + 1];
+    size_t found = 0;
+    static const size_t windows[] = {1, 4, 16, 48};
+    uint32_t state = 0x12345678u;
+
+    for (size_t i = 0; i < sizeof(buffer); i++)
+    {
+        state = (state * 1103515245u) + 12345u;
+        buffer[i] = (uint8_t)(state >> 16);
+    }
+
+    // Every catalogue model and a model with mixed reflection: each window matches the window calculated at once
+    for (size_t m = 0; m <= (size_t)CALC_CRC_MODEL_MAX; m++)
+    {
+        if ((size_t)CALC_CRC_MODEL_MAX == m)
+        {
+            conf.conf_32bit = (calc_crc_32bit_t){
+                .polynomial = 0x814141ABu,
+                .initial_value = 0x12345678u,
+                .final_value = 0x0F0F0F0Fu,
+                .input_reflected = true,
+                .output_reflected = false,
+                .width = 30,
+            };
+            CALC_CRC_Init(&crc, &conf, CALC_CRC_TYPE_32BIT);
+        }
+        else
+        {
+            CALC_CRC_InitModel(&crc, &conf, (calc_crc_model_e)m);
+        }
+
+        if (CALC_CRC_TYPE_SUM8 <= crc.type)
+        {
+            result = CALC_CRC_RollingInit(&rolling, &crc, 4);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INVALID_TYPE, result, "Expected %d, but got %d.",
+                                CALC_CRC_STATUS_ERROR_INVALID_TYPE, result);
+            continue;
+        }
+
+        for (size_t w = 0; w < sizeof(windows) / sizeof(windows[0]); w++)
+        {
+            size_t window = windows[w];
+            uint64_t expected = 0;
+            uint64_t value = 0;
+            uint64_t first = 0;
+            size_t count = 0;
+
+            result = CALC_CRC_RollingInit(&rolling, &crc, window);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_RollingInit -> Expected %d, but got %d.",
+                                CALC_CRC_STATUS_OK, result);
+            CALC_CRC_RollingStart(&rolling, buffer);
+
+            for (size_t p = window; p <= sizeof(buffer); p++)
+            {
+                CALC_CRC_RollingGet(&rolling, &value);
+                CALC_CRC_Calculate(&crc, &buffer[p - window], window, &expected);
+                CTEST_ASSERT_EQ_MSG(expected, value, "Model %zu, window %zu at %zu: Expected %016llX, but got %016llX.",
+                                    m, window, p, (unsigned long long)expected, (unsigned long long)value);
+                first = (window == p) ? expected : first;
+                if (0u == ((expected ^ first) & 0x3u))
+                {
+                    expected_positions[count] = p;
+                    count++;
+                }
+                if (sizeof(buffer) != p)
+                {
+                    CALC_CRC_RollingRoll(&rolling, buffer[p - window], buffer[p]);
+                }
+            }
+
+            // Scanner reports the same windows as brute force, a full positions array stops it
+            result = CALC_CRC_RollingScan(&rolling, buffer, sizeof(buffer), 0x3u, first & 0x3u, positions,
+                                          sizeof(positions) / sizeof(positions[0]), &found);
+            CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_OK, result, "CALC_CRC_RollingScan -> Expected %d, but got %d.",
+                                CALC_CRC_STATUS_OK, result);
+            CTEST_ASSERT_EQ_MSG(count, found, "Model %zu, window %zu: Expected %zu, but got %zu.", m, window, count,
+                                found);
+            CTEST_ASSERT_EQ_MSG(0, memcmp(expected_positions, positions, found * sizeof(size_t)),
+                                "Model %zu, window %zu: positions differ.", m, window);
+            CALC_CRC_RollingScan(&rolling, buffer, sizeof(buffer), 0x3u, first & 0x3u, positions, 1, &found);
+            CTEST_ASSERT_EQ_MSG((size_t)1, found, "Expected %zu, but got %zu.", (size_t)1, found);
+            CTEST_ASSERT_EQ_MSG(expected_positions[0], positions[0], "Expected %zu, but got %zu.",
+                                expected_positions[0], positions[0]);
+        }
+    }
+
+    // Compared bits above the CRC width or outside the mask never match, data shorter than the window has no windows
+    CALC_CRC_InitModel(&crc, &conf, CALC_CRC_MODEL_CRC16_ARC);
+    CALC_CRC_RollingInit(&rolling, &crc, 16);
+    CALC_CRC_RollingScan(&rolling, buffer, sizeof(buffer), 0x10000u, 0x10000u, positions, 8, &found);
+    CTEST_ASSERT_EQ_MSG((size_t)0, found, "Expected %zu, but got %zu.", (size_t)0, found);
+    CALC_CRC_RollingScan(&rolling, buffer, sizeof(buffer), 0x1u, 0x3u, positions, 8, &found);
+    CTEST_ASSERT_EQ_MSG((size_t)0, found, "Expected %zu, but got %zu.", (size_t)0, found);
+    CALC_CRC_RollingScan(&rolling, buffer, 15, 0u, 0u, positions, 8, &found);
+    CTEST_ASSERT_EQ_MSG((size_t)0, found, "Expected %zu, but got %zu.", (size_t)0, found);
+    CALC_CRC_RollingScan(&rolling, buffer, 16, 0u, 0u, positions, 8, &found);
+    CTEST_ASSERT_EQ_MSG((size_t)1, found, "Expected %zu, but got %zu.", (size_t)1, found);
+
+    // Invalid arguments
+    result = CALC_CRC_RollingInit(&rolling, &crc, 0);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "Expected %d, but got %d.",
+                        CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+    result = CALC_CRC_RollingInit(NULL, &crc, 16);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "Expected %d, but got %d.",
+                        CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+    CALC_CRC_RollingInit(&rolling, &crc, 16);
+    result = CALC_CRC_RollingRoll(&rolling, 0x00, 0x00);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_UPDATE_NOT_STARTED, result, "Expected %d, but got %d.",
+                        CALC_CRC_STATUS_ERROR_UPDATE_NOT_STARTED, result);
+    result = CALC_CRC_RollingScan(&rolling, buffer, sizeof(buffer), 0u, 0u, positions, 0, &found);
+    CTEST_ASSERT_EQ_MSG(CALC_CRC_STATUS_ERROR_INPUT_ARGS, result, "Expected %d, but got %d.",
+                        CALC_CRC_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
 // --- EOF -------------------------------------------------------------------------------------------------------------
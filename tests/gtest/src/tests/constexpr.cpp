@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+ *
+ * @file        constexpr.cpp
+ * @brief       Test to cross-check header-only C++ templates against the C API with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-11
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "calc_crc/calc_crc.h"
+#include "calc_crc/calc_crc.hpp"
+
+// --- Compile-Time Tests ----------------------------------------------------------------------------------------------
+
+static_assert(calc_crc::crc8::calculate("123456789") == 0xF4, "CRC-8/SMBUS check value");
+static_assert(calc_crc::crc16_ccitt_false::calculate("123456789") == 0x29B1, "CRC-16/IBM-3740 check value");
+static_assert(calc_crc::crc16_arc::calculate("123456789") == 0xBB3D, "CRC-16/ARC check value");
+static_assert(calc_crc::crc32::calculate("123456789") == 0xCBF43926, "CRC-32/ISO-HDLC check value");
+static_assert(calc_crc::crc32c::calculate("123456789") == 0xE3069283, "CRC-32/ISCSI check value");
+static_assert(calc_crc::crc64_xz::calculate("123456789") == 0x995DC9BBDF1939FA, "CRC-64/XZ check value");
+
+// --- Helper Functions ------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Compare template model against C API with the same configuration on buffers of different lengths.
+ * @tparam  Model   Template model (calc_crc::crc).
+ * @tparam  Conf    C API configuration type of the model width.
+ * @param   type    C API CRC type of the model width.
+ */
+template <typename Model, typename Conf> static void _cross_check(calc_crc_type_e type)
+{
+    calc_crc_t crc;
+    Conf conf = {};
+    std::vector<uint8_t> data(1031);
+
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = (uint8_t)((i * 89u) ^ (i >> 4));
+    }
+
+    conf.polynomial = Model::polynomial;
+    conf.initial_value = Model::initial_value;
+    conf.final_value = Model::final_value;
+    conf.input_reflected = Model::input_reflected;
+    conf.output_reflected = Model::output_reflected;
+    ASSERT_EQ(CALC_CRC_STATUS_OK, CALC_CRC_Init(&crc, &conf, type));
+
+    for (size_t i = 0; i < 256; i++)
+    {
+        ASSERT_EQ(conf.table[i], Model::table[i]);
+    }
+
+    for (size_t length : {1u, 7u, 64u, 200u, 1031u})
+    {
+        typename Model::value_type expected = 0;
+        ASSERT_EQ(CALC_CRC_STATUS_OK, CALC_CRC_Calculate(&crc, data.data(), length, &expected));
+        EXPECT_EQ(expected, Model::calculate(data.data(), length));
+
+        // Streaming calculation in two chunks.
+        auto reg = Model::update(Model::init(), data.data(), length / 2);
+        reg = Model::update(reg, &data[length / 2], length - (length / 2));
+        EXPECT_EQ(expected, Model::finalize(reg));
+    }
+}
+
+// --- Constexpr Tests -------------------------------------------------------------------------------------------------
+
+TEST(ConstexprTest, CrossCheck_8bit)
+{
+    _cross_check<calc_crc::crc8, calc_crc_8bit_t>(CALC_CRC_TYPE_8BIT);
+    _cross_check<calc_crc::crc<8, 0x1D, 0xFD, 0x5A, true, false>, calc_crc_8bit_t>(CALC_CRC_TYPE_8BIT);
+}
+
+TEST(ConstexprTest, CrossCheck_16bit)
+{
+    _cross_check<calc_crc::crc16_ccitt_false, calc_crc_16bit_t>(CALC_CRC_TYPE_16BIT);
+    _cross_check<calc_crc::crc16_arc, calc_crc_16bit_t>(CALC_CRC_TYPE_16BIT);
+    _cross_check<calc_crc::crc<16, 0x8BB7, 0x1234, 0xFFFF, false, true>, calc_crc_16bit_t>(CALC_CRC_TYPE_16BIT);
+}
+
+TEST(ConstexprTest, CrossCheck_32bit)
+{
+    _cross_check<calc_crc::crc32, calc_crc_32bit_t>(CALC_CRC_TYPE_32BIT);
+    _cross_check<calc_crc::crc32c, calc_crc_32bit_t>(CALC_CRC_TYPE_32BIT);
+    _cross_check<calc_crc::crc<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, false, false>, calc_crc_32bit_t>(
+        CALC_CRC_TYPE_32BIT);
+}
+
+TEST(ConstexprTest, CrossCheck_64bit)
+{
+    _cross_check<calc_crc::crc64_xz, calc_crc_64bit_t>(CALC_CRC_TYPE_64BIT);
+    _cross_check<calc_crc::crc<64, 0x42F0E1EBA9EA3693, 0, 0, false, false>, calc_crc_64bit_t>(CALC_CRC_TYPE_64BIT);
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------